@@ -257,8 +257,8 @@ declare global {
          */
         subscribe(hook: HookType, callback: Function): IDisposable;
 
-        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void): IDisposable;
-        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void): IDisposable;
+        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void, options?: ActionHookOptions): IDisposable;
+        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void, options?: ActionHookOptions): IDisposable;
         subscribe(hook: "interval.tick", callback: () => void): IDisposable;
         subscribe(hook: "interval.day", callback: () => void): IDisposable;
         subscribe(hook: "network.chat", callback: (e: NetworkChatEventArgs) => void): IDisposable;
@@ -464,6 +464,18 @@ declare global {
         "waterraise" |
         "watersetheight";
 
+    interface ActionHookOptions {
+        /**
+         * The names of the actions the hook should be called for. If not specified, the hook is called for every action.
+         * Filtering out actions the plugin is not interested in is much cheaper than returning early from the hook.
+         */
+        actions?: (ActionType | string)[];
+    }
+
+    /**
+     * The args and result properties are only built when first read, hooks that do not need them should avoid
+     * reading them. They are only available during the hook, reading them afterwards gives undefined.
+     */
     interface GameActionEventArgs {
         readonly player: number;
         readonly type: number;
@@ -579,9 +591,51 @@ declare global {
         getAllEntities(type: "staff"): Staff[];
         getAllEntities(type: "car"): Car[];
         getAllEntities(type: "litter"): Litter[];
+        /**
+         * Gets the ids of all the entities of the given type, without creating an object for each of them.
+         */
+        getAllEntityIds(type: EntityType | "peep"): Int32Array;
+        /**
+         * Reads the given fields of every entity of the given type that passes the filter, with one array
+         * per field. This is much faster than getAllEntities for scanning many entities every few ticks.
+         * @param filter Ranges the fields of an entity must be within to be included, e.g.
+         * { happiness: { max: 50 }, isInPark: 1 }.
+         */
+        queryEntities<T extends EntityQueryField>(
+            type: EntityType | "peep", fields: T[], filter?: EntityQueryFilter): QueryResult<T>;
+        /**
+         * Reads the given fields of every tile element of the given type on the map, with one array per field.
+         * @param type The type of element to include, or null for all of them.
+         */
+        queryTileElements<T extends TileElementQueryField>(
+            type: TileElementType | null, fields: T[]): QueryResult<T>;
         createEntity(type: EntityType, initializer: object): Entity;
     }
 
+    /**
+     * Entity fields that can be read with GameMap.queryEntities. Fields that do not apply to
+     * an entity, such as happiness for a duck, read as 0.
+     */
+    type EntityQueryField =
+        "id" | "x" | "y" | "z" | "energy" | "happiness" | "nausea" | "hunger" | "thirst" | "toilet" | "cash" |
+        "isInPark";
+
+    type EntityQueryFilter = {
+        [field in EntityQueryField]?: number | { min?: number, max?: number };
+    };
+
+    /**
+     * Tile element fields that can be read with GameMap.queryTileElements or Tile.queryElements.
+     * x, y and index locate the element, so that it can be got with getTile(x, y).getElement(index).
+     */
+    type TileElementQueryField =
+        "x" | "y" | "index" | "baseHeight" | "clearanceHeight" | "direction" | "occupiedQuadrants" | "isGhost";
+
+    /**
+     * The result of a query, the nth item of each array belongs to the nth matching entity or element.
+     */
+    type QueryResult<T extends string> = { count: number } & { [field in T]: Int32Array };
+
     type TileElementType =
         "surface" | "footpath" | "track" | "small_scenery" | "wall" | "entrance" | "large_scenery" | "banner"
         /** This only exist to retrieve the types for existing corrupt elements. For hiding elements, use the isHidden field instead. */
@@ -744,6 +798,11 @@ declare global {
         insertElement(index: number): TileElement;
         /** Removes the tile element at the given index from this tile. */
         removeElement(index: number): void;
+        /**
+         * Reads the given fields of the elements of the given type on this tile, with one array per field.
+         * @param type The type of element to include, or null for all of them.
+         */
+        queryElements<T extends TileElementQueryField>(type: TileElementType | null, fields: T[]): QueryResult<T>;
     }
 
     /**
@@ -14,10 +14,12 @@
 #include <algorithm>
 #include <iterator>
 #include <list>
+#include <optional>
 #include <openrct2/Context.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/audio/AudioChannel.h>
 #include <openrct2/audio/AudioMixer.h>
+#include <openrct2/audio/AudioMixing.h>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/audio/audio.h>
 #include <openrct2/common.h>
@@ -44,9 +46,14 @@ namespace OpenRCT2::Audio
         IAudioSource* _css1Sources[RCT2SoundCount] = { nullptr };
         IAudioSource* _musicSources[PATH_ID_END] = { nullptr };
 
+        // Converters from the formats of streamed sources, memory sources are converted when they are loaded
+        std::vector<std::pair<AudioFormat, std::optional<SDL_AudioCVT>>> _converters;
+
         std::vector<uint8_t> _channelBuffer;
         std::vector<uint8_t> _convertBuffer;
-        std::vector<uint8_t> _effectBuffer;
+        std::vector<float> _sampleBuffer;
+        std::vector<float> _effectBuffer;
+        std::vector<float> _mixBuffer;
 
     public:
         AudioMixerImpl()
@@ -116,12 +123,17 @@ namespace OpenRCT2::Audio
             }
 
             // Free buffers
+            _converters.clear();
             _channelBuffer.clear();
             _channelBuffer.shrink_to_fit();
             _convertBuffer.clear();
             _convertBuffer.shrink_to_fit();
+            _sampleBuffer.clear();
+            _sampleBuffer.shrink_to_fit();
             _effectBuffer.clear();
             _effectBuffer.shrink_to_fit();
+            _mixBuffer.clear();
+            _mixBuffer.shrink_to_fit();
         }
 
         void Lock() override
@@ -211,10 +223,10 @@ namespace OpenRCT2::Audio
         {
             UpdateAdjustedSound();
 
-            // Zero the output buffer
-            std::fill_n(dst, length, 0);
+            // Zero the mix bus
+            _mixBuffer.assign(length / _format.BytesPerSample(), 0.0f);
 
-            // Mix channels onto output buffer
+            // Mix channels onto the mix bus
             auto it = _channels.begin();
             while (it != _channels.end())
             {
@@ -223,7 +235,7 @@ namespace OpenRCT2::Audio
                 if ((group != MixerGroup::Sound || gConfigSound.sound_enabled) && gConfigSound.master_sound_enabled
                     && gConfigSound.master_volume != 0)
                 {
-                    MixChannel(channel, dst, length);
+                    MixChannel(channel, length);
                 }
                 if ((channel->IsDone() && channel->DeleteOnDone()) || channel->IsStopping())
                 {
@@ -235,6 +247,20 @@ namespace OpenRCT2::Audio
                     it++;
                 }
             }
+
+            // Write the mix bus to the output buffer
+            switch (_format.format)
+            {
+                case AUDIO_S16SYS:
+                    Mixing::ConvertFloatToS16(_mixBuffer.data(), reinterpret_cast<int16_t*>(dst), _mixBuffer.size());
+                    break;
+                case AUDIO_U8:
+                    Mixing::ConvertFloatToU8(_mixBuffer.data(), dst, _mixBuffer.size());
+                    break;
+                default:
+                    std::fill_n(dst, length, 0);
+                    break;
+            }
         }
 
         void UpdateAdjustedSound()
@@ -252,15 +278,11 @@ namespace OpenRCT2::Audio
             }
         }
 
-        void MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t length)
+        void MixChannel(ISDLAudioChannel* channel, size_t length)
         {
             int32_t byteRate = _format.GetByteRate();
-            auto numSamples = static_cast<int32_t>(length / byteRate);
-            double rate = 1;
-            if (_format.format == AUDIO_S16SYS)
-            {
-                rate = channel->GetRate();
-            }
+            auto numFrames = length / byteRate;
+            double rate = channel->GetRate();
 
             bool mustConvert = false;
             SDL_AudioCVT cvt;
@@ -268,25 +290,24 @@ namespace OpenRCT2::Audio
             AudioFormat streamformat = channel->GetFormat();
             if (streamformat != _format)
             {
-                if (SDL_BuildAudioCVT(
-                        &cvt, streamformat.format, streamformat.channels, streamformat.freq, _format.format, _format.channels,
-                        _format.freq)
-                    == -1)
+                auto converter = GetConverter(streamformat);
+                if (converter == nullptr)
                 {
                     // Unable to convert channel data
                     return;
                 }
+                cvt = *converter;
                 mustConvert = true;
             }
 
             // Read raw PCM from channel
-            int32_t readSamples = numSamples * rate;
+            auto readSamples = static_cast<int32_t>(numFrames * rate);
             auto readLength = static_cast<size_t>(readSamples / cvt.len_ratio) * byteRate;
             _channelBuffer.resize(readLength);
             size_t bytesRead = channel->Read(_channelBuffer.data(), readLength);
 
             // Convert data to required format if necessary
-            void* buffer = nullptr;
+            const void* buffer = nullptr;
             size_t bufferLen = 0;
             if (mustConvert)
             {
@@ -306,44 +327,52 @@ namespace OpenRCT2::Audio
                 bufferLen = bytesRead;
             }
 
+            // Convert the samples to floats for the effects and the mix bus
+            auto numSamples = bufferLen / _format.BytesPerSample();
+            _sampleBuffer.resize(numSamples);
+            switch (_format.format)
+            {
+                case AUDIO_S16SYS:
+                    Mixing::ConvertS16ToFloat(static_cast<const int16_t*>(buffer), _sampleBuffer.data(), numSamples);
+                    break;
+                case AUDIO_U8:
+                    Mixing::ConvertU8ToFloat(static_cast<const uint8_t*>(buffer), _sampleBuffer.data(), numSamples);
+                    break;
+                default:
+                    return;
+            }
+            const float* samples = _sampleBuffer.data();
+            auto sampleFrames = bufferLen / byteRate;
+
             // Apply effects
             if (rate != 1)
             {
-                auto inRate = static_cast<int32_t>(bufferLen / byteRate);
-                int32_t outRate = numSamples;
+                auto inRate = static_cast<int32_t>(sampleFrames);
+                auto outRate = static_cast<int32_t>(numFrames);
                 if (bytesRead != readLength)
                 {
                     inRate = _format.freq;
                     outRate = _format.freq * (1 / rate);
                 }
-                _effectBuffer.resize(length);
-                bufferLen = ApplyResample(
-                    channel, buffer, static_cast<int32_t>(bufferLen / byteRate), numSamples, inRate, outRate);
-                buffer = _effectBuffer.data();
+                sampleFrames = ApplyResample(channel, samples, sampleFrames, numFrames, inRate, outRate);
+                samples = _effectBuffer.data();
             }
 
-            // Apply panning and volume
-            ApplyPan(channel, buffer, bufferLen, byteRate);
-            int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
-
-            // Finally mix on to destination buffer
-            size_t dstLength = std::min(length, bufferLen);
-            SDL_MixAudioFormat(
-                data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+            // Finally apply panning and volume while mixing on to the mix bus
+            auto [startGain, endGain] = GetGain(channel);
+            Mixing::Accumulate(
+                _mixBuffer.data(), samples, std::min(numFrames, sampleFrames), _format.channels, startGain, endGain);
 
             channel->UpdateOldVolume();
         }
 
         /**
-         * Resample the given buffer into _effectBuffer.
-         * Assumes that srcBuffer is the same format as _format.
+         * Resample the given samples into _effectBuffer.
+         * Assumes that src is the same layout as _format.
          */
         size_t ApplyResample(
-            ISDLAudioChannel* channel, const void* srcBuffer, int32_t srcSamples, int32_t dstSamples, int32_t inRate,
-            int32_t outRate)
+            ISDLAudioChannel* channel, const float* src, size_t srcFrames, size_t dstFrames, int32_t inRate, int32_t outRate)
         {
-            int32_t byteRate = _format.GetByteRate();
-
             // Create resampler
             SpeexResamplerState* resampler = channel->GetResampler();
             if (resampler == nullptr)
@@ -353,32 +382,19 @@ namespace OpenRCT2::Audio
             }
             speex_resampler_set_rate(resampler, inRate, outRate);
 
-            uint32_t inLen = srcSamples;
-            uint32_t outLen = dstSamples;
-            speex_resampler_process_interleaved_int(
-                resampler, static_cast<const spx_int16_t*>(srcBuffer), &inLen,
-                reinterpret_cast<spx_int16_t*>(_effectBuffer.data()), &outLen);
-
-            return outLen * byteRate;
-        }
+            _effectBuffer.resize(dstFrames * _format.channels);
+            auto inLen = static_cast<uint32_t>(srcFrames);
+            auto outLen = static_cast<uint32_t>(dstFrames);
+            speex_resampler_process_interleaved_float(resampler, src, &inLen, _effectBuffer.data(), &outLen);
 
-        void ApplyPan(const IAudioChannel* channel, void* buffer, size_t len, size_t sampleSize)
-        {
-            if (channel->GetPan() != 0.5f && _format.channels == 2)
-            {
-                switch (_format.format)
-                {
-                    case AUDIO_S16SYS:
-                        EffectPanS16(channel, static_cast<int16_t*>(buffer), static_cast<int32_t>(len / sampleSize));
-                        break;
-                    case AUDIO_U8:
-                        EffectPanU8(channel, static_cast<uint8_t*>(buffer), static_cast<int32_t>(len / sampleSize));
-                        break;
-                }
-            }
+            return outLen;
         }
 
-        int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+        /**
+         * Gets the gain of the channel at the start and end of the chunk, it fades between the previous and the
+         * current volume and pan to smooth out sound and minimize clicks from sudden changes.
+         */
+        std::pair<Mixing::StereoGain, Mixing::StereoGain> GetGain(const IAudioChannel* channel) const
         {
             float volumeAdjust = _volume;
             volumeAdjust *= gConfigSound.master_sound_enabled ? (static_cast<float>(gConfigSound.master_volume) / 100.0f)
@@ -401,90 +417,33 @@ namespace OpenRCT2::Audio
                     break;
             }
 
-            int32_t startVolume = channel->GetOldVolume() * volumeAdjust;
-            int32_t endVolume = channel->GetVolume() * volumeAdjust;
-            if (channel->IsStopping())
+            float startVolume = channel->GetOldVolume() * volumeAdjust / MIXER_VOLUME_MAX;
+            float endVolume = channel->IsStopping() ? 0.0f : channel->GetVolume() * volumeAdjust / MIXER_VOLUME_MAX;
+            if (_format.channels == 2)
             {
-                endVolume = 0;
+                return { { channel->GetOldVolumeL() * startVolume, channel->GetOldVolumeR() * startVolume },
+                         { channel->GetVolumeL() * endVolume, channel->GetVolumeR() * endVolume } };
             }
-
-            int32_t mixVolume = channel->GetVolume() * volumeAdjust;
-            if (startVolume != endVolume)
-            {
-                // Set to max since we are adjusting the volume ourselves
-                mixVolume = MIXER_VOLUME_MAX;
-
-                // Fade between volume levels to smooth out sound and minimize clicks from sudden volume changes
-                int32_t fadeLength = static_cast<int32_t>(len) / _format.BytesPerSample();
-                switch (_format.format)
-                {
-                    case AUDIO_S16SYS:
-                        EffectFadeS16(static_cast<int16_t*>(buffer), fadeLength, startVolume, endVolume);
-                        break;
-                    case AUDIO_U8:
-                        EffectFadeU8(static_cast<uint8_t*>(buffer), fadeLength, startVolume, endVolume);
-                        break;
-                }
-            }
-            return mixVolume;
+            return { { startVolume, startVolume }, { endVolume, endVolume } };
         }
 
-        static void EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length)
+        const SDL_AudioCVT* GetConverter(const AudioFormat& format)
         {
-            const float dt = 1.0f / static_cast<float>(length * 2.0f);
-            float volumeL = channel->GetOldVolumeL();
-            float volumeR = channel->GetOldVolumeR();
-            const float d_left = dt * (channel->GetVolumeL() - channel->GetOldVolumeL());
-            const float d_right = dt * (channel->GetVolumeR() - channel->GetOldVolumeR());
-
-            for (int32_t i = 0; i < length * 2; i += 2)
+            auto it = std::find_if(
+                _converters.begin(), _converters.end(), [&format](const auto& converter) { return converter.first == format; });
+            if (it == _converters.end())
             {
-                data[i + 0] = static_cast<int16_t>(volumeL * static_cast<float>(data[i + 0]));
-                data[i + 1] = static_cast<int16_t>(volumeR * static_cast<float>(data[i + 1]));
-                volumeL += d_left;
-                volumeR += d_right;
-            }
-        }
-
-        static void EffectPanU8(const IAudioChannel* channel, uint8_t* data, int32_t length)
-        {
-            float volumeL = channel->GetVolumeL();
-            float volumeR = channel->GetVolumeR();
-            float oldVolumeL = channel->GetOldVolumeL();
-            float oldVolumeR = channel->GetOldVolumeR();
-
-            for (int32_t i = 0; i < length * 2; i += 2)
-            {
-                float t = static_cast<float>(i) / static_cast<float>(length * 2.0f);
-                data[i] = static_cast<uint8_t>(data[i] * ((1.0 - t) * oldVolumeL + t * volumeL));
-                data[i + 1] = static_cast<uint8_t>(data[i + 1] * ((1.0 - t) * oldVolumeR + t * volumeR));
-            }
-        }
-
-        static void EffectFadeS16(int16_t* data, int32_t length, int32_t startvolume, int32_t endvolume)
-        {
-            static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
-
-            float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-            float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
-            for (int32_t i = 0; i < length; i++)
-            {
-                float t = static_cast<float>(i) / length;
-                data[i] = static_cast<int16_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
-            }
-        }
-
-        static void EffectFadeU8(uint8_t* data, int32_t length, int32_t startvolume, int32_t endvolume)
-        {
-            static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
-
-            float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-            float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
-            for (int32_t i = 0; i < length; i++)
-            {
-                float t = static_cast<float>(i) / length;
-                data[i] = static_cast<uint8_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+                std::optional<SDL_AudioCVT> cvt;
+                cvt.emplace();
+                if (SDL_BuildAudioCVT(
+                        &*cvt, format.format, format.channels, format.freq, _format.format, _format.channels, _format.freq)
+                    == -1)
+                {
+                    cvt.reset();
+                }
+                it = _converters.emplace(_converters.end(), format, cvt);
             }
+            return it->second ? &*it->second : nullptr;
         }
 
         bool Convert(SDL_AudioCVT* cvt, const void* src, size_t len)
@@ -259,6 +259,7 @@ rct_window* WindowCreate(
     // Setup window
     w->classification = cls;
     w->flags = flags;
+    window_register(itNew);
 
     // Play sounds and flash the window
     if (!(flags & (WF_STICK_TO_BACK | WF_STICK_TO_FRONT)))
@@ -300,11 +300,11 @@ static void visible_list_refresh(rct_window* w)
     visible_list_dispose();
     w->selected_list_item = -1;
 
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
     for (int32_t i = 0; i < numObjects; i++)
     {
         uint8_t selectionFlags = _objectSelectionFlags[i];
-        const ObjectRepositoryItem* item = &items[i];
+        const ObjectRepositoryItem* item = items[i];
         ObjectType objectType = item->ObjectEntry.GetType();
         if (objectType == get_selected_object_type(w) && !(selectionFlags & OBJECT_SELECTION_FLAG_6) && filter_source(item)
             && filter_string(item) && filter_chunks(item) && filter_selected(selectionFlags))
@@ -1372,12 +1372,12 @@ static void window_editor_object_selection_manage_tracks()
 static void editor_load_selected_objects()
 {
     int32_t numItems = static_cast<int32_t>(object_repository_get_items_count());
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
     for (int32_t i = 0; i < numItems; i++)
     {
         if (_objectSelectionFlags[i] & OBJECT_SELECTION_FLAG_SELECTED)
         {
-            const ObjectRepositoryItem* item = &items[i];
+            const ObjectRepositoryItem* item = items[i];
             const rct_object_entry* entry = &item->ObjectEntry;
             const auto* loadedObject = object_manager_get_loaded_object(ObjectEntryDescriptor(*item));
             if (loadedObject == nullptr)
@@ -1574,10 +1574,10 @@ static void filter_update_counts()
         std::fill(std::begin(_filter_object_counts), std::end(_filter_object_counts), 0);
 
         size_t numObjects = object_repository_get_items_count();
-        const ObjectRepositoryItem* items = object_repository_get_items();
+        const ObjectRepositoryItem* const* items = object_repository_get_items();
         for (size_t i = 0; i < numObjects; i++)
         {
-            const ObjectRepositoryItem* item = &items[i];
+            const ObjectRepositoryItem* item = items[i];
             if (filter_source(item) && filter_string(item) && filter_chunks(item) && filter_selected(selectionFlags[i]))
             {
                 ObjectType objectType = item->ObjectEntry.GetType();
@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include <cctype>
 #include <cmath>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Widget.h>
@@ -16,6 +17,7 @@
 #include <openrct2/config/Config.h>
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/localisation/Localisation.h>
+#include <openrct2/localisation/LocalisationService.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/scenario/Scenario.h>
 #include <openrct2/sprites.h>
@@ -23,6 +25,8 @@
 #include <openrct2/util/Util.h>
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Sprite.h>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_GUESTS;
@@ -115,12 +119,28 @@ private:
         uint8_t Faces[58]{};
     };
 
-    struct GuestItem
+    /**
+     * The formatted name of a guest, kept between refreshes of the list so that only guests that are new or have
+     * been renamed need to be formatted again.
+     */
+    struct GuestIndexEntry
     {
-        using CompareFunc = bool (*)(const GuestItem&, const GuestItem&);
+        uint32_t PeepId{};
+        std::string CustomName;
+        bool RealNames{};
+        std::string Name;
+        std::string SortKey;
+
+        // The refresh the guest was last shown in and the refresh it was added to the list with its current name
+        uint32_t LastShown{};
+        uint32_t ListedSince{};
+    };
 
+    struct GuestItem
+    {
         uint16_t Id;
-        char Name[256];
+        const GuestIndexEntry* Entry;
+        uint32_t ListedSince;
     };
 
     static constexpr const uint8_t SUMMARISED_GUEST_ROW_HEIGHT = SCROLLABLE_ROW_HEIGHT + 11;
@@ -142,7 +162,11 @@ private:
     uint32_t _lastFindGroupsTick{};
     uint32_t _lastFindGroupsWait{};
     std::vector<GuestGroup> _groups;
+    std::unordered_map<std::string, size_t> _groupIndex;
 
+    std::unordered_map<uint16_t, GuestIndexEntry> _guestIndex;
+    int32_t _guestIndexLanguage = -1;
+    uint32_t _refreshCount{};
     std::vector<GuestItem> _guestList;
     std::optional<size_t> _highlightedIndex;
 
@@ -554,20 +578,15 @@ public:
         {
             case TabId::Individual:
             {
-                auto i = screenCoords.y / SCROLLABLE_ROW_HEIGHT;
-                i += static_cast<int32_t>(_selectedPage * GUESTS_PER_PAGE);
-                for (const auto& guestItem : _guestList)
+                auto i = static_cast<size_t>(screenCoords.y / SCROLLABLE_ROW_HEIGHT);
+                i += _selectedPage * GUESTS_PER_PAGE;
+                if (i < _guestList.size())
                 {
-                    if (i == 0)
+                    auto guest = GetEntity<Guest>(_guestList[i].Id);
+                    if (guest != nullptr)
                     {
-                        auto guest = GetEntity<Guest>(guestItem.Id);
-                        if (guest != nullptr)
-                        {
-                            window_guest_open(guest);
-                        }
-                        break;
+                        window_guest_open(guest);
                     }
-                    i--;
                 }
                 break;
             }
@@ -615,8 +634,15 @@ public:
         }
         else
         {
-            _guestList.clear();
+            if (_guestIndexLanguage != LocalisationService_GetCurrentLanguage())
+            {
+                _guestList.clear();
+                _guestIndex.clear();
+                _guestIndexLanguage = LocalisationService_GetCurrentLanguage();
+            }
+            _refreshCount++;
 
+            std::vector<GuestItem> addedItems;
             for (auto peep : EntityList<Guest>())
             {
                 sprite_set_flashing(peep, false);
@@ -628,18 +654,34 @@ public:
                         continue;
                     sprite_set_flashing(peep, true);
                 }
-                if (!GuestShouldBeVisible(*peep))
-                    continue;
 
-                auto& item = _guestList.emplace_back();
-                item.Id = peep->sprite_index;
+                auto& entry = GetIndexEntry(*peep);
+                if (!GuestShouldBeVisible(*peep, entry))
+                    continue;
 
-                Formatter ft;
-                peep->FormatNameTo(ft);
-                format_string(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+                auto wasListed = entry.ListedSince != 0 && entry.LastShown + 1 == _refreshCount;
+                entry.LastShown = _refreshCount;
+                if (!wasListed)
+                {
+                    entry.ListedSince = _refreshCount;
+                    addedItems.push_back({ peep->sprite_index, &entry, _refreshCount });
+                }
             }
 
-            std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
+            // The guests that are still shown under the same name remain in order, so only the new ones need sorting
+            _guestList.erase(
+                std::remove_if(
+                    _guestList.begin(), _guestList.end(),
+                    [this](const GuestItem& item) {
+                        return item.Entry->LastShown != _refreshCount || item.Entry->ListedSince != item.ListedSince;
+                    }),
+                _guestList.end());
+            std::sort(addedItems.begin(), addedItems.end(), CompareGuestItem);
+            auto numListed = _guestList.size();
+            _guestList.insert(_guestList.end(), addedItems.begin(), addedItems.end());
+            std::inplace_merge(_guestList.begin(), _guestList.begin() + numListed, _guestList.end(), CompareGuestItem);
+
+            PruneIndex();
         }
     }
 
@@ -663,13 +705,18 @@ private:
 
     void DrawScrollIndividual(rct_drawpixelinfo& dpi)
     {
-        size_t index = 0;
-        auto y = static_cast<int32_t>(_selectedPage) * -GUEST_PAGE_HEIGHT;
-        for (const auto& guestItem : _guestList)
+        // Skip straight to the first row in view, only those rows are formatted
+        auto pageY = static_cast<int32_t>(_selectedPage) * -GUEST_PAGE_HEIGHT;
+        auto index = static_cast<size_t>(std::max(0, (dpi.y - pageY) / SCROLLABLE_ROW_HEIGHT - 1));
+        for (; index < _guestList.size(); index++)
         {
+            const auto& guestItem = _guestList[index];
+            auto y = pageY + static_cast<int32_t>(index) * SCROLLABLE_ROW_HEIGHT;
+            if (y >= dpi.y + dpi.height || y >= 0x7FFF)
+                break;
+
             // Check if y is beyond the scroll control
-            if (y + SCROLLABLE_ROW_HEIGHT + 1 >= -0x7FFF && y + SCROLLABLE_ROW_HEIGHT + 1 > dpi.y && y < 0x7FFF
-                && y < dpi.y + dpi.height)
+            if (y + SCROLLABLE_ROW_HEIGHT + 1 >= -0x7FFF && y + SCROLLABLE_ROW_HEIGHT + 1 > dpi.y)
             {
                 // Highlight backcolour and text colour (format)
                 rct_string_id format = STR_BLACK_STRING;
@@ -723,8 +770,6 @@ private:
                         break;
                 }
             }
-            y += SCROLLABLE_ROW_HEIGHT;
-            index++;
         }
     }
 
@@ -780,19 +825,14 @@ private:
         }
     }
 
-    bool GuestShouldBeVisible(const Guest& peep)
+    bool GuestShouldBeVisible(const Guest& peep, const GuestIndexEntry& entry)
     {
         if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
             return false;
 
         if (!_filterName.empty())
         {
-            char name[256]{};
-
-            Formatter ft;
-            peep.FormatNameTo(ft);
-            format_string(name, sizeof(name), STR_STRINGID, ft.Data());
-            if (strcasestr(name, _filterName.c_str()) == nullptr)
+            if (strcasestr(entry.Name.c_str(), _filterName.c_str()) == nullptr)
             {
                 return false;
             }
@@ -801,6 +841,49 @@ private:
         return true;
     }
 
+    /**
+     * Gets the index entry of the guest, formatting its name again if the guest is new or has been renamed.
+     */
+    GuestIndexEntry& GetIndexEntry(const Guest& peep)
+    {
+        auto realNames = (gParkFlags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES) != 0;
+        auto [it, added] = _guestIndex.try_emplace(peep.sprite_index);
+        auto& entry = it->second;
+        if (!added && entry.PeepId == peep.Id && entry.RealNames == realNames
+            && entry.CustomName == (peep.Name != nullptr ? peep.Name : ""))
+        {
+            return entry;
+        }
+
+        entry.PeepId = peep.Id;
+        entry.CustomName = peep.Name != nullptr ? peep.Name : "";
+        entry.RealNames = realNames;
+        entry.Name = peep.GetName();
+        entry.SortKey = GetSortKey(entry.Name);
+        entry.ListedSince = 0;
+        return entry;
+    }
+
+    /**
+     * Removes the entries of guests that have left the park, keeping those of guests that are only filtered out.
+     */
+    void PruneIndex()
+    {
+        for (auto it = _guestIndex.begin(); it != _guestIndex.end();)
+        {
+            const auto& entry = it->second;
+            auto* peep = GetEntity<Guest>(it->first);
+            if (entry.LastShown != _refreshCount && (peep == nullptr || peep->Id != entry.PeepId || peep->OutsideOfPark))
+            {
+                it = _guestIndex.erase(it);
+            }
+            else
+            {
+                it++;
+            }
+        }
+    }
+
     bool IsPeepInFilter(const Guest& peep)
     {
         auto guestViewType = _selectedFilter == GuestFilterType::Guests ? GuestViewType::Actions : GuestViewType::Thoughts;
@@ -828,11 +911,11 @@ private:
 
     GuestGroup& FindOrAddGroup(FilterArguments&& arguments)
     {
-        auto foundGroup = std::find_if(
-            std::begin(_groups), std::end(_groups), [&arguments](GuestGroup& group) { return group.Arguments == arguments; });
-        if (foundGroup != std::end(_groups))
+        auto key = std::string(reinterpret_cast<const char*>(arguments.args), sizeof(arguments.args));
+        auto [it, added] = _groupIndex.emplace(std::move(key), _groups.size());
+        if (!added)
         {
-            return *foundGroup;
+            return _groups[it->second];
         }
         auto& newGroup = _groups.emplace_back();
         newGroup.Arguments = arguments;
@@ -845,6 +928,7 @@ private:
         _lastFindGroupsSelectedView = _selectedView;
         _lastFindGroupsWait = 320;
         _groups.clear();
+        _groupIndex.clear();
 
         for (auto peep : EntityList<Guest>())
         {
@@ -930,34 +1014,47 @@ private:
         }
     }
 
-    template<bool TRealNames> static bool CompareGuestItem(const GuestItem& a, const GuestItem& b)
+    /**
+     * Creates a key for the name that, compared byte by byte, sorts the same as strlogicalcmp: case insensitive and
+     * with numbers compared by value, so guests named after their number are in the order of their number.
+     */
+    static std::string GetSortKey(std::string_view name)
     {
-        const auto* peepA = GetEntity<Peep>(a.Id);
-        const auto* peepB = GetEntity<Peep>(b.Id);
-        if (peepA != nullptr && peepB != nullptr)
+        std::string key;
+        key.reserve(name.size() + 2);
+        for (size_t i = 0; i < name.size();)
         {
-            // Compare types
-            if (peepA->Type != peepB->Type)
+            if (isdigit(static_cast<unsigned char>(name[i])))
             {
-                return static_cast<int32_t>(peepA->Type) < static_cast<int32_t>(peepB->Type);
-            }
-
-            // Compare name
-            if constexpr (!TRealNames)
-            {
-                if (peepA->Name == nullptr && peepB->Name == nullptr)
+                // Numbers are stored as '0', the number of digits and the digits without leading zeros
+                auto start = i;
+                while (i < name.size() && isdigit(static_cast<unsigned char>(name[i])))
                 {
-                    // Simple ID comparison for when both peeps use a number or a generated name
-                    return peepA->Id < peepB->Id;
+                    i++;
                 }
+                auto digits = name.substr(start, i - start);
+                digits.remove_prefix(std::min(digits.find_first_not_of('0'), digits.size()));
+                key.push_back('0');
+                key.push_back(static_cast<char>(digits.size()));
+                key.append(digits);
+            }
+            else
+            {
+                key.push_back(static_cast<char>(toupper(static_cast<unsigned char>(name[i]))));
+                i++;
             }
         }
-        return strlogicalcmp(a.Name, b.Name) < 0;
+        return key;
     }
 
-    static GuestItem::CompareFunc GetGuestCompareFunc()
+    static bool CompareGuestItem(const GuestItem& a, const GuestItem& b)
     {
-        return gParkFlags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES ? CompareGuestItem<true> : CompareGuestItem<false>;
+        auto result = a.Entry->SortKey.compare(b.Entry->SortKey);
+        if (result != 0)
+        {
+            return result < 0;
+        }
+        return a.Entry->PeepId < b.Entry->PeepId;
     }
 };
 
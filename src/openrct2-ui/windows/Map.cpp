@@ -62,6 +62,16 @@ constexpr uint8_t GuestMapColourAlternate = PALETTE_INDEX_21;
 constexpr uint8_t StaffMapColour = PALETTE_INDEX_138;
 constexpr uint8_t StaffMapColourAlternate = PALETTE_INDEX_10;
 
+// Ordered by priority, the peep of the highest kind on a tile is the one drawn
+enum class MapPeepKind : uint8_t
+{
+    None,
+    Guest,
+    Staff,
+    FlashingGuest,
+    FlashingStaff,
+};
+
 // Some functions manipulate coordinates on the map. These are the coordinates of the pixels in the
 // minimap. In order to distinguish those from actual coordinates, we use a separate name.
 using MapCoordsXY = TileCoordsXY;
@@ -186,15 +196,23 @@ static uint8_t _activeTool;
 /** rct2: 0x00F1AD6C */
 static uint32_t _currentLine;
 
+// Lines left to draw before the whole map is up to date
+static uint32_t _numLinesToRefresh;
+
 /** rct2: 0x00F1AD68 */
 static std::vector<uint8_t> _mapImageData;
 
+// The peeps on each tile, so that crowded tiles are only drawn once
+static std::vector<MapPeepKind> _peepGrid;
+static std::vector<TileCoordsXY> _peepTiles;
+
 static uint16_t _landRightsToolSize;
 
 static void window_map_init_map();
 static void window_map_centre_on_view_point();
 static void window_map_show_default_scenario_editor_buttons(rct_window* w);
 static void window_map_draw_tab_images(rct_window* w, rct_drawpixelinfo* dpi);
+static void window_map_update_peep_grid();
 static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi);
 static void window_map_paint_train_overlay(rct_drawpixelinfo* dpi);
 static void window_map_paint_hud_rectangle(rct_drawpixelinfo* dpi);
@@ -209,6 +227,7 @@ static void window_map_set_peep_spawn_tool_down(const ScreenCoordsXY& screenCoor
 static void map_window_increase_map_size();
 static void map_window_decrease_map_size();
 static void map_window_set_pixels(rct_window* w);
+static void map_window_set_tile_pixel(rct_window* w, const TileCoordsXY& tileCoords);
 
 static CoordsXY map_window_screen_to_map(ScreenCoordsXY screenCoords);
 
@@ -232,6 +251,7 @@ rct_window* window_map_open()
     try
     {
         _mapImageData.resize(MAP_WINDOW_MAP_SIZE * MAP_WINDOW_MAP_SIZE);
+        _peepGrid.resize(MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL);
     }
     catch (const std::bad_alloc&)
     {
@@ -288,6 +308,9 @@ static void window_map_close(rct_window* w)
 {
     _mapImageData.clear();
     _mapImageData.shrink_to_fit();
+    _peepGrid.clear();
+    _peepGrid.shrink_to_fit();
+    _peepTiles.clear();
     if ((input_test_flag(INPUT_FLAG_TOOL_ACTIVE)) && gCurrentToolWidget.window_classification == w->classification
         && gCurrentToolWidget.window_number == w->number)
     {
@@ -390,6 +413,7 @@ static void window_map_mouseup(rct_window* w, rct_widgetindex widgetIndex)
 
                 w->selected_tab = widgetIndex;
                 w->list_information_type = 0;
+                _numLinesToRefresh = MAXIMUM_MAP_SIZE_TECHNICAL;
             }
     }
 }
@@ -449,8 +473,18 @@ static void window_map_update(rct_window* w)
         window_map_centre_on_view_point();
     }
 
-    for (int32_t i = 0; i < 16; i++)
+    // Tiles are drawn again as soon as they change. The map is also swept a line at a time, quickly after it has been
+    // reset and slowly otherwise, to catch any change made without invalidating the tile.
+    for (const auto& tileCoords : map_take_changed_tiles())
+        map_window_set_tile_pixel(w, tileCoords);
+
+    auto numLines = std::clamp<uint32_t>(_numLinesToRefresh, 1, 16);
+    for (uint32_t i = 0; i < numLines; i++)
         map_window_set_pixels(w);
+    _numLinesToRefresh -= std::min(numLines, _numLinesToRefresh);
+
+    if (w->selected_tab == PAGE_PEEPS)
+        window_map_update_peep_grid();
 
     w->Invalidate();
 
@@ -900,6 +934,8 @@ static void window_map_init_map()
 {
     std::fill(_mapImageData.begin(), _mapImageData.end(), PALETTE_INDEX_10);
     _currentLine = 0;
+    _numLinesToRefresh = MAXIMUM_MAP_SIZE_TECHNICAL;
+    map_take_changed_tiles();
 }
 
 /**
@@ -1045,26 +1081,22 @@ static MapCoordsXY window_map_transform_to_map_coords(CoordsXY c)
     return { -x + y + MAXIMUM_MAP_SIZE_TECHNICAL - 8, x + y - 8 };
 }
 
-static void DrawMapPeepPixel(Peep* peep, const uint8_t flashColour, rct_drawpixelinfo* dpi)
+static void AddMapPeep(Peep* peep, MapPeepKind kind, MapPeepKind flashingKind)
 {
     if (peep->x == LOCATION_NULL)
         return;
 
-    MapCoordsXY c = window_map_transform_to_map_coords({ peep->x, peep->y });
-    auto leftTop = ScreenCoordsXY{ c.x, c.y };
-    auto rightBottom = leftTop;
-    uint8_t colour = DefaultPeepMapColour;
-    if (sprite_get_flashing(peep))
+    auto tileCoords = TileCoordsXY(CoordsXY{ peep->x, peep->y });
+    if (tileCoords.x < 0 || tileCoords.y < 0 || tileCoords.x >= MAXIMUM_MAP_SIZE_TECHNICAL
+        || tileCoords.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    auto& tileKind = _peepGrid[tileCoords.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileCoords.x];
+    if (tileKind == MapPeepKind::None)
     {
-        colour = flashColour;
-        // If flashing then map peep pixel size is increased (by moving left top downwards)
-        if (flashColour != DefaultPeepMapColour)
-        {
-            leftTop.x--;
-        }
+        _peepTiles.push_back(tileCoords);
     }
-
-    gfx_fill_rect(dpi, { leftTop, rightBottom }, colour);
+    tileKind = std::max(tileKind, sprite_get_flashing(peep) ? flashingKind : kind);
 }
 
 static uint8_t MapGetGuestFlashColour()
@@ -1095,17 +1127,52 @@ static uint8_t MapGetStaffFlashColour()
  *
  *  rct2: 0x0068DADA
  */
-static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
+static void window_map_update_peep_grid()
 {
-    auto flashColour = MapGetGuestFlashColour();
+    for (const auto& tileCoords : _peepTiles)
+    {
+        _peepGrid[tileCoords.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileCoords.x] = MapPeepKind::None;
+    }
+    _peepTiles.clear();
+
     for (auto guest : EntityList<Guest>())
     {
-        DrawMapPeepPixel(guest, flashColour, dpi);
+        AddMapPeep(guest, MapPeepKind::Guest, MapPeepKind::FlashingGuest);
     }
-    flashColour = MapGetStaffFlashColour();
     for (auto staff : EntityList<Staff>())
     {
-        DrawMapPeepPixel(staff, flashColour, dpi);
+        AddMapPeep(staff, MapPeepKind::Staff, MapPeepKind::FlashingStaff);
+    }
+}
+
+static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
+{
+    auto guestFlashColour = MapGetGuestFlashColour();
+    auto staffFlashColour = MapGetStaffFlashColour();
+    for (const auto& tileCoords : _peepTiles)
+    {
+        uint8_t colour = DefaultPeepMapColour;
+        switch (_peepGrid[tileCoords.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileCoords.x])
+        {
+            case MapPeepKind::FlashingGuest:
+                colour = guestFlashColour;
+                break;
+            case MapPeepKind::FlashingStaff:
+                colour = staffFlashColour;
+                break;
+            default:
+                break;
+        }
+
+        MapCoordsXY c = window_map_transform_to_map_coords(tileCoords.ToCoordsXY());
+        auto leftTop = ScreenCoordsXY{ c.x, c.y };
+        auto rightBottom = leftTop;
+        // If flashing then map peep pixel size is increased (by moving left top downwards)
+        if (colour != DefaultPeepMapColour)
+        {
+            leftTop.x--;
+        }
+        gfx_fill_rect(dpi, { leftTop, rightBottom }, colour);
     }
 }
 
@@ -1512,6 +1579,18 @@ static uint16_t map_window_get_pixel_colour_ride(const CoordsXY& c)
     return colourB;
 }
 
+static uint16_t map_window_get_pixel_colour(rct_window* w, const CoordsXY& c)
+{
+    switch (w->selected_tab)
+    {
+        case PAGE_PEEPS:
+            return map_window_get_pixel_colour_peep(c);
+        case PAGE_RIDES:
+            return map_window_get_pixel_colour_ride(c);
+    }
+    return 0;
+}
+
 static void map_window_set_pixels(rct_window* w)
 {
     uint16_t colour = 0;
@@ -1552,15 +1631,7 @@ static void map_window_set_pixels(rct_window* w)
     {
         if (!map_is_edge({ x, y }))
         {
-            switch (w->selected_tab)
-            {
-                case PAGE_PEEPS:
-                    colour = map_window_get_pixel_colour_peep({ x, y });
-                    break;
-                case PAGE_RIDES:
-                    colour = map_window_get_pixel_colour_ride({ x, y });
-                    break;
-            }
+            colour = map_window_get_pixel_colour(w, { x, y });
             destination[0] = (colour >> 8) & 0xFF;
             destination[1] = colour;
         }
@@ -1576,6 +1647,43 @@ static void map_window_set_pixels(rct_window* w)
         _currentLine = 0;
 }
 
+/**
+ * Draws the pixels of a single tile, at the position map_window_set_pixels would draw it.
+ */
+static void map_window_set_tile_pixel(rct_window* w, const TileCoordsXY& tileCoords)
+{
+    auto coords = tileCoords.ToCoordsXY();
+    if (map_is_edge(coords))
+        return;
+
+    constexpr int32_t lastTile = MAXIMUM_MAP_SIZE_TECHNICAL - 1;
+    int32_t line = 0, i = 0;
+    switch (get_current_rotation())
+    {
+        case 0:
+            line = tileCoords.x;
+            i = tileCoords.y;
+            break;
+        case 1:
+            line = tileCoords.y;
+            i = lastTile - tileCoords.x;
+            break;
+        case 2:
+            line = lastTile - tileCoords.x;
+            i = lastTile - tileCoords.y;
+            break;
+        case 3:
+            line = lastTile - tileCoords.y;
+            i = tileCoords.x;
+            break;
+    }
+
+    auto colour = map_window_get_pixel_colour(w, coords);
+    auto destination = _mapImageData.data() + ((line + i) * MAP_WINDOW_MAP_SIZE) + (lastTile - line + i);
+    destination[0] = (colour >> 8) & 0xFF;
+    destination[1] = colour;
+}
+
 static CoordsXY map_window_screen_to_map(ScreenCoordsXY screenCoords)
 {
     screenCoords.x = ((screenCoords.x + 8) - MAXIMUM_MAP_SIZE_TECHNICAL) / 2;
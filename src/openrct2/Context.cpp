@@ -128,6 +128,7 @@ namespace OpenRCT2
         float _accumulator = 0.0f;
         float _timeScale = 1.0f;
         uint32_t _lastUpdateTime = 0;
+        uint32_t _lastContentChangeCheckTime = 0;
         bool _variableFrame = false;
 
         // If set, will end the OpenRCT2 game loop. Intentionally private to this module so that the flag can not be set back to
@@ -473,6 +474,13 @@ namespace OpenRCT2
             _scenarioRepository->Scan(_localisationService->GetCurrentLanguage());
             TitleSequenceManager::Scan();
 
+            if (gConfigGeneral.watch_content_directories)
+            {
+                _objectRepository->WatchFiles();
+                _trackDesignRepository->WatchFiles();
+                _scenarioRepository->WatchFiles();
+            }
+
             if (!gOpenRCT2Headless)
             {
                 Init();
@@ -1133,6 +1141,33 @@ namespace OpenRCT2
 #endif
             _stdInOutConsole.ProcessEvalQueue();
             _uiContext->Update();
+
+            if (gConfigGeneral.watch_content_directories && currentUpdateTime - _lastContentChangeCheckTime > 1000)
+            {
+                ProcessContentChanges();
+                _lastContentChangeCheckTime = currentUpdateTime;
+            }
+        }
+
+        /**
+         * Applies files that were added, modified or removed in the content directories to the repositories.
+         */
+        void ProcessContentChanges()
+        {
+            // These windows keep pointers and indices into the repositories, wait until they are closed. Objects are
+            // also held back while they are negotiated with a client or server, the changes stay queued until then.
+            if (window_find_by_class(WC_EDITOR_OBJECT_SELECTION) == nullptr && !network_is_transferring_objects())
+            {
+                _objectRepository->ProcessFileChanges();
+            }
+            if (window_find_by_class(WC_TRACK_DESIGN_LIST) == nullptr && window_find_by_class(WC_TRACK_DESIGN_PLACE) == nullptr)
+            {
+                _trackDesignRepository->ProcessFileChanges();
+            }
+            if (window_find_by_class(WC_SCENARIO_SELECT) == nullptr)
+            {
+                _scenarioRepository->ProcessFileChanges();
+            }
         }
 
         /**
@@ -50,11 +50,11 @@ static void ReplaceSelectedWaterPalette(const ObjectRepositoryItem* item);
 static void setup_track_manager_objects()
 {
     int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
     for (int32_t i = 0; i < numObjects; i++)
     {
         uint8_t* selectionFlags = &_objectSelectionFlags[i];
-        const ObjectRepositoryItem* item = &items[i];
+        const ObjectRepositoryItem* item = items[i];
         if (item->Type == ObjectType::Ride)
         {
             *selectionFlags |= OBJECT_SELECTION_FLAG_6;
@@ -78,12 +78,12 @@ static void setup_track_manager_objects()
 static void setup_track_designer_objects()
 {
     int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
     SelectDesignerObjects();
     for (int32_t i = 0; i < numObjects; i++)
     {
         uint8_t* selectionFlags = &_objectSelectionFlags[i];
-        const ObjectRepositoryItem* item = &items[i];
+        const ObjectRepositoryItem* item = items[i];
         if (item->Type == ObjectType::Ride)
         {
             *selectionFlags |= OBJECT_SELECTION_FLAG_6;
@@ -215,11 +215,11 @@ void setup_in_use_selection_flags()
     }
 
     int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
     for (int32_t i = 0; i < numObjects; i++)
     {
         uint8_t* selectionFlags = &_objectSelectionFlags[i];
-        const ObjectRepositoryItem* item = &items[i];
+        const ObjectRepositoryItem* item = items[i];
         *selectionFlags &= ~OBJECT_SELECTION_FLAG_IN_USE;
 
         ObjectType entryType;
@@ -254,10 +254,10 @@ void sub_6AB211()
         _numAvailableObjectsForType[objectType] = 0;
     }
 
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
     for (int32_t i = 0; i < numObjects; i++)
     {
-        ObjectType objectType = items[i].Type;
+        ObjectType objectType = items[i]->Type;
         _numAvailableObjectsForType[EnumValue(objectType)]++;
     }
 
@@ -350,7 +350,7 @@ void unload_unselected_objects()
     {
         if (!(_objectSelectionFlags[i] & OBJECT_SELECTION_FLAG_SELECTED))
         {
-            auto descriptor = ObjectEntryDescriptor(items[i]);
+            auto descriptor = ObjectEntryDescriptor(*items[i]);
             remove_selected_objects_from_research(descriptor);
             objectsToUnload.push_back(descriptor);
         }
@@ -429,10 +429,10 @@ void reset_selected_object_count_and_size()
     }
 
     int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
     for (int32_t i = 0; i < numObjects; i++)
     {
-        ObjectType objectType = items[i].Type;
+        ObjectType objectType = items[i]->Type;
         if (_objectSelectionFlags[i] & OBJECT_SELECTION_FLAG_SELECTED)
         {
             _numSelectedObjectsForType[EnumValue(objectType)]++;
@@ -487,10 +487,10 @@ bool window_editor_object_selection_select_object(uint8_t isMasterObject, int32_
     int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
     // Get repository item index
     int32_t index = -1;
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
     for (int32_t i = 0; i < numObjects; i++)
     {
-        if (&items[i] == item)
+        if (items[i] == item)
         {
             index = i;
         }
@@ -601,11 +601,11 @@ bool window_editor_object_selection_select_object(
 bool editor_check_object_group_at_least_one_selected(ObjectType checkObjectType)
 {
     auto numObjects = std::min(object_repository_get_items_count(), _objectSelectionFlags.size());
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
 
     for (size_t i = 0; i < numObjects; i++)
     {
-        auto objectType = items[i].Type;
+        auto objectType = items[i]->Type;
         if (checkObjectType == objectType && (_objectSelectionFlags[i] & OBJECT_SELECTION_FLAG_SELECTED))
         {
             return true;
@@ -620,7 +620,7 @@ bool editor_check_object_group_at_least_one_surface_selected(bool queue)
     const auto* items = object_repository_get_items();
     for (size_t i = 0; i < numObjects; i++)
     {
-        const auto& ori = items[i];
+        const auto& ori = *items[i];
         auto isQueue = (ori.FootpathSurfaceInfo.Flags & FOOTPATH_ENTRY_FLAG_IS_QUEUE) != 0;
         if (ori.Type == ObjectType::FootpathSurface && (_objectSelectionFlags[i] & OBJECT_SELECTION_FLAG_SELECTED)
             && queue == isQueue)
@@ -637,7 +637,7 @@ int32_t editor_remove_unused_objects()
     setup_in_use_selection_flags();
 
     int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
-    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectRepositoryItem* const* items = object_repository_get_items();
 
     int32_t numUnselectedObjects = 0;
     for (int32_t i = 0; i < numObjects; i++)
@@ -647,7 +647,7 @@ int32_t editor_remove_unused_objects()
             if (!(_objectSelectionFlags[i] & OBJECT_SELECTION_FLAG_IN_USE)
                 && !(_objectSelectionFlags[i] & OBJECT_SELECTION_FLAG_ALWAYS_REQUIRED))
             {
-                const ObjectRepositoryItem* item = &items[i];
+                const ObjectRepositoryItem* item = items[i];
                 ObjectType objectType = item->Type;
 
                 if (objectType >= ObjectType::SceneryGroup)
@@ -245,6 +245,10 @@ void GameState::Update()
 void GameState::UpdateLogic(LogicTimings* timings)
 {
     auto start_time = std::chrono::high_resolution_clock::now();
+#ifdef ENABLE_SCRIPTING
+    auto& scriptProfiler = GetContext()->GetScriptEngine().GetProfiler();
+    auto startPluginTime = scriptProfiler.GetTotalTime();
+#endif
 
     auto report_time = [timings, start_time](LogicTimePart part) {
         if (timings != nullptr)
@@ -383,6 +387,9 @@ void GameState::UpdateLogic(LogicTimings* timings)
 
     if (timings != nullptr)
     {
+#ifdef ENABLE_SCRIPTING
+        timings->PluginTime[timings->CurrentIdx] = scriptProfiler.GetTotalTime() - startPluginTime;
+#endif
         timings->CurrentIdx = (timings->CurrentIdx + 1) % LOGIC_UPDATE_MEASUREMENTS_COUNT;
     }
 }
@@ -57,6 +57,8 @@ namespace OpenRCT2
     struct LogicTimings
     {
         LogicTimingInfo TimingInfo;
+        // Time spent in plugin callbacks, which run during several of the parts above
+        std::array<std::chrono::duration<double>, LOGIC_UPDATE_MEASUREMENTS_COUNT> PluginTime{};
         size_t CurrentIdx{};
     };
 
@@ -0,0 +1,321 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GameStateRollback.h"
+
+#include "Context.h"
+#include "Date.h"
+#include "Game.h"
+#include "GameState.h"
+#include "OpenRCT2.h"
+#include "localisation/Date.h"
+#include "management/Award.h"
+#include "management/Finance.h"
+#include "management/Marketing.h"
+#include "management/NewsItem.h"
+#include "management/Research.h"
+#include "peep/Peep.h"
+#include "peep/RideUseSystem.h"
+#include "peep/Staff.h"
+#include "ride/Ride.h"
+#include "ride/RideRatings.h"
+#include "scenario/Scenario.h"
+#include "world/Banner.h"
+#include "world/Climate.h"
+#include "world/Entity.h"
+#include "world/EntityList.h"
+#include "world/Entrance.h"
+#include "world/Map.h"
+#include "world/MapAnimation.h"
+#include "world/Park.h"
+#include "world/Sprite.h"
+
+#include <cstring>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
+
+struct GlobalRegion
+{
+    void* Address;
+    size_t Size;
+};
+
+template<typename T> static GlobalRegion MakeGlobalRegion(T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable globals can be copied as raw memory");
+    return { &value, sizeof(T) };
+}
+
+/**
+ * Plain data globals that are updated by the simulation, these are copied as raw memory.
+ */
+static std::vector<GlobalRegion> GetGlobalRegions()
+{
+    return {
+        MakeGlobalRegion(gCurrentTicks),
+        MakeGlobalRegion(gScreenAge),
+        MakeGlobalRegion(gDateMonthTicks),
+        MakeGlobalRegion(gDateMonthsElapsed),
+        MakeGlobalRegion(gScenarioParkRatingWarningDays),
+        MakeGlobalRegion(gScenarioCompletedCompanyValue),
+        MakeGlobalRegion(gMapSize),
+        MakeGlobalRegion(gWidePathTileLoopPosition),
+        MakeGlobalRegion(gGrassSceneryTileLoopPosition),
+        MakeGlobalRegion(gClimateCurrent),
+        MakeGlobalRegion(gClimateNext),
+        MakeGlobalRegion(gClimateUpdateTimer),
+        MakeGlobalRegion(gCash),
+        MakeGlobalRegion(gBankLoan),
+        MakeGlobalRegion(gCurrentExpenditure),
+        MakeGlobalRegion(gCurrentProfit),
+        MakeGlobalRegion(gHistoricalProfit),
+        MakeGlobalRegion(gWeeklyProfitAverageDividend),
+        MakeGlobalRegion(gWeeklyProfitAverageDivisor),
+        MakeGlobalRegion(gCashHistory),
+        MakeGlobalRegion(gWeeklyProfitHistory),
+        MakeGlobalRegion(gParkValueHistory),
+        MakeGlobalRegion(gExpenditureTable),
+        MakeGlobalRegion(gParkFlags),
+        MakeGlobalRegion(gParkEntranceFee),
+        MakeGlobalRegion(gParkRating),
+        MakeGlobalRegion(gParkSize),
+        MakeGlobalRegion(gParkValue),
+        MakeGlobalRegion(gCompanyValue),
+        MakeGlobalRegion(gTotalAdmissions),
+        MakeGlobalRegion(gTotalIncomeFromAdmissions),
+        MakeGlobalRegion(gParkRatingCasualtyPenalty),
+        MakeGlobalRegion(gParkRatingHistory),
+        MakeGlobalRegion(gGuestsInParkHistory),
+        MakeGlobalRegion(gTotalRideValueForMoney),
+        MakeGlobalRegion(gGuestChangeModifier),
+        MakeGlobalRegion(gNumGuestsInPark),
+        MakeGlobalRegion(gNumGuestsInParkLastWeek),
+        MakeGlobalRegion(gNumGuestsHeadingForPark),
+        MakeGlobalRegion(gNextGuestNumber),
+        MakeGlobalRegion(gPeepWarningThrottle),
+        MakeGlobalRegion(gStaffPatrolAreas),
+        MakeGlobalRegion(gStaffModes),
+        MakeGlobalRegion(gCurrentAwards),
+        MakeGlobalRegion(gResearchProgress),
+        MakeGlobalRegion(gResearchProgressStage),
+        MakeGlobalRegion(gResearchExpectedMonth),
+        MakeGlobalRegion(gResearchExpectedDay),
+        MakeGlobalRegion(gRideRatingUpdateState),
+    };
+}
+
+struct GameStateRollbackSlot
+{
+    uint32_t Tick = InvalidTick;
+
+    std::unique_ptr<rct_sprite[]> Entities;
+    std::vector<std::pair<uint16_t, std::string>> PeepNames;
+    RideUse::RideHistory RideHistory;
+    RideUse::RideTypeHistory RideTypeHistory;
+
+    std::vector<TileElement> TileElements;
+    size_t NumTileElementsInUse{};
+    std::vector<Banner> Banners;
+    std::vector<Ride> Rides;
+    std::vector<MapAnimation> MapAnimations;
+    std::vector<CoordsXYZD> ParkEntrances;
+    std::vector<PeepSpawn> PeepSpawns;
+
+    std::vector<uint8_t> Globals;
+    Date GameDate;
+    random_engine_t::state_type ScenarioRandState{};
+    std::vector<MarketingCampaign> MarketingCampaigns;
+    News::ItemQueues NewsItems;
+    std::vector<ResearchItem> ResearchItemsInvented;
+    std::vector<ResearchItem> ResearchItemsUninvented;
+    std::optional<ResearchItem> ResearchLastItem;
+    std::optional<ResearchItem> ResearchNextItem;
+};
+
+struct GameStateRollback final : public IGameStateRollback
+{
+    GameStateRollback(size_t capacity)
+        : _globalRegions(GetGlobalRegions())
+        , _slots(std::max<size_t>(capacity, 1))
+    {
+        size_t globalsSize = 0;
+        for (const auto& region : _globalRegions)
+        {
+            globalsSize += region.Size;
+        }
+
+        for (auto& slot : _slots)
+        {
+            slot.Entities = std::make_unique<rct_sprite[]>(MAX_ENTITIES);
+            slot.PeepNames.reserve(MAX_ENTITIES);
+            slot.Globals.resize(globalsSize);
+        }
+    }
+
+    void Reset() override
+    {
+        for (auto& slot : _slots)
+        {
+            slot.Tick = InvalidTick;
+        }
+        _next = 0;
+    }
+
+    void Capture() override
+    {
+        // Capturing the same tick twice replaces the previous copy instead of taking up another slot.
+        auto* existing = FindSlot(gCurrentTicks);
+        auto& slot = existing != nullptr ? *existing : _slots[_next];
+        if (existing == nullptr)
+        {
+            _next = (_next + 1) % _slots.size();
+        }
+
+        slot.Tick = gCurrentTicks;
+
+        const auto* entities = GetEntityStorage();
+        std::copy(entities, entities + MAX_ENTITIES, slot.Entities.get());
+
+        // The names are owned by the live peeps, keep a copy of the text instead.
+        slot.PeepNames.clear();
+        CapturePeepNames<Guest>(slot);
+        CapturePeepNames<Staff>(slot);
+        slot.RideHistory = RideUse::GetHistory();
+        slot.RideTypeHistory = RideUse::GetTypeHistory();
+
+        const auto& tileElements = GetTileElements();
+        slot.TileElements.assign(tileElements.begin(), tileElements.end());
+        slot.NumTileElementsInUse = GetNumTileElementsInUse();
+        slot.Banners = GetBanners();
+        slot.Rides = GetRides();
+        slot.MapAnimations = GetMapAnimations();
+        slot.ParkEntrances = gParkEntrances;
+        slot.PeepSpawns = gPeepSpawns;
+
+        auto* dst = slot.Globals.data();
+        for (const auto& region : _globalRegions)
+        {
+            std::memcpy(dst, region.Address, region.Size);
+            dst += region.Size;
+        }
+        slot.GameDate = GetContext()->GetGameState()->GetDate();
+        slot.ScenarioRandState = scenario_rand_state();
+        slot.MarketingCampaigns = gMarketingCampaigns;
+        slot.NewsItems = gNewsItems;
+        slot.ResearchItemsInvented = gResearchItemsInvented;
+        slot.ResearchItemsUninvented = gResearchItemsUninvented;
+        slot.ResearchLastItem = gResearchLastItem;
+        slot.ResearchNextItem = gResearchNextItem;
+    }
+
+    bool HasState(uint32_t tick) const override
+    {
+        return FindSlot(tick) != nullptr;
+    }
+
+    bool Restore(uint32_t tick) override
+    {
+        auto* slot = FindSlot(tick);
+        if (slot == nullptr)
+        {
+            return false;
+        }
+
+        SetEntityStorage(slot->Entities.get());
+        for (const auto& [spriteIndex, name] : slot->PeepNames)
+        {
+            auto* peep = GetEntity<Peep>(spriteIndex);
+            if (peep != nullptr)
+            {
+                peep->SetName(name);
+            }
+        }
+        RideUse::GetHistory() = slot->RideHistory;
+        RideUse::GetTypeHistory() = slot->RideTypeHistory;
+
+        SetTileElements(slot->TileElements, slot->NumTileElementsInUse);
+        SetBanners(slot->Banners);
+        SetRides(slot->Rides);
+        SetMapAnimations(slot->MapAnimations);
+        gParkEntrances = slot->ParkEntrances;
+        gPeepSpawns = slot->PeepSpawns;
+
+        const auto* src = slot->Globals.data();
+        for (const auto& region : _globalRegions)
+        {
+            std::memcpy(region.Address, src, region.Size);
+            src += region.Size;
+        }
+        GetContext()->GetGameState()->GetDate() = slot->GameDate;
+        scenario_rand_seed(slot->ScenarioRandState.s0, slot->ScenarioRandState.s1);
+        gMarketingCampaigns = slot->MarketingCampaigns;
+        gNewsItems = slot->NewsItems;
+        gResearchItemsInvented = slot->ResearchItemsInvented;
+        gResearchItemsUninvented = slot->ResearchItemsUninvented;
+        gResearchLastItem = slot->ResearchLastItem;
+        gResearchNextItem = slot->ResearchNextItem;
+
+        // Everything captured after this point belongs to the discarded timeline.
+        for (auto& other : _slots)
+        {
+            if (other.Tick != InvalidTick && other.Tick > tick)
+            {
+                other.Tick = InvalidTick;
+            }
+        }
+        return true;
+    }
+
+private:
+    template<typename T> static void CapturePeepNames(GameStateRollbackSlot& slot)
+    {
+        for (auto* peep : EntityList<T>())
+        {
+            auto& copy = *static_cast<Peep*>(&slot.Entities[peep->sprite_index].base);
+            copy.Name = nullptr;
+            if (peep->Name != nullptr)
+            {
+                slot.PeepNames.emplace_back(peep->sprite_index, peep->Name);
+            }
+        }
+    }
+
+    const GameStateRollbackSlot* FindSlot(uint32_t tick) const
+    {
+        for (const auto& slot : _slots)
+        {
+            if (slot.Tick == tick)
+            {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    GameStateRollbackSlot* FindSlot(uint32_t tick)
+    {
+        return const_cast<GameStateRollbackSlot*>(std::as_const(*this).FindSlot(tick));
+    }
+
+    std::vector<GlobalRegion> _globalRegions;
+    std::vector<GameStateRollbackSlot> _slots;
+    size_t _next = 0;
+};
+
+std::unique_ptr<IGameStateRollback> CreateGameStateRollback(size_t capacity)
+{
+    return std::make_unique<GameStateRollback>(capacity);
+}
@@ -0,0 +1,49 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+
+#include <memory>
+
+/*
+ * Ring of full simulation state copies for client side prediction. Unlike IGameStateSnapshots nothing
+ * is serialised, the entity storage, tile elements, rides, banners, map animations and park globals are copied into
+ * buffers that are allocated once and reused, so capturing is cheap enough to do every tick.
+ * A client can capture before predicting its own game actions and restore once the server disagrees.
+ * Once the ring is full every capture overwrites the oldest state.
+ */
+struct IGameStateRollback
+{
+    virtual ~IGameStateRollback() = default;
+
+    /*
+     * Forgets all captured states, the buffers stay allocated.
+     */
+    virtual void Reset() = 0;
+
+    /*
+     * Copies the current simulation state into the ring and links it to the current tick.
+     */
+    virtual void Capture() = 0;
+
+    /*
+     * Returns true when a state for the given tick is still held by the ring.
+     */
+    virtual bool HasState(uint32_t tick) const = 0;
+
+    /*
+     * Replaces the simulation state with the one captured at the given tick. States captured
+     * after that tick are discarded. Returns false if the state is no longer available.
+     */
+    virtual bool Restore(uint32_t tick) = 0;
+};
+
+[[nodiscard]] std::unique_ptr<IGameStateRollback> CreateGameStateRollback(size_t capacity = 8);
@@ -10,15 +10,33 @@
 #include "ParkImporter.h"
 
 #include "Context.h"
+#include "core/Console.hpp"
+#include "core/File.h"
+#include "core/FileStream.h"
 #include "core/Path.hpp"
 #include "core/String.hpp"
 #include "object/ObjectManager.h"
 #include "object/ObjectRepository.h"
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace ParkImporter
 {
+    struct CachedMetadata
+    {
+        uint64_t Size{};
+        uint64_t LastModified{};
+        std::optional<ParkMetadata> Metadata;
+    };
+
+    // Enough for a few directories of saves, the whole cache is dropped when it is full
+    static constexpr size_t MAX_CACHED_METADATA = 2048;
+
+    static std::mutex _metadataCacheMutex;
+    static std::unordered_map<std::string, CachedMetadata> _metadataCache;
+
     std::unique_ptr<IParkImporter> Create(const std::string& hintPath)
     {
         std::unique_ptr<IParkImporter> parkImporter;
@@ -35,6 +53,56 @@ namespace ParkImporter
         return parkImporter;
     }
 
+    static std::optional<ParkMetadata> ReadMetadataFromFile(const std::string& path)
+    {
+        try
+        {
+            auto importer = Create(path);
+            auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
+            ParkMetadata metadata;
+            if (importer->LoadMetadata(&fs, ExtensionIsScenario(Path::GetExtension(path)), &metadata))
+            {
+                return metadata;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Unable to read metadata of %s: %s", path.c_str(), e.what());
+        }
+        return std::nullopt;
+    }
+
+    std::optional<ParkMetadata> ReadMetadata(const std::string& path)
+    {
+        auto size = File::GetSize(path);
+        auto lastModified = File::GetLastModified(path);
+        {
+            std::lock_guard<std::mutex> lock(_metadataCacheMutex);
+            auto it = _metadataCache.find(path);
+            if (it != _metadataCache.end() && it->second.Size == size && it->second.LastModified == lastModified)
+            {
+                return it->second.Metadata;
+            }
+        }
+
+        // Files that can not be read are remembered as well, so they are not tried again until they change
+        auto metadata = ReadMetadataFromFile(path);
+
+        std::lock_guard<std::mutex> lock(_metadataCacheMutex);
+        if (_metadataCache.size() >= MAX_CACHED_METADATA)
+        {
+            _metadataCache.clear();
+        }
+        _metadataCache[path] = { size, lastModified, metadata };
+        return metadata;
+    }
+
+    void ClearMetadataCache()
+    {
+        std::lock_guard<std::mutex> lock(_metadataCacheMutex);
+        _metadataCache.clear();
+    }
+
     bool ExtensionIsRCT1(const std::string& extension)
     {
         return String::Equals(extension, ".sc4", true) || String::Equals(extension, ".sv4", true);
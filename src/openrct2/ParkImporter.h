@@ -15,6 +15,7 @@
 #include "object/ObjectList.h"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -39,6 +40,23 @@ public:
     }
 };
 
+/**
+ * The parts of a scenario or saved game that are needed to list it, read without the map, entities or objects.
+ */
+struct ParkMetadata
+{
+    bool IsScenario{};
+    std::string Name;
+    std::string Details;
+    uint8_t Category{};
+    uint8_t ObjectiveType{};
+    uint8_t ObjectiveArg1{};
+    money32 ObjectiveArg2{};
+    int16_t ObjectiveArg3{};
+    uint32_t MonthsElapsed{};
+    uint32_t Day{};
+};
+
 /**
  * Interface to import scenarios and saved games.
  */
@@ -53,6 +71,12 @@ public:
     virtual ParkLoadResult LoadFromStream(
         OpenRCT2::IStream* stream, bool isScenario, bool skipObjectCheck = false, const utf8* path = String::Empty) abstract;
 
+    /**
+     * Only reads the header and the scenario information of the park. GetDetails can be used afterwards,
+     * Import can not.
+     */
+    virtual bool LoadMetadata(OpenRCT2::IStream* stream, bool isScenario, ParkMetadata* dst) abstract;
+
     virtual void Import() abstract;
     virtual bool GetDetails(scenario_index_entry* dst) abstract;
 };
@@ -63,6 +87,13 @@ namespace ParkImporter
     [[nodiscard]] std::unique_ptr<IParkImporter> CreateS4();
     [[nodiscard]] std::unique_ptr<IParkImporter> CreateS6(IObjectRepository& objectRepository);
 
+    /**
+     * Reads the metadata of the park at path. Results are kept by path and modification time, so listing the same
+     * directory again does not read any of the files that did not change.
+     */
+    [[nodiscard]] std::optional<ParkMetadata> ReadMetadata(const std::string& path);
+    void ClearMetadataCache();
+
     bool ExtensionIsRCT1(const std::string& extension);
     bool ExtensionIsScenario(const std::string& extension);
 } // namespace ParkImporter
@@ -85,8 +85,10 @@ private:
             case PATHID::CONFIG_SHORTCUTS:
                 return DIRBASE::CONFIG;
             case PATHID::CACHE_OBJECTS:
+            case PATHID::CACHE_OBJECT_DATA:
             case PATHID::CACHE_TRACKS:
             case PATHID::CACHE_SCENARIOS:
+            case PATHID::CACHE_PLUGINS:
                 return DIRBASE::CACHE;
             case PATHID::MP_DAT:
                 return DIRBASE::RCT1;
@@ -237,8 +239,10 @@ const char * PlatformEnvironment::FileNames[] =
     "hotkeys.dat",          // CONFIG_SHORTCUTS_LEGACY
     "shortcuts.json",       // CONFIG_SHORTCUTS
     "objects.idx",          // CACHE_OBJECTS
+    "objects.bin",          // CACHE_OBJECT_DATA
     "tracks.idx",           // CACHE_TRACKS
     "scenarios.idx",        // CACHE_SCENARIOS
+    "plugins.bin",          // CACHE_PLUGINS
     "Data" PATH_SEPARATOR "mp.dat", // MP_DAT
     "groups.json",          // NETWORK_GROUPS
     "servers.cfg",          // NETWORK_SERVERS
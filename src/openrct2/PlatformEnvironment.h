@@ -58,8 +58,10 @@ namespace OpenRCT2
         CONFIG_SHORTCUTS_LEGACY, // Old keyboard shortcuts (hotkeys.cfg)
         CONFIG_SHORTCUTS,        // Shortcut bindings (shortcuts.json)
         CACHE_OBJECTS,           // Object repository cache (objects.idx).
+        CACHE_OBJECT_DATA,       // Pre-read object data shared between processes (objects.bin).
         CACHE_TRACKS,            // Track repository cache (tracks.idx).
         CACHE_SCENARIOS,         // Scenario repository cache (scenarios.idx).
+        CACHE_PLUGINS,           // Compiled plugin bytecode (plugins.bin).
         MP_DAT,                  // Mega Park data, Steam RCT1 only (\RCTdeluxe_install\Data\mp.dat)
         NETWORK_GROUPS,          // Server groups with permissions (groups.json).
         NETWORK_SERVERS,         // Saved servers (servers.cfg).
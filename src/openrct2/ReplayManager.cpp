@@ -11,6 +11,7 @@
 
 #include "Context.h"
 #include "Game.h"
+#include "GameState.h"
 #include "GameStateSnapshots.h"
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
@@ -24,6 +25,7 @@
 #include "actions/TrackPlaceAction.h"
 #include "config/Config.h"
 #include "core/DataSerialiser.h"
+#include "core/FileStream.h"
 #include "core/Path.hpp"
 #include "management/NewsItem.h"
 #include "object/ObjectManager.h"
@@ -34,7 +36,9 @@
 #include "world/Sprite.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <chrono>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -77,6 +81,28 @@ namespace OpenRCT2
         OpenRCT2::MemoryStream data;
     };
 
+    // Full park state at a given tick, used to start playback from somewhere other than the beginning.
+    struct ReplayKeyframe
+    {
+        uint32_t tick = 0;
+        // Position of the block relative to the start of the block section of the file.
+        uint64_t offset = 0;
+        uint64_t uncompressedSize = 0;
+        // Compressed block, only held in memory while recording.
+        OpenRCT2::MemoryStream data;
+        // Pending while the block is compressed off the game thread, an empty result means compression failed.
+        std::future<OpenRCT2::MemoryStream> compressing;
+    };
+
+    // Commands and checksums from a tick up to the start of the next chunk, stored as a block after the body so playback
+    // only holds the chunk it is in. Chunks start at the beginning of the replay and at every keyframe.
+    struct ReplayChunk
+    {
+        uint32_t tick = 0;
+        // Position of the block relative to the start of the block section of the file.
+        uint64_t offset = 0;
+    };
+
     struct ReplayRecordData
     {
         uint32_t magic;
@@ -91,16 +117,29 @@ namespace OpenRCT2
         uint32_t tickStart;    // First tick of replay.
         uint32_t tickEnd;      // Last tick of replay.
         std::multiset<ReplayCommand> commands;
+        std::multiset<ReplayCommand>::iterator nextCommand;
         std::vector<std::pair<uint32_t, rct_sprite_checksum>> checksums;
         uint32_t checksumIndex;
+        uint32_t numCommands;  // Commands in the whole replay, playback only holds those of one chunk.
+        uint32_t numChecksums; // Checksums in the whole replay.
         OpenRCT2::MemoryStream gameStateSnapshots;
+        std::vector<ReplayKeyframe> keyframes;
+        std::vector<ReplayChunk> chunks;
+        size_t chunkIndex;          // Chunk held in commands and checksums during playback.
+        uint64_t blockSectionStart; // File position of the first chunk or keyframe block.
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 4;
+        static constexpr uint16_t ReplayVersion = 6;
+        static constexpr uint16_t ReplayVersionNoChunks = 5;
+        static constexpr uint16_t ReplayVersionNoKeyframes = 4;
         static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
         static constexpr int ReplayCompressionLevel = 9;
+        // Keyframes are captured while the game is running, favour speed over size.
+        static constexpr int KeyframeCompressionLevel = 1;
+        // Roughly four minutes of game time, bounds how many ticks a seek has to simulate.
+        static constexpr uint32_t KeyframeTicksDelta = 10000;
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
 
@@ -166,6 +205,13 @@ namespace OpenRCT2
                 _nextChecksumTick = gCurrentTicks + ChecksumTicksDelta();
             }
 
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && gCurrentTicks == _nextKeyframeTick)
+            {
+                AddKeyframe();
+
+                _nextKeyframeTick = gCurrentTicks + KeyframeTicksDelta;
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (gCurrentTicks >= _currentRecording->tickEnd)
@@ -176,6 +222,12 @@ namespace OpenRCT2
             }
             else if (_mode == ReplayMode::PLAYING)
             {
+                if (!AdvanceChunk())
+                {
+                    StopPlayback();
+                    return;
+                }
+
 #ifndef DISABLE_NETWORK
                 // If the network is disabled we will only get a dummy hash which will cause
                 // false positives during replay.
@@ -192,10 +244,18 @@ namespace OpenRCT2
             }
             else if (_mode == ReplayMode::NORMALISATION)
             {
+                if (!AdvanceChunk())
+                {
+                    StopPlayback();
+                    StopRecording(true);
+                    return;
+                }
+
                 ReplayCommands();
 
                 // If we run out of commands we can just stop
-                if (_currentReplay->commands.empty())
+                if (_currentReplay->nextCommand == _currentReplay->commands.end()
+                    && _currentReplay->chunkIndex + 1 >= _currentReplay->chunks.size())
                 {
                     StopPlayback();
                     StopRecording();
@@ -218,6 +278,81 @@ namespace OpenRCT2
             snapshots->SerialiseSnapshot(snapshot, snapShotDs);
         }
 
+        void CaptureParkState(MemoryStream& parkData, MemoryStream& parkParams, MemoryStream& cheatData)
+        {
+            auto& objManager = GetContext()->GetObjectManager();
+            auto objects = objManager.GetPackableObjects();
+
+            auto s6exporter = std::make_unique<S6Exporter>();
+            s6exporter->ExportObjectsList = objects;
+            s6exporter->Export();
+            s6exporter->SaveGame(&parkData);
+
+            DataSerialiser parkParamsDs(true, parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            DataSerialiser cheatDataDs(true, cheatData);
+            SerialiseCheats(cheatDataDs);
+        }
+
+        void AddKeyframe()
+        {
+            MemoryStream parkData;
+            MemoryStream parkParams;
+            MemoryStream cheatData;
+            MemoryStream snapshot;
+            CaptureParkState(parkData, parkParams, cheatData);
+            TakeGameStateSnapshot(snapshot);
+
+            uint32_t tick = gCurrentTicks;
+            MemoryStream block;
+            DataSerialiser keyframeDs(true, block);
+            keyframeDs << tick;
+            keyframeDs << parkData;
+            keyframeDs << parkParams;
+            keyframeDs << cheatData;
+            keyframeDs << snapshot;
+
+            ReplayKeyframe keyframe;
+            keyframe.tick = tick;
+            keyframe.uncompressedSize = block.GetLength();
+            // The export above has to see the game state, but compressing a whole park is slow enough to stall
+            // the game, so that part is left to a worker and collected when the recording is written.
+            keyframe.compressing = std::async(std::launch::async, [block = std::move(block)]() {
+                MemoryStream compressed;
+                if (!Compress(block, compressed, KeyframeCompressionLevel))
+                {
+                    return MemoryStream();
+                }
+                return compressed;
+            });
+            _currentRecording->keyframes.push_back(std::move(keyframe));
+        }
+
+        /**
+         * Waits for the keyframes still being compressed, dropping those that could not be.
+         */
+        void FinishKeyframes(ReplayRecordData& data)
+        {
+            for (auto& keyframe : data.keyframes)
+            {
+                if (keyframe.compressing.valid())
+                {
+                    keyframe.data = keyframe.compressing.get();
+                }
+            }
+
+            auto it = std::remove_if(data.keyframes.begin(), data.keyframes.end(), [](const ReplayKeyframe& keyframe) {
+                if (keyframe.data.GetLength() == 0)
+                {
+                    log_warning("Unable to compress replay keyframe at tick %u.", keyframe.tick);
+                    return true;
+                }
+                return false;
+            });
+            data.keyframes.erase(it, data.keyframes.end());
+        }
+
         virtual bool StartRecording(
             const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/, RecordType rt /*= RecordType::NORMAL*/) override
         {
@@ -242,23 +377,10 @@ namespace OpenRCT2
 
             replayData->filePath = name;
 
-            auto context = GetContext();
-            auto& objManager = context->GetObjectManager();
-            auto objects = objManager.GetPackableObjects();
-
-            auto s6exporter = std::make_unique<S6Exporter>();
-            s6exporter->ExportObjectsList = objects;
-            s6exporter->Export();
-            s6exporter->SaveGame(&replayData->parkData);
+            CaptureParkState(replayData->parkData, replayData->parkParams, replayData->cheatData);
 
             replayData->timeRecorded = std::chrono::seconds(std::time(nullptr)).count();
 
-            DataSerialiser parkParamsDs(true, replayData->parkParams);
-            SerialiseParkParameters(parkParamsDs);
-
-            DataSerialiser cheatDataDs(true, replayData->cheatData);
-            SerialiseCheats(cheatDataDs);
-
             TakeGameStateSnapshot(replayData->gameStateSnapshots);
 
             if (_mode != ReplayMode::NORMALISATION)
@@ -267,6 +389,7 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = gCurrentTicks + 1;
+            _nextKeyframeTick = gCurrentTicks + KeyframeTicksDelta;
 
             return true;
         }
@@ -292,23 +415,39 @@ namespace OpenRCT2
 
             TakeGameStateSnapshot(_currentRecording->gameStateSnapshots);
 
+            // Chunk and keyframe blocks are stored after the body, the body holds their index.
+            FinishKeyframes(*_currentRecording);
+            std::vector<std::pair<uint64_t, MemoryStream>> chunkBlocks;
+            if (!WriteChunks(*_currentRecording, chunkBlocks))
+            {
+                log_error("Unable to compress replay commands.");
+                if (_mode != ReplayMode::NORMALISATION)
+                    _mode = ReplayMode::NONE;
+
+                _currentRecording.reset();
+                return false;
+            }
+
+            uint64_t blockOffset = 0;
+            for (size_t i = 0; i < chunkBlocks.size(); i++)
+            {
+                _currentRecording->chunks[i].offset = blockOffset;
+                blockOffset += sizeof(uint64_t) + sizeof(uint32_t) + chunkBlocks[i].second.GetLength();
+            }
+            for (auto& keyframe : _currentRecording->keyframes)
+            {
+                keyframe.offset = blockOffset;
+                blockOffset += sizeof(keyframe.uncompressedSize) + sizeof(uint32_t) + keyframe.data.GetLength();
+            }
+
             // Serialise Body.
             DataSerialiser recSerialiser(true);
             Serialise(recSerialiser, *_currentRecording);
 
             const auto& stream = recSerialiser.GetStream();
-            unsigned long streamLength = static_cast<unsigned long>(stream.GetLength());
-            unsigned long compressLength = compressBound(streamLength);
 
-            MemoryStream data(compressLength);
-
-            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, streamLength, data };
-
-            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
-            compress2(
-                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(stream.GetData()), stream.GetLength(),
-                ReplayCompressionLevel);
-            file.data.Write(compressBuf.get(), compressLength);
+            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, stream.GetLength(), {} };
+            Compress(stream, file.data, ReplayCompressionLevel);
 
             DataSerialiser fileSerialiser(true);
             fileSerialiser << file.magic;
@@ -316,6 +455,17 @@ namespace OpenRCT2
             fileSerialiser << file.uncompressedSize;
             fileSerialiser << file.data;
 
+            for (auto& chunkBlock : chunkBlocks)
+            {
+                fileSerialiser << chunkBlock.first;
+                fileSerialiser << chunkBlock.second;
+            }
+            for (auto& keyframe : _currentRecording->keyframes)
+            {
+                fileSerialiser << keyframe.uncompressedSize;
+                fileSerialiser << keyframe.data;
+            }
+
             bool result = false;
 
             const std::string& outFile = _currentRecording->filePath;
@@ -369,8 +519,17 @@ namespace OpenRCT2
                 info.Ticks = gCurrentTicks - data->tickStart;
             else if (_mode == ReplayMode::PLAYING)
                 info.Ticks = data->tickEnd - data->tickStart;
-            info.NumCommands = static_cast<uint32_t>(data->commands.size());
-            info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
+            if (_mode == ReplayMode::PLAYING)
+            {
+                info.NumCommands = data->numCommands;
+                info.NumChecksums = data->numChecksums;
+            }
+            else
+            {
+                info.NumCommands = static_cast<uint32_t>(data->commands.size());
+                info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
+            }
+            info.NumKeyframes = static_cast<uint32_t>(data->keyframes.size());
 
             return true;
         }
@@ -427,6 +586,12 @@ namespace OpenRCT2
                 return false;
             }
 
+            if (!replayData->chunks.empty() && !LoadChunk(*replayData, 0))
+            {
+                log_error("Unable to read replay commands.");
+                return false;
+            }
+
             if (!LoadReplayDataMap(*replayData))
             {
                 log_error("Unable to load map.");
@@ -438,7 +603,9 @@ namespace OpenRCT2
             LoadAndCompareSnapshot(replayData->gameStateSnapshots);
 
             _currentReplay = std::move(replayData);
+            _currentReplay->nextCommand = _currentReplay->commands.begin();
             _currentReplay->checksumIndex = 0;
+            _currentReplay->chunkIndex = 0;
             _faultyChecksumIndex = -1;
 
             // Make sure game is not paused.
@@ -450,6 +617,69 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual bool SeekPlayback(uint32_t replayTick) override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                return false;
+
+            auto& replay = *_currentReplay;
+            const uint32_t targetTick = replay.tickStart + std::min(replayTick, replay.tickEnd - replay.tickStart);
+
+            // Closest keyframe at or before the target, the initial park serves as one at the start of the replay.
+            const ReplayKeyframe* keyframe = nullptr;
+            for (const auto& candidate : replay.keyframes)
+            {
+                if (candidate.tick > targetTick)
+                    break;
+                keyframe = &candidate;
+            }
+            const uint32_t keyframeTick = keyframe != nullptr ? keyframe->tick : replay.tickStart;
+
+            // Simulating forward from the current tick is cheaper unless there is a keyframe in between.
+            if (targetTick < gCurrentTicks || keyframeTick > gCurrentTicks)
+            {
+                bool loaded = keyframe != nullptr ? LoadKeyframe(replay, *keyframe) : LoadReplayDataMap(replay);
+                if (!loaded)
+                {
+                    log_error("Unable to load replay state for tick %u.", keyframeTick);
+                    return false;
+                }
+                gCurrentTicks = keyframeTick;
+
+                // Chunks start at keyframes, only the one the keyframe is in has to be read.
+                if (!replay.chunks.empty())
+                {
+                    size_t chunkIndex = 0;
+                    while (chunkIndex + 1 < replay.chunks.size() && replay.chunks[chunkIndex + 1].tick <= keyframeTick)
+                        chunkIndex++;
+
+                    if (!LoadChunk(replay, chunkIndex))
+                    {
+                        log_error("Unable to load replay commands for tick %u.", keyframeTick);
+                        return false;
+                    }
+                }
+
+                replay.nextCommand = std::find_if(
+                    replay.commands.begin(), replay.commands.end(),
+                    [keyframeTick](const auto& command) { return command.tick >= keyframeTick; });
+                replay.checksumIndex = static_cast<uint32_t>(std::distance(
+                    replay.checksums.begin(),
+                    std::find_if(replay.checksums.begin(), replay.checksums.end(), [keyframeTick](const auto& checksum) {
+                        return checksum.first >= keyframeTick;
+                    })));
+                _faultyChecksumIndex = -1;
+            }
+
+            auto* gameState = GetContext()->GetGameState();
+            while (gCurrentTicks < targetTick && _mode == ReplayMode::PLAYING)
+            {
+                gameState->UpdateLogic();
+            }
+
+            return _mode == ReplayMode::PLAYING;
+        }
+
         virtual bool IsPlaybackStateMismatching() const override
         {
             return _faultyChecksumIndex != -1;
@@ -518,6 +748,8 @@ namespace OpenRCT2
             try
             {
                 data.parkData.SetPosition(0);
+                data.parkParams.SetPosition(0);
+                data.cheatData.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
@@ -551,59 +783,215 @@ namespace OpenRCT2
             return true;
         }
 
-        bool ReadReplayFromFile(const std::string& file, MemoryStream& stream)
+        bool LoadKeyframe(ReplayRecordData& data, const ReplayKeyframe& keyframe)
         {
-            FILE* fp = fopen(file.c_str(), "rb");
-            if (fp == nullptr)
+            ReplayRecordData keyframeData;
+            MemoryStream snapshot;
+            try
+            {
+                // Only the requested keyframe is read from disk.
+                auto fs = FileStream(data.filePath, FILE_MODE_OPEN);
+                fs.SetPosition(data.blockSectionStart + keyframe.offset);
+
+                MemoryStream stream;
+                if (!ReadCompressedBlock(fs, stream))
+                    return false;
+
+                stream.SetPosition(0);
+                DataSerialiser keyframeDs(false, stream);
+                uint32_t tick = 0;
+                keyframeDs << tick;
+                if (tick != keyframe.tick)
+                {
+                    log_error("Replay keyframe index does not match, expected tick %u, got %u", keyframe.tick, tick);
+                    return false;
+                }
+                keyframeDs << keyframeData.parkData;
+                keyframeDs << keyframeData.parkParams;
+                keyframeDs << keyframeData.cheatData;
+                keyframeDs << snapshot;
+            }
+            catch (const std::exception& ex)
+            {
+                log_error("Unable to read replay keyframe: %s", ex.what());
                 return false;
+            }
 
-            char buffer[128];
-            while (feof(fp) == 0)
+            if (!LoadReplayDataMap(keyframeData))
+                return false;
+
+            snapshot.SetPosition(0);
+            LoadAndCompareSnapshot(snapshot);
+            return true;
+        }
+
+        bool LoadChunk(ReplayRecordData& data, size_t index)
+        {
+            data.commands.clear();
+            data.checksums.clear();
+            try
             {
-                size_t numBytesRead = fread(buffer, 1, 128, fp);
-                if (numBytesRead == 0)
-                    break;
-                stream.Write(buffer, numBytesRead);
+                auto fs = FileStream(data.filePath, FILE_MODE_OPEN);
+                fs.SetPosition(data.blockSectionStart + data.chunks[index].offset);
+
+                MemoryStream stream;
+                if (!ReadCompressedBlock(fs, stream))
+                    return false;
+
+                stream.SetPosition(0);
+                DataSerialiser chunkDs(false, stream);
+                SerialiseCommands(chunkDs, data.commands, data.checksums);
+            }
+            catch (const std::exception& ex)
+            {
+                log_error("Unable to read replay chunk: %s", ex.what());
+                return false;
             }
 
-            fclose(fp);
+            data.chunkIndex = index;
+            data.nextCommand = data.commands.begin();
+            data.checksumIndex = 0;
             return true;
         }
 
         /**
-         * Returns true if decompression was not needed or succeeded
-         * @param stream
-         * @return
+         * Reads the next chunk once playback has reached it. Normalisation replays commands regardless of their tick, so
+         * it moves on when the current chunk has run out of commands.
          */
-        bool TryDecompress(MemoryStream& stream)
+        bool AdvanceChunk()
         {
-            ReplayRecordFile recFile;
-            stream.SetPosition(0);
-            DataSerialiser fileSerializer(false, stream);
-            fileSerializer << recFile.magic;
-            fileSerializer << recFile.version;
-
-            if (recFile.version >= 2)
+            auto& replay = *_currentReplay;
+            while (replay.chunkIndex + 1 < replay.chunks.size())
             {
-                fileSerializer << recFile.uncompressedSize;
-                fileSerializer << recFile.data;
+                bool reached = _mode == ReplayMode::NORMALISATION ? replay.nextCommand == replay.commands.end()
+                                                                  : gCurrentTicks >= replay.chunks[replay.chunkIndex + 1].tick;
+                if (!reached)
+                    break;
 
-                auto buff = std::make_unique<unsigned char[]>(recFile.uncompressedSize);
-                unsigned long outSize = recFile.uncompressedSize;
-                uncompress(
-                    static_cast<unsigned char*>(buff.get()), &outSize,
-                    static_cast<const unsigned char*>(recFile.data.GetData()), recFile.data.GetLength());
-                if (outSize != recFile.uncompressedSize)
+                if (!LoadChunk(replay, replay.chunkIndex + 1))
                 {
+                    log_error("Unable to read replay commands for tick %u.", gCurrentTicks);
                     return false;
                 }
-                stream.SetPosition(0);
-                stream.Write(buff.get(), outSize);
             }
+            return true;
+        }
+
+        /**
+         * Splits the recorded commands and checksums into chunks starting at the beginning of the recording and at each
+         * keyframe, and compresses them. The commands are moved out of the recording.
+         */
+        bool WriteChunks(ReplayRecordData& data, std::vector<std::pair<uint64_t, MemoryStream>>& blocks)
+        {
+            data.numCommands = static_cast<uint32_t>(data.commands.size());
+            data.numChecksums = static_cast<uint32_t>(data.checksums.size());
+
+            data.chunks.clear();
+            data.chunks.push_back({ data.tickStart, 0 });
+            for (const auto& keyframe : data.keyframes)
+            {
+                data.chunks.push_back({ keyframe.tick, 0 });
+            }
+
+            auto checksumIt = data.checksums.begin();
+            for (size_t i = 0; i < data.chunks.size(); i++)
+            {
+                bool isLast = i + 1 == data.chunks.size();
+                uint32_t endTick = isLast ? 0 : data.chunks[i + 1].tick;
+
+                std::multiset<ReplayCommand> commands;
+                while (!data.commands.empty() && (isLast || data.commands.begin()->tick < endTick))
+                {
+                    commands.insert(data.commands.extract(data.commands.begin()));
+                }
+
+                auto checksumEnd = checksumIt;
+                while (checksumEnd != data.checksums.end() && (isLast || checksumEnd->first < endTick))
+                {
+                    checksumEnd++;
+                }
+                std::vector<std::pair<uint32_t, rct_sprite_checksum>> checksums(checksumIt, checksumEnd);
+                checksumIt = checksumEnd;
+
+                DataSerialiser chunkDs(true);
+                SerialiseCommands(chunkDs, commands, checksums);
+
+                const auto& stream = chunkDs.GetStream();
+                MemoryStream compressed;
+                if (!Compress(stream, compressed, ReplayCompressionLevel))
+                    return false;
+
+                blocks.emplace_back(stream.GetLength(), std::move(compressed));
+            }
+            return true;
+        }
 
+        static bool Compress(const IStream& input, MemoryStream& output, int level)
+        {
+            unsigned long compressLength = compressBound(static_cast<unsigned long>(input.GetLength()));
+
+            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
+            int result = compress2(
+                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(input.GetData()), input.GetLength(),
+                level);
+            if (result != Z_OK)
+                return false;
+
+            output.Write(compressBuf.get(), compressLength);
+            return true;
+        }
+
+        /**
+         * Reads a block written as uncompressed size followed by the compressed data and
+         * decompresses it into the given stream.
+         */
+        static bool ReadCompressedBlock(IStream& input, MemoryStream& output)
+        {
+            uint64_t uncompressedSize = 0;
+            MemoryStream compressed;
+
+            DataSerialiser blockSerialiser(false, input);
+            blockSerialiser << uncompressedSize;
+            blockSerialiser << compressed;
+
+            auto buff = std::make_unique<unsigned char[]>(uncompressedSize);
+            unsigned long outSize = static_cast<unsigned long>(uncompressedSize);
+            int result = uncompress(
+                static_cast<unsigned char*>(buff.get()), &outSize, static_cast<const unsigned char*>(compressed.GetData()),
+                compressed.GetLength());
+            if (result != Z_OK || outSize != uncompressedSize)
+            {
+                log_error("Unable to decompress replay block, error %d", result);
+                return false;
+            }
+            output.Write(buff.get(), outSize);
             return true;
         }
 
+        /**
+         * Reads the replay body from the file, leaving the stream at the start of the block section.
+         */
+        bool ReadReplayBody(IStream& input, MemoryStream& stream)
+        {
+            ReplayRecordFile recFile;
+            DataSerialiser fileSerializer(false, input);
+            fileSerializer << recFile.magic;
+            fileSerializer << recFile.version;
+
+            if (recFile.version < 2)
+            {
+                // Uncompressed, the whole file is the body.
+                input.SetPosition(0);
+                auto length = input.GetLength();
+                auto buff = std::make_unique<uint8_t[]>(length);
+                input.Read(buff.get(), length);
+                stream.Write(buff.get(), length);
+                return true;
+            }
+
+            return ReadCompressedBlock(input, stream);
+        }
+
         bool ReadReplayData(const std::string& file, ReplayRecordData& data)
         {
             MemoryStream stream;
@@ -617,23 +1005,30 @@ namespace OpenRCT2
             std::string outPath = GetContext()->GetPlatformEnvironment()->GetDirectoryPath(DIRBASE::USER, DIRID::REPLAY);
             std::string outFile = Path::Combine(outPath, fileName);
 
+            // Chunks and keyframes are read on demand, only the body is loaded here.
             bool loaded = false;
-            if (ReadReplayFromFile(outFile, stream))
-            {
-                data.filePath = outFile;
-                loaded = true;
-            }
-            else if (ReadReplayFromFile(file, stream))
+            for (const auto& path : { outFile, file })
             {
-                data.filePath = file;
-                loaded = true;
+                try
+                {
+                    auto fs = FileStream(path, FILE_MODE_OPEN);
+                    if (!ReadReplayBody(fs, stream))
+                        return false;
+
+                    data.filePath = path;
+                    data.blockSectionStart = fs.GetPosition();
+                    loaded = true;
+                    break;
+                }
+                catch (const std::exception&)
+                {
+                    // Try the next location.
+                    stream = MemoryStream();
+                }
             }
             if (!loaded)
                 return false;
 
-            if (!TryDecompress(stream))
-                return false;
-
             stream.SetPosition(0);
             DataSerialiser serialiser(false, stream);
             if (!Serialise(serialiser, data))
@@ -708,9 +1103,50 @@ namespace OpenRCT2
             return true;
         }
 
+        void SerialiseCommands(
+            DataSerialiser& serialiser, std::multiset<ReplayCommand>& commands,
+            std::vector<std::pair<uint32_t, rct_sprite_checksum>>& checksums)
+        {
+            uint32_t countCommands = static_cast<uint32_t>(commands.size());
+            serialiser << countCommands;
+
+            if (serialiser.IsSaving())
+            {
+                for (auto& command : commands)
+                {
+                    SerialiseCommand(serialiser, const_cast<ReplayCommand&>(command));
+                }
+            }
+            else
+            {
+                for (uint32_t i = 0; i < countCommands; i++)
+                {
+                    ReplayCommand command = {};
+                    SerialiseCommand(serialiser, command);
+
+                    commands.emplace(std::move(command));
+                }
+            }
+
+            uint32_t countChecksums = static_cast<uint32_t>(checksums.size());
+            serialiser << countChecksums;
+
+            if (serialiser.IsLoading())
+            {
+                checksums.resize(countChecksums);
+            }
+
+            for (uint32_t i = 0; i < countChecksums; i++)
+            {
+                serialiser << checksums[i].first;
+                serialiser << checksums[i].second.raw;
+            }
+        }
+
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            return data.version == ReplayVersion || data.version == ReplayVersionNoChunks
+                || data.version == ReplayVersionNoKeyframes;
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -747,42 +1183,53 @@ namespace OpenRCT2
             serialiser << data.tickStart;
             serialiser << data.tickEnd;
 
-            uint32_t countCommands = static_cast<uint32_t>(data.commands.size());
-            serialiser << countCommands;
-
-            if (serialiser.IsSaving())
+            if (data.version <= ReplayVersionNoChunks)
             {
-                for (auto& command : data.commands)
-                {
-                    SerialiseCommand(serialiser, const_cast<ReplayCommand&>(command));
-                }
+                SerialiseCommands(serialiser, data.commands, data.checksums);
+                data.numCommands = static_cast<uint32_t>(data.commands.size());
+                data.numChecksums = static_cast<uint32_t>(data.checksums.size());
             }
             else
             {
-                for (uint32_t i = 0; i < countCommands; i++)
-                {
-                    ReplayCommand command = {};
-                    SerialiseCommand(serialiser, command);
-
-                    data.commands.emplace(std::move(command));
-                }
+                serialiser << data.numCommands;
+                serialiser << data.numChecksums;
             }
 
-            uint32_t countChecksums = static_cast<uint32_t>(data.checksums.size());
-            serialiser << countChecksums;
+            serialiser << data.gameStateSnapshots;
 
-            if (serialiser.IsLoading())
+            if (data.version > ReplayVersionNoKeyframes)
             {
-                data.checksums.resize(countChecksums);
+                uint32_t countKeyframes = static_cast<uint32_t>(data.keyframes.size());
+                serialiser << countKeyframes;
+
+                if (serialiser.IsLoading())
+                {
+                    data.keyframes.resize(countKeyframes);
+                }
+
+                for (auto& keyframe : data.keyframes)
+                {
+                    serialiser << keyframe.tick;
+                    serialiser << keyframe.offset;
+                }
             }
 
-            for (uint32_t i = 0; i < countChecksums; i++)
+            if (data.version > ReplayVersionNoChunks)
             {
-                serialiser << data.checksums[i].first;
-                serialiser << data.checksums[i].second.raw;
-            }
+                uint32_t countChunks = static_cast<uint32_t>(data.chunks.size());
+                serialiser << countChunks;
 
-            serialiser << data.gameStateSnapshots;
+                if (serialiser.IsLoading())
+                {
+                    data.chunks.resize(countChunks);
+                }
+
+                for (auto& chunk : data.chunks)
+                {
+                    serialiser << chunk.tick;
+                    serialiser << chunk.offset;
+                }
+            }
             return true;
         }
 
@@ -825,10 +1272,11 @@ namespace OpenRCT2
         void ReplayCommands()
         {
             auto& replayQueue = _currentReplay->commands;
+            auto& nextCommand = _currentReplay->nextCommand;
 
-            while (replayQueue.begin() != replayQueue.end())
+            while (nextCommand != replayQueue.end())
             {
-                const ReplayCommand& command = (*replayQueue.begin());
+                const ReplayCommand& command = *nextCommand;
 
                 if (_mode == ReplayMode::PLAYING)
                 {
@@ -847,10 +1295,11 @@ namespace OpenRCT2
 
                 bool isPositionValid = false;
 
-                GameAction* action = command.action.get();
+                // Commands are kept so playback can seek backwards, execute a copy.
+                auto action = GameActions::Clone(command.action.get());
                 action->SetFlags(action->GetFlags() | GAME_COMMAND_FLAG_REPLAY);
 
-                GameActions::Result::Ptr result = GameActions::Execute(action);
+                GameActions::Result::Ptr result = GameActions::Execute(action.get());
                 if (result->Error == GameActions::Status::Ok)
                 {
                     isPositionValid = true;
@@ -864,7 +1313,7 @@ namespace OpenRCT2
                         window_scroll_to_location(mainWindow, result->Position);
                 }
 
-                replayQueue.erase(replayQueue.begin());
+                nextCommand++;
             }
         }
 
@@ -875,6 +1324,7 @@ namespace OpenRCT2
         int32_t _faultyChecksumIndex = -1;
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
+        uint32_t _nextKeyframeTick = 0;
         uint32_t _nextReplayTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
@@ -0,0 +1,162 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioMixing.h"
+
+#include <algorithm>
+#include <cmath>
+
+// SSE2 is part of every x86-64 processor, so unlike the drawing routines this needs no runtime check
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define OPENRCT2_AUDIO_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace OpenRCT2::Audio::Mixing
+{
+    static constexpr float S16Scale = 32768.0f;
+    static constexpr float U8Scale = 128.0f;
+
+    void ConvertS16ToFloat(const int16_t* src, float* dst, size_t numSamples)
+    {
+        size_t i = 0;
+#ifdef OPENRCT2_AUDIO_SSE2
+        const __m128 scale = _mm_set1_ps(1.0f / S16Scale);
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            // Sign extend by placing each sample in the upper half of a 32-bit lane
+            const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+            const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+            _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+            _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+        }
+#endif
+        for (; i < numSamples; i++)
+        {
+            dst[i] = src[i] * (1.0f / S16Scale);
+        }
+    }
+
+    void ConvertU8ToFloat(const uint8_t* src, float* dst, size_t numSamples)
+    {
+        for (size_t i = 0; i < numSamples; i++)
+        {
+            dst[i] = (src[i] - U8Scale) * (1.0f / U8Scale);
+        }
+    }
+
+    void ConvertFloatToS16(const float* src, int16_t* dst, size_t numSamples)
+    {
+        size_t i = 0;
+#ifdef OPENRCT2_AUDIO_SSE2
+        const __m128 scale = _mm_set1_ps(S16Scale);
+        const __m128 min = _mm_set1_ps(-S16Scale);
+        const __m128 max = _mm_set1_ps(S16Scale - 1);
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const __m128 lo = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale), min), max);
+            const __m128 hi = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale), min), max);
+            const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(lo), _mm_cvtps_epi32(hi));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+        }
+#endif
+        for (; i < numSamples; i++)
+        {
+            dst[i] = static_cast<int16_t>(std::lrint(std::clamp(src[i] * S16Scale, -S16Scale, S16Scale - 1)));
+        }
+    }
+
+    void ConvertFloatToU8(const float* src, uint8_t* dst, size_t numSamples)
+    {
+        for (size_t i = 0; i < numSamples; i++)
+        {
+            dst[i] = static_cast<uint8_t>(std::lrint(std::clamp(src[i] * U8Scale + U8Scale, 0.0f, 255.0f)));
+        }
+    }
+
+    static void AccumulateStereo(
+        float* dst, const float* src, size_t numFrames, const StereoGain& start, const StereoGain& delta)
+    {
+        size_t frame = 0;
+#ifdef OPENRCT2_AUDIO_SSE2
+        // Two frames at a time, the gain of each frame is worked out from its index so it matches the scalar path
+        const __m128 startGain = _mm_setr_ps(start.Left, start.Right, start.Left, start.Right);
+        const __m128 deltaGain = _mm_setr_ps(delta.Left, delta.Right, delta.Left, delta.Right);
+        const __m128 two = _mm_set1_ps(2.0f);
+        __m128 frameIndex = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+        for (; frame + 2 <= numFrames; frame += 2)
+        {
+            const __m128 gain = _mm_add_ps(startGain, _mm_mul_ps(frameIndex, deltaGain));
+            const __m128 mixed = _mm_add_ps(_mm_loadu_ps(dst + frame * 2), _mm_mul_ps(_mm_loadu_ps(src + frame * 2), gain));
+            _mm_storeu_ps(dst + frame * 2, mixed);
+            frameIndex = _mm_add_ps(frameIndex, two);
+        }
+#endif
+        for (; frame < numFrames; frame++)
+        {
+            auto index = static_cast<float>(frame);
+            dst[frame * 2] += src[frame * 2] * (start.Left + index * delta.Left);
+            dst[frame * 2 + 1] += src[frame * 2 + 1] * (start.Right + index * delta.Right);
+        }
+    }
+
+    static void AccumulateMono(float* dst, const float* src, size_t numFrames, float start, float delta)
+    {
+        size_t frame = 0;
+#ifdef OPENRCT2_AUDIO_SSE2
+        const __m128 startGain = _mm_set1_ps(start);
+        const __m128 deltaGain = _mm_set1_ps(delta);
+        const __m128 four = _mm_set1_ps(4.0f);
+        __m128 frameIndex = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+        for (; frame + 4 <= numFrames; frame += 4)
+        {
+            const __m128 gain = _mm_add_ps(startGain, _mm_mul_ps(frameIndex, deltaGain));
+            _mm_storeu_ps(dst + frame, _mm_add_ps(_mm_loadu_ps(dst + frame), _mm_mul_ps(_mm_loadu_ps(src + frame), gain)));
+            frameIndex = _mm_add_ps(frameIndex, four);
+        }
+#endif
+        for (; frame < numFrames; frame++)
+        {
+            dst[frame] += src[frame] * (start + static_cast<float>(frame) * delta);
+        }
+    }
+
+    void Accumulate(
+        float* dst, const float* src, size_t numFrames, int32_t numChannels, const StereoGain& start,
+        const StereoGain& end)
+    {
+        if (numFrames == 0)
+        {
+            return;
+        }
+
+        auto frames = static_cast<float>(numFrames);
+        StereoGain delta = { (end.Left - start.Left) / frames, (end.Right - start.Right) / frames };
+        if (numChannels == 2)
+        {
+            AccumulateStereo(dst, src, numFrames, start, delta);
+        }
+        else if (numChannels == 1)
+        {
+            AccumulateMono(dst, src, numFrames, start.Left, delta.Left);
+        }
+        else
+        {
+            for (size_t frame = 0; frame < numFrames; frame++)
+            {
+                auto gain = start.Left + static_cast<float>(frame) * delta.Left;
+                for (int32_t channel = 0; channel < numChannels; channel++)
+                {
+                    dst[frame * numChannels + channel] += src[frame * numChannels + channel] * gain;
+                }
+            }
+        }
+    }
+} // namespace OpenRCT2::Audio::Mixing
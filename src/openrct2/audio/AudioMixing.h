@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+/**
+ * The sample operations of the mixer. Channels are mixed onto a bus of interleaved float samples in the range
+ * [-1, 1], which is only converted to the format of the audio device once every channel has been added.
+ */
+namespace OpenRCT2::Audio::Mixing
+{
+    struct StereoGain
+    {
+        float Left{};
+        float Right{};
+    };
+
+    void ConvertS16ToFloat(const int16_t* src, float* dst, size_t numSamples);
+    void ConvertU8ToFloat(const uint8_t* src, float* dst, size_t numSamples);
+
+    /**
+     * Converts the bus to the output format, samples outside of [-1, 1] are clipped.
+     */
+    void ConvertFloatToS16(const float* src, int16_t* dst, size_t numSamples);
+    void ConvertFloatToU8(const float* src, uint8_t* dst, size_t numSamples);
+
+    /**
+     * Adds the frames of src onto dst, with the gain ramping linearly from start to end over the frames to avoid
+     * clicks when the volume or pan of a channel changes. Only stereo uses separate gains for each side, all
+     * samples of other layouts use the left gain.
+     */
+    void Accumulate(
+        float* dst, const float* src, size_t numFrames, int32_t numChannels, const StereoGain& start,
+        const StereoGain& end);
+} // namespace OpenRCT2::Audio::Mixing
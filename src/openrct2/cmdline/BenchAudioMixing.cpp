@@ -0,0 +1,125 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../audio/AudioMixing.h"
+
+#    include <algorithm>
+#    include <benchmark/benchmark.h>
+#    include <random>
+#    include <vector>
+
+using namespace OpenRCT2::Audio;
+
+// The chunk the audio device asks for: 2048 frames of 16-bit stereo at 22050 Hz
+constexpr size_t ChunkFrames = 2048;
+constexpr int32_t ChunkChannels = 2;
+constexpr size_t ChunkSamples = ChunkFrames * ChunkChannels;
+
+// Each source is a second of noise so that the channels read from different places, as they would when playing
+constexpr size_t SourceSamples = 22050 * ChunkChannels;
+
+static std::vector<std::vector<int16_t>> CreateSources(size_t numSources)
+{
+    std::mt19937 prng(42);
+    std::uniform_int_distribution<int32_t> distribution(-20000, 20000);
+    std::vector<std::vector<int16_t>> sources(numSources);
+    for (auto& source : sources)
+    {
+        source.resize(SourceSamples);
+        for (auto& sample : source)
+        {
+            sample = static_cast<int16_t>(distribution(prng));
+        }
+    }
+    return sources;
+}
+
+/**
+ * Mixes a chunk from the given number of channels the way the mixer does once the samples are read, converting
+ * each channel to floats, adding it with a volume and pan ramp and converting the mix to the output format.
+ */
+static void BM_mix(benchmark::State& state)
+{
+    auto numChannels = static_cast<size_t>(state.range(0));
+    auto sources = CreateSources(numChannels);
+    std::vector<float> samples(ChunkSamples);
+    std::vector<float> mix(ChunkSamples);
+    std::vector<int16_t> output(ChunkSamples);
+    size_t offset = 0;
+    for (auto _ : state)
+    {
+        std::fill(mix.begin(), mix.end(), 0.0f);
+        for (size_t i = 0; i < numChannels; i++)
+        {
+            Mixing::ConvertS16ToFloat(sources[i].data() + offset, samples.data(), ChunkSamples);
+            Mixing::Accumulate(
+                mix.data(), samples.data(), ChunkFrames, ChunkChannels, { 0.5f, 0.25f }, { 0.25f, 0.5f });
+        }
+        Mixing::ConvertFloatToS16(mix.data(), output.data(), ChunkSamples);
+        benchmark::DoNotOptimize(output.data());
+
+        offset += ChunkSamples;
+        if (offset + ChunkSamples > SourceSamples)
+        {
+            offset = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numChannels * ChunkFrames);
+}
+
+static void BM_convert_to_float(benchmark::State& state)
+{
+    auto sources = CreateSources(1);
+    std::vector<float> samples(ChunkSamples);
+    for (auto _ : state)
+    {
+        Mixing::ConvertS16ToFloat(sources[0].data(), samples.data(), ChunkSamples);
+        benchmark::DoNotOptimize(samples.data());
+    }
+    state.SetItemsProcessed(state.iterations() * ChunkSamples);
+}
+
+static void BM_convert_from_float(benchmark::State& state)
+{
+    auto sources = CreateSources(1);
+    std::vector<float> samples(ChunkSamples);
+    Mixing::ConvertS16ToFloat(sources[0].data(), samples.data(), ChunkSamples);
+    std::vector<int16_t> output(ChunkSamples);
+    for (auto _ : state)
+    {
+        Mixing::ConvertFloatToS16(samples.data(), output.data(), ChunkSamples);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * ChunkSamples);
+}
+
+static bool RegisterAudioMixingBenchmarks([[maybe_unused]] const std::vector<std::string>& inputs)
+{
+    benchmark::RegisterBenchmark("mix", BM_mix)->RangeMultiplier(4)->Range(1, 256);
+    benchmark::RegisterBenchmark("convert_to_float", BM_convert_to_float);
+    benchmark::RegisterBenchmark("convert_from_float", BM_convert_from_float);
+    return true;
+}
+
+static exitcode_t HandleBenchAudioMixing(CommandLineArgEnumerator* argEnumerator)
+{
+    return CommandLine::RunBenchmarks(
+        argEnumerator, CommandLine::BenchmarkInputs::None, false, RegisterAudioMixingBenchmarks);
+}
+
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchAudioMixingCommands[]{
+    DefineBenchmarkCommand("", HandleBenchAudioMixing), CommandTableEnd
+};
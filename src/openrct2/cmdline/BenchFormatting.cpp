@@ -0,0 +1,86 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../localisation/Formatter.h"
+#    include "../localisation/Formatting.h"
+#    include "../localisation/StringIds.h"
+
+#    include <benchmark/benchmark.h>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+/**
+ * Formats the string the way the windows do, from the arguments written by a Formatter. The uncached variant
+ * discards the compiled format strings before every format, as after the language strings change.
+ */
+static void BM_format(benchmark::State& state, rct_string_id id, Formatter ft, bool cached)
+{
+    char buffer[512];
+    for (auto _ : state)
+    {
+        if (!cached)
+        {
+            InvalidateFormatCache();
+        }
+        auto len = FormatStringLegacy(buffer, sizeof(buffer), id, ft.Data());
+        benchmark::DoNotOptimize(len);
+    }
+}
+
+static void RegisterFormatBenchmarks(const char* name, rct_string_id id, const Formatter& ft)
+{
+    benchmark::RegisterBenchmark(name, BM_format, id, ft, true);
+    benchmark::RegisterBenchmark((std::string(name) + "_uncached").c_str(), BM_format, id, ft, false);
+}
+
+static bool RegisterFormattingBenchmarks([[maybe_unused]] const std::vector<std::string>& inputs)
+{
+    Formatter money;
+    money.Add<money64>(123456789);
+    RegisterFormatBenchmarks("money", STR_BOTTOM_TOOLBAR_CASH, money);
+
+    Formatter date;
+    date.Add<rct_string_id>(STR_DATE_DAY_1 + 21);
+    date.Add<uint16_t>(3);
+    date.Add<int16_t>(12);
+    RegisterFormatBenchmarks("date", STR_DATE_FORMAT_DMY, date);
+
+    Formatter monthYear;
+    monthYear.Add<uint16_t>(100);
+    RegisterFormatBenchmarks("month_year", STR_STAFF_STAT_EMPLOYED_FOR, monthYear);
+
+    Formatter guestName;
+    guestName.Add<uint32_t>(4321);
+    RegisterFormatBenchmarks("guest_name", STR_GUEST_X, guestName);
+
+    Formatter rideName;
+    rideName.Add<rct_string_id>(STR_RIDE_NAME_DEFAULT);
+    rideName.Add<rct_string_id>(STR_RIDE_NAME_BOAT_HIRE);
+    rideName.Add<uint16_t>(2);
+    RegisterFormatBenchmarks("ride_name", STR_QUEUING_FOR, rideName);
+    return true;
+}
+
+static exitcode_t HandleBenchFormatting(CommandLineArgEnumerator* argEnumerator)
+{
+    // The context is needed for the language strings
+    return CommandLine::RunBenchmarks(argEnumerator, CommandLine::BenchmarkInputs::None, true, RegisterFormattingBenchmarks);
+}
+
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchFormattingCommands[]{
+    DefineBenchmarkCommand("", HandleBenchFormatting), CommandTableEnd
+};
@@ -7,24 +7,81 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
-#include "../interface/Screenshot.h"
+#include "Benchmark.h"
 #include "CommandLine.hpp"
 
-static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator);
+#ifdef USE_BENCHMARK
 
-const CommandLineCommand CommandLine::BenchGfxCommands[]{
-    // Main commands
-    DefineCommand("", "<file> [iterations count]", nullptr, HandleBenchGfx), CommandTableEnd
-};
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../Intro.h"
+#    include "../OpenRCT2.h"
+#    include "../drawing/Drawing.h"
+#    include "../interface/Screenshot.h"
+#    include "../platform/platform.h"
 
-static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
+#    include <benchmark/benchmark.h>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static constexpr int32_t BenchGfxZoomLevels = 3;
+
+/**
+ * Renders the whole map at every rotation of the given zoom level, only the rendering itself is timed.
+ */
+static void BM_render(benchmark::State& state, const std::string& filename, ZoomLevel zoom)
 {
-    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
-    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
-    int32_t result = cmdline_for_gfxbench(argv, argc);
-    if (result < 0)
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise() || !context->LoadParkFromFile(filename))
     {
-        return EXITCODE_FAIL;
+        state.SkipWithError("Failed to load park!");
+        return;
     }
-    return EXITCODE_OK;
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+    drawing_engine_init();
+    for (auto _ : state)
+    {
+        state.SetIterationTime(benchgfx_render_rotations(zoom));
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+    drawing_engine_dispose();
 }
+
+static bool RegisterGfxBenchmarks(const std::vector<std::string>& inputs)
+{
+    if (inputs.empty())
+    {
+        log_error("No park file given.");
+        return false;
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    for (const auto& path : inputs)
+    {
+        for (int32_t zoom = 0; zoom < BenchGfxZoomLevels; zoom++)
+        {
+            auto name = path + "/zoom:" + std::to_string(zoom);
+            benchmark::RegisterBenchmark(name.c_str(), BM_render, path, ZoomLevel(zoom))->UseManualTime();
+        }
+    }
+    return true;
+}
+
+static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
+{
+    return CommandLine::RunBenchmarks(argEnumerator, CommandLine::BenchmarkInputs::Files, false, RegisterGfxBenchmarks);
+}
+
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchGfxCommands[]{
+    // Main commands
+    DefineBenchmarkCommand("<file>... ", HandleBenchGfx), CommandTableEnd
+};
@@ -0,0 +1,119 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../drawing/ImageIdAllocator.h"
+#    include "../sprites.h"
+
+#    include <algorithm>
+#    include <benchmark/benchmark.h>
+#    include <random>
+#    include <utility>
+#    include <vector>
+
+static constexpr uint32_t BenchMaxObjectImages = 500;
+
+/**
+ * Keeps state.range(0) object sized ranges allocated and replaces a random one of them every iteration,
+ * similar to objects being unloaded and loaded while the object selection or a server changes maps.
+ */
+static void BM_image_alloc_churn(benchmark::State& state)
+{
+    ImageIdAllocator allocator(SPR_IMAGE_LIST_BEGIN, SPR_IMAGE_LIST_END - SPR_IMAGE_LIST_BEGIN);
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<uint32_t> sizeDist(1, BenchMaxObjectImages);
+
+    std::vector<std::pair<uint32_t, uint32_t>> allocations;
+    auto numLive = static_cast<size_t>(state.range(0));
+    while (allocations.size() < numLive)
+    {
+        auto count = sizeDist(rng);
+        auto baseId = allocator.Allocate(count);
+        if (baseId == ImageIdAllocator::INVALID_ID)
+        {
+            state.SkipWithError("Image list is full!");
+            return;
+        }
+        allocations.emplace_back(baseId, count);
+    }
+
+    int64_t numFailed = 0;
+    for (auto _ : state)
+    {
+        auto& allocation = allocations[rng() % allocations.size()];
+        allocator.Free(allocation.first, allocation.second);
+
+        auto count = sizeDist(rng);
+        auto baseId = allocator.Allocate(count);
+        if (baseId == ImageIdAllocator::INVALID_ID)
+        {
+            numFailed++;
+            count = 0;
+        }
+        allocation = { baseId, count };
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["FreeRanges"] = static_cast<double>(allocator.GetNumFreeRanges());
+    state.counters["Failed"] = static_cast<double>(numFailed);
+}
+
+/**
+ * Loads and then unloads state.range(0) objects in random order, like a full object list being replaced.
+ */
+static void BM_image_alloc_fill_and_free(benchmark::State& state)
+{
+    ImageIdAllocator allocator(SPR_IMAGE_LIST_BEGIN, SPR_IMAGE_LIST_END - SPR_IMAGE_LIST_BEGIN);
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<uint32_t> sizeDist(1, BenchMaxObjectImages);
+
+    auto numObjects = static_cast<size_t>(state.range(0));
+    std::vector<std::pair<uint32_t, uint32_t>> allocations;
+    allocations.reserve(numObjects);
+    for (auto _ : state)
+    {
+        allocations.clear();
+        for (size_t i = 0; i < numObjects; i++)
+        {
+            auto count = sizeDist(rng);
+            auto baseId = allocator.Allocate(count);
+            if (baseId != ImageIdAllocator::INVALID_ID)
+            {
+                allocations.emplace_back(baseId, count);
+            }
+        }
+        std::shuffle(allocations.begin(), allocations.end(), rng);
+        for (auto [baseId, count] : allocations)
+        {
+            allocator.Free(baseId, count);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static bool RegisterImageAllocBenchmarks([[maybe_unused]] const std::vector<std::string>& inputs)
+{
+    benchmark::RegisterBenchmark("churn", BM_image_alloc_churn)->RangeMultiplier(4)->Range(64, 1024);
+    benchmark::RegisterBenchmark("fill_and_free", BM_image_alloc_fill_and_free)->RangeMultiplier(4)->Range(64, 1024);
+    return true;
+}
+
+static exitcode_t HandleBenchImageAlloc(CommandLineArgEnumerator* argEnumerator)
+{
+    return CommandLine::RunBenchmarks(argEnumerator, CommandLine::BenchmarkInputs::None, false, RegisterImageAllocBenchmarks);
+}
+
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchImageAllocCommands[]{
+    DefineBenchmarkCommand("", HandleBenchImageAlloc), CommandTableEnd
+};
@@ -0,0 +1,131 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../PlatformEnvironment.h"
+#    include "../config/Config.h"
+#    include "../core/File.h"
+#    include "../core/FileScanner.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
+#    include "../core/Zip.h"
+#    include "../object/Object.h"
+#    include "../object/ObjectFactory.h"
+#    include "../object/ObjectRepository.h"
+
+#    include <benchmark/benchmark.h>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static std::vector<std::string> GetJsonObjectFiles(const std::string& directory)
+{
+    std::vector<std::string> result;
+    auto scanner = Path::ScanDirectory(Path::Combine(directory, "*.json;*.parkobj"), true);
+    while (scanner->Next())
+    {
+        result.emplace_back(scanner->GetPath());
+    }
+    return result;
+}
+
+static bool IsParkObj(const std::string& path)
+{
+    return String::Equals(Path::GetExtension(path), ".parkobj", true);
+}
+
+/**
+ * Indexes every object the way the repository used to, by reading the object with json_t.
+ */
+static void BM_object_index_json(benchmark::State& state, const std::vector<std::string>& files)
+{
+    auto& objectRepository = GetContext()->GetObjectRepository();
+    for (auto _ : state)
+    {
+        for (const auto& path : files)
+        {
+            auto object = IsParkObj(path) ? ObjectFactory::CreateObjectFromZipFile(objectRepository, path, false)
+                                          : ObjectFactory::CreateObjectFromJsonFile(objectRepository, path, false);
+            if (object != nullptr)
+            {
+                benchmark::DoNotOptimize(object->GetName());
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * files.size());
+}
+
+static void BM_object_index_reader(benchmark::State& state, const std::vector<std::string>& files)
+{
+    for (auto _ : state)
+    {
+        for (const auto& path : files)
+        {
+            std::string json;
+            if (IsParkObj(path))
+            {
+                auto jsonBytes = Zip::Open(path, ZIP_ACCESS::READ)->GetFileData("object.json");
+                json.assign(jsonBytes.begin(), jsonBytes.end());
+            }
+            else
+            {
+                json = File::ReadAllText(path);
+            }
+            ObjectRepositoryItem item = {};
+            benchmark::DoNotOptimize(ObjectFactory::ReadRepositoryItemFromJson(json, item));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * files.size());
+}
+
+/**
+ * Rebuilds the whole object index, as happens when objects are added or the language is changed.
+ */
+static void BM_object_index_rebuild(benchmark::State& state)
+{
+    auto env = GetContext()->GetPlatformEnvironment();
+    for (auto _ : state)
+    {
+        auto objectRepository = CreateObjectRepository(env);
+        objectRepository->Construct(gConfigGeneral.language);
+        state.counters["Objects"] = static_cast<double>(objectRepository->GetNumObjects());
+    }
+}
+
+static bool RegisterObjectIndexBenchmarks(const std::vector<std::string>& inputs)
+{
+    // Defaults to the objects that come with the game
+    auto directory = inputs.empty()
+        ? GetContext()->GetPlatformEnvironment()->GetDirectoryPath(DIRBASE::OPENRCT2, DIRID::OBJECT)
+        : inputs[0];
+
+    auto files = GetJsonObjectFiles(directory);
+    benchmark::RegisterBenchmark("index/json", BM_object_index_json, files)->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark("index/reader", BM_object_index_reader, files)->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark("rebuild", BM_object_index_rebuild)->Unit(benchmark::kMillisecond);
+    return true;
+}
+
+static exitcode_t HandleBenchObjectIndex(CommandLineArgEnumerator* argEnumerator)
+{
+    return CommandLine::RunBenchmarks(
+        argEnumerator, CommandLine::BenchmarkInputs::Directory, true, RegisterObjectIndexBenchmarks);
+}
+
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchObjectIndexCommands[]{
+    DefineBenchmarkCommand("[<directory>] ", HandleBenchObjectIndex), CommandTableEnd
+};
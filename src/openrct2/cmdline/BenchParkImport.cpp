@@ -0,0 +1,145 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../ParkImporter.h"
+#    include "../core/File.h"
+#    include "../core/MemoryStream.h"
+#    include "../core/Path.hpp"
+#    include "../core/Zip.h"
+#    include "../object/ObjectManager.h"
+
+#    include <benchmark/benchmark.h>
+#    include <optional>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+/**
+ * Decodes the park from memory with its importer, without touching the game state.
+ */
+static void BM_park_load(benchmark::State& state, const std::string& path, const std::vector<uint8_t>& data)
+{
+    auto isScenario = ParkImporter::ExtensionIsScenario(Path::GetExtension(path));
+    for (auto _ : state)
+    {
+        try
+        {
+            auto importer = ParkImporter::Create(path);
+            auto ms = MemoryStream(data.data(), data.size());
+            auto result = importer->LoadFromStream(&ms, isScenario, true, path.c_str());
+            benchmark::DoNotOptimize(result);
+        }
+        catch (const std::exception& e)
+        {
+            state.SkipWithError(e.what());
+            return;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+/**
+ * Opens the park the way the game does, including loading its objects and importing it into the game state.
+ */
+static void BM_park_import(benchmark::State& state, const std::string& path)
+{
+    auto context = GetContext();
+    for (auto _ : state)
+    {
+        if (!context->LoadParkFromFile(path))
+        {
+            state.SkipWithError("Unable to load park");
+            return;
+        }
+    }
+}
+
+/**
+ * Loads the objects the park needs, which for most parks are largely .parkobj files. The cold variant
+ * opens the archives for every load, as the game does, the other keeps them open between loads.
+ */
+static void BM_park_objects(benchmark::State& state, const std::string& path, bool cold)
+{
+    ObjectList requiredObjects;
+    try
+    {
+        auto importer = ParkImporter::Create(path);
+        requiredObjects = importer->Load(path.c_str()).RequiredObjects;
+    }
+    catch (const std::exception& e)
+    {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    std::optional<Zip::SharedArchiveScope> sharedArchives;
+    if (!cold)
+    {
+        sharedArchives.emplace();
+    }
+
+    auto& objectManager = GetContext()->GetObjectManager();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        objectManager.UnloadAll();
+        state.ResumeTiming();
+
+        try
+        {
+            objectManager.LoadObjects(requiredObjects);
+        }
+        catch (const std::exception& e)
+        {
+            state.SkipWithError(e.what());
+            return;
+        }
+    }
+}
+
+static bool RegisterParkImportBenchmarks(const std::vector<std::string>& inputs)
+{
+    if (inputs.empty())
+    {
+        log_error("Expected one or more saved games or scenarios");
+        return false;
+    }
+
+    // The parks are read up front so that the load benchmarks only measure decoding
+    for (const auto& path : inputs)
+    {
+        auto name = Path::GetFileName(path);
+        auto data = File::ReadAllBytes(path);
+        benchmark::RegisterBenchmark(("load/" + name).c_str(), BM_park_load, path, data)->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("import/" + name).c_str(), BM_park_import, path)->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("objects/" + name).c_str(), BM_park_objects, path, false)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("objects_cold/" + name).c_str(), BM_park_objects, path, true)
+            ->Unit(benchmark::kMillisecond);
+    }
+    return true;
+}
+
+static exitcode_t HandleBenchParkImport(CommandLineArgEnumerator* argEnumerator)
+{
+    return CommandLine::RunBenchmarks(argEnumerator, CommandLine::BenchmarkInputs::Files, true, RegisterParkImportBenchmarks);
+}
+
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchParkImportCommands[]{
+    DefineBenchmarkCommand("<file> [<file>...] ", HandleBenchParkImport), CommandTableEnd
+};
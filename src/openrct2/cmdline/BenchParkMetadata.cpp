@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../ParkImporter.h"
+#    include "../core/FileScanner.h"
+#    include "../core/FileStream.h"
+#    include "../core/Path.hpp"
+
+#    include <benchmark/benchmark.h>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static std::vector<std::string> GetParkFiles(const std::string& directory)
+{
+    std::vector<std::string> result;
+    auto scanner = Path::ScanDirectory(Path::Combine(directory, "*.sv6;*.sc6;*.sv4;*.sc4"), false);
+    while (scanner->Next())
+    {
+        result.emplace_back(scanner->GetPath());
+    }
+    return result;
+}
+
+/**
+ * Lists the directory the way it would be without a metadata path, by loading every park with its importer.
+ */
+static void BM_park_list_importer(benchmark::State& state, const std::vector<std::string>& files)
+{
+    for (auto _ : state)
+    {
+        for (const auto& path : files)
+        {
+            try
+            {
+                auto importer = ParkImporter::Create(path);
+                auto fs = FileStream(path, FILE_MODE_OPEN);
+                auto isScenario = ParkImporter::ExtensionIsScenario(Path::GetExtension(path));
+                auto result = importer->LoadFromStream(&fs, isScenario, true, path.c_str());
+                benchmark::DoNotOptimize(result);
+            }
+            catch (const std::exception&)
+            {
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * files.size());
+}
+
+static void BM_park_list_metadata(benchmark::State& state, const std::vector<std::string>& files)
+{
+    for (auto _ : state)
+    {
+        ParkImporter::ClearMetadataCache();
+        for (const auto& path : files)
+        {
+            benchmark::DoNotOptimize(ParkImporter::ReadMetadata(path));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * files.size());
+}
+
+static void BM_park_list_metadata_cached(benchmark::State& state, const std::vector<std::string>& files)
+{
+    for (const auto& path : files)
+    {
+        benchmark::DoNotOptimize(ParkImporter::ReadMetadata(path));
+    }
+    for (auto _ : state)
+    {
+        for (const auto& path : files)
+        {
+            benchmark::DoNotOptimize(ParkImporter::ReadMetadata(path));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * files.size());
+}
+
+static bool RegisterParkMetadataBenchmarks(const std::vector<std::string>& inputs)
+{
+    if (inputs.empty())
+    {
+        log_error("Expected a directory of saved games or scenarios");
+        return false;
+    }
+
+    auto files = GetParkFiles(inputs[0]);
+    benchmark::RegisterBenchmark("list/importer", BM_park_list_importer, files)->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark("list/metadata", BM_park_list_metadata, files)->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark("list/metadata_cached", BM_park_list_metadata_cached, files)
+        ->Unit(benchmark::kMillisecond);
+    return true;
+}
+
+static exitcode_t HandleBenchParkMetadata(CommandLineArgEnumerator* argEnumerator)
+{
+    return CommandLine::RunBenchmarks(
+        argEnumerator, CommandLine::BenchmarkInputs::Directory, true, RegisterParkMetadataBenchmarks);
+}
+
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchParkMetadataCommands[]{
+    DefineBenchmarkCommand("<directory> ", HandleBenchParkMetadata), CommandTableEnd
+};
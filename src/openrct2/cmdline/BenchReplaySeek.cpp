@@ -0,0 +1,111 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../platform/platform.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static exitcode_t HandleBenchReplaySeek(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchReplaySeekCommands[]{
+    // Main commands
+    DefineCommand("", "<replay-file> [<seeks>]", nullptr, HandleBenchReplaySeek), CommandTableEnd
+};
+
+static exitcode_t HandleBenchReplaySeek(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing arguments <replay-file> [<seeks>].");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    const char* inputPath = argv[0];
+    uint32_t numSeeks = argc >= 2 ? static_cast<uint32_t>(atol(argv[1])) : 20;
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    auto* replayManager = context->GetReplayManager();
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    if (!replayManager->StartPlayback(inputPath))
+    {
+        Console::Error::WriteLine("Unable to start playback of '%s'.", inputPath);
+        return EXITCODE_FAIL;
+    }
+    std::chrono::duration<double, std::milli> openTime = std::chrono::high_resolution_clock::now() - startTime;
+
+    ReplayRecordInfo info;
+    replayManager->GetCurrentReplayInfo(info);
+    Console::WriteLine(
+        "Opened replay in %.2f ms: %u ticks, %u commands, %u keyframes", openTime.count(), info.Ticks, info.NumCommands,
+        info.NumKeyframes);
+
+    // Fixed seed so runs are comparable, seeks jump both forwards and backwards.
+    std::mt19937 prng(0);
+    std::uniform_int_distribution<uint32_t> tickDistribution(0, info.Ticks > 0 ? info.Ticks - 1 : 0);
+
+    std::vector<double> seekTimes;
+    for (uint32_t i = 0; i < numSeeks; i++)
+    {
+        uint32_t targetTick = tickDistribution(prng);
+
+        startTime = std::chrono::high_resolution_clock::now();
+        if (!replayManager->SeekPlayback(targetTick))
+        {
+            Console::Error::WriteLine("Seek to tick %u failed.", targetTick);
+            return EXITCODE_FAIL;
+        }
+        std::chrono::duration<double, std::milli> seekTime = std::chrono::high_resolution_clock::now() - startTime;
+        seekTimes.push_back(seekTime.count());
+
+        Console::WriteLine("Seek to tick %u: %.2f ms", targetTick, seekTime.count());
+    }
+
+    if (!seekTimes.empty())
+    {
+        std::sort(seekTimes.begin(), seekTimes.end());
+        double total = 0;
+        for (auto seekTime : seekTimes)
+        {
+            total += seekTime;
+        }
+        Console::WriteLine(
+            "Seek latency over %u seeks: min %.2f ms, median %.2f ms, mean %.2f ms, max %.2f ms",
+            static_cast<uint32_t>(seekTimes.size()), seekTimes.front(), seekTimes[seekTimes.size() / 2],
+            total / seekTimes.size(), seekTimes.back());
+    }
+
+    replayManager->StopPlayback();
+    return EXITCODE_OK;
+}
@@ -0,0 +1,125 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../GameState.h"
+#    include "../GameStateRollback.h"
+#    include "../OpenRCT2.h"
+#    include "../platform/platform.h"
+#    include "../world/Entity.h"
+#    include "../world/EntityList.h"
+#    include "../world/Litter.h"
+#    include "../world/Map.h"
+#    include "../world/Sprite.h"
+
+#    include <benchmark/benchmark.h>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+/**
+ * Loads the given park, or when there is none, creates an empty map filled with litter up to the
+ * entity limit so the copies are as large as they can get.
+ */
+static bool LoadRollbackPark(IContext& context, const std::string& filename)
+{
+    if (!filename.empty())
+    {
+        return context.LoadParkFromFile(filename);
+    }
+
+    map_init(MAXIMUM_MAP_SIZE_TECHNICAL);
+    for (int32_t i = 0; i < MAX_ENTITIES; i++)
+    {
+        auto* litter = CreateEntity<Litter>();
+        if (litter == nullptr)
+        {
+            break;
+        }
+        litter->SubType = Litter::Type::Vomit;
+        litter->MoveTo({ (i % 200) * COORDS_XY_STEP + 16, (i / 200) * COORDS_XY_STEP + 16, 16 });
+    }
+    return true;
+}
+
+static void BM_rollback_capture(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise() || !LoadRollbackPark(*context, filename))
+    {
+        state.SkipWithError("Failed to load park!");
+        return;
+    }
+
+    auto rollback = CreateGameStateRollback();
+    for (auto _ : state)
+    {
+        rollback->Capture();
+        gCurrentTicks++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["Entities"] = MAX_ENTITIES - GetNumFreeEntities();
+}
+
+static void BM_rollback_restore(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise() || !LoadRollbackPark(*context, filename))
+    {
+        state.SkipWithError("Failed to load park!");
+        return;
+    }
+
+    auto rollback = CreateGameStateRollback();
+    auto tick = gCurrentTicks;
+    rollback->Capture();
+    for (auto _ : state)
+    {
+        if (!rollback->Restore(tick))
+        {
+            state.SkipWithError("Failed to restore state!");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["Entities"] = MAX_ENTITIES - GetNumFreeEntities();
+}
+
+static bool RegisterRollbackBenchmarks(const std::vector<std::string>& inputs)
+{
+    core_init();
+    gOpenRCT2Headless = true;
+
+    benchmark::RegisterBenchmark("capture/full", BM_rollback_capture, std::string{})->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark("restore/full", BM_rollback_restore, std::string{})->Unit(benchmark::kMicrosecond);
+    for (const auto& path : inputs)
+    {
+        benchmark::RegisterBenchmark(("capture/" + path).c_str(), BM_rollback_capture, path)->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark(("restore/" + path).c_str(), BM_rollback_restore, path)->Unit(benchmark::kMicrosecond);
+    }
+    return true;
+}
+
+static exitcode_t HandleBenchRollback(CommandLineArgEnumerator* argEnumerator)
+{
+    return CommandLine::RunBenchmarks(argEnumerator, CommandLine::BenchmarkInputs::Files, false, RegisterRollbackBenchmarks);
+}
+
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchRollbackCommands[]{
+    DefineBenchmarkCommand("[<file>]... ", HandleBenchRollback), CommandTableEnd
+};
@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "Benchmark.h"
 #include "CommandLine.hpp"
 
 #ifdef USE_BENCHMARK
@@ -157,7 +158,7 @@ static void BM_paint_session_arrange(benchmark::State& state, const std::vector<
     delete[] local_s;
 }
 
-static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
+static bool RegisterSpriteSortBenchmarks(const std::vector<std::string>& inputs)
 {
     {
         // Register some basic "baseline" benchmark
@@ -173,68 +174,23 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
         benchmark::RegisterBenchmark("baseline", BM_paint_session_arrange, sessions);
     }
 
-    // Google benchmark does stuff to argv. It doesn't modify the pointees,
-    // but it wants to reorder the pointers, so present a copy of them.
-    std::vector<char*> argv_for_benchmark;
-
-    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
-    argv_for_benchmark.push_back(nullptr);
-
-    // Extract file names from argument list. If there is no such file, consider it benchmark option.
-    for (int i = 0; i < argc; i++)
+    for (const auto& path : inputs)
     {
-        if (Platform::FileExists(argv[i]))
-        {
-            // Register benchmark for sv6 if valid
-            std::vector<RecordedPaintSession> sessions = extract_paint_session(argv[i]);
-            if (!sessions.empty())
-                benchmark::RegisterBenchmark(argv[i], BM_paint_session_arrange, sessions);
-        }
-        else
-        {
-            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
-        }
+        // Register benchmark for sv6 if valid
+        std::vector<RecordedPaintSession> sessions = extract_paint_session(path);
+        if (!sessions.empty())
+            benchmark::RegisterBenchmark(path.c_str(), BM_paint_session_arrange, sessions);
     }
-    // Update argc with all the changes made
-    argc = static_cast<int>(argv_for_benchmark.size());
-    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
-    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
-        return -1;
-    ::benchmark::RunSpecifiedBenchmarks();
-    return 0;
+    return true;
 }
 
 static exitcode_t HandleBenchSpriteSort(CommandLineArgEnumerator* argEnumerator)
 {
-    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
-    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
-    int32_t result = cmdline_for_bench_sprite_sort(argc, argv);
-    if (result < 0)
-    {
-        return EXITCODE_FAIL;
-    }
-    return EXITCODE_OK;
+    return CommandLine::RunBenchmarks(argEnumerator, CommandLine::BenchmarkInputs::Files, false, RegisterSpriteSortBenchmarks);
 }
 
-#else
-static exitcode_t HandleBenchSpriteSort(CommandLineArgEnumerator* argEnumerator)
-{
-    log_error("Sorry, Google benchmark not enabled in this build");
-    return EXITCODE_FAIL;
-}
 #endif // USE_BENCHMARK
 
 const CommandLineCommand CommandLine::BenchSpriteSortCommands[]{
-#ifdef USE_BENCHMARK
-    DefineCommand(
-        "",
-        "[<file>]... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
-        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
-        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
-        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
-        nullptr, HandleBenchSpriteSort),
-    CommandTableEnd
-#else
-    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchSpriteSort), CommandTableEnd
-#endif // USE_BENCHMARK
+    DefineBenchmarkCommand("[<file>]... ", HandleBenchSpriteSort), CommandTableEnd
 };
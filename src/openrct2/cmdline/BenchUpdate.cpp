@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "Benchmark.h"
 #include "CommandLine.hpp"
 
 #ifdef USE_BENCHMARK
@@ -80,6 +81,13 @@ static void BM_update(benchmark::State& state, const std::string& filename)
         state.counters["GameActionsAcc_ms"] = accumulator(LogicTimePart::GameActions);
         state.counters["NetworkFlushAcc_ms"] = accumulator(LogicTimePart::NetworkFlush);
         state.counters["ScriptsAcc_ms"] = accumulator(LogicTimePart::Scripts);
+
+        std::chrono::duration<double> pluginTime{};
+        for (const auto& timing : timings)
+        {
+            pluginTime = std::accumulate(timing.PluginTime.begin(), timing.PluginTime.end(), pluginTime);
+        }
+        state.counters["PluginsAcc_ms"] = std::chrono::duration<double, std::milli>(pluginTime).count();
     }
     else
     {
@@ -87,75 +95,29 @@ static void BM_update(benchmark::State& state, const std::string& filename)
     }
 }
 
-static int CmdlineForBenchSpriteSort(int argc, const char* const* argv)
+static bool RegisterUpdateBenchmarks(const std::vector<std::string>& inputs)
 {
-    // Add a baseline test on an empty park
-    benchmark::RegisterBenchmark("baseline", BM_update, std::string{});
-
-    // Google benchmark does stuff to argv. It doesn't modify the pointees,
-    // but it wants to reorder the pointers, so present a copy of them.
-    std::vector<char*> argv_for_benchmark;
-
-    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
-    argv_for_benchmark.push_back(nullptr);
-
-    // Extract file names from argument list. If there is no such file, consider it benchmark option.
-    for (int i = 0; i < argc; i++)
-    {
-        if (Platform::FileExists(argv[i]))
-        {
-            // Register benchmark for sv6 if valid
-            benchmark::RegisterBenchmark(argv[i], BM_update, argv[i]);
-        }
-        else
-        {
-            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
-        }
-    }
-    // Update argc with all the changes made
-    argc = static_cast<int>(argv_for_benchmark.size());
-    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
-    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
-        return -1;
-
     core_init();
     gOpenRCT2Headless = true;
 
-    ::benchmark::RunSpecifiedBenchmarks();
-    return 0;
-}
+    // Add a baseline test on an empty park
+    benchmark::RegisterBenchmark("baseline", BM_update, std::string{});
 
-static exitcode_t HandleBenchUpdate(CommandLineArgEnumerator* argEnumerator)
-{
-    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
-    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
-    int32_t result = CmdlineForBenchSpriteSort(argc, argv);
-    if (result < 0)
+    for (const auto& path : inputs)
     {
-        return EXITCODE_FAIL;
+        // Register benchmark for sv6 if valid
+        benchmark::RegisterBenchmark(path.c_str(), BM_update, path);
     }
-    return EXITCODE_OK;
+    return true;
 }
 
-#else
 static exitcode_t HandleBenchUpdate(CommandLineArgEnumerator* argEnumerator)
 {
-    log_error("Sorry, Google benchmark not enabled in this build");
-    return EXITCODE_FAIL;
+    return CommandLine::RunBenchmarks(argEnumerator, CommandLine::BenchmarkInputs::Files, false, RegisterUpdateBenchmarks);
 }
+
 #endif // USE_BENCHMARK
 
 const CommandLineCommand CommandLine::BenchUpdateCommands[]{
-#ifdef USE_BENCHMARK
-    DefineCommand(
-        "",
-        "<file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
-        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
-        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
-        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
-        nullptr, HandleBenchUpdate),
-    CommandTableEnd
-#else
-    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchUpdate), CommandTableEnd
-#endif // USE_BENCHMARK
+    DefineBenchmarkCommand("<file>... ", HandleBenchUpdate), CommandTableEnd
 };
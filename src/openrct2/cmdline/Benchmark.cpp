@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../core/Path.hpp"
+#include "../platform/Platform2.h"
+#include "../platform/platform.h"
+
+#ifdef USE_BENCHMARK
+#    include <benchmark/benchmark.h>
+#endif // USE_BENCHMARK
+
+#include <memory>
+
+using namespace OpenRCT2;
+
+namespace CommandLine
+{
+#ifdef USE_BENCHMARK
+    exitcode_t RunBenchmarks(
+        CommandLineArgEnumerator* argEnumerator, BenchmarkInputs inputs, bool createContext,
+        BenchmarkRegisterFunc registerBenchmarks)
+    {
+        const char* const* argv = argEnumerator->GetArguments() + argEnumerator->GetIndex();
+        int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+        // Google benchmark does stuff to argv. It doesn't modify the pointees,
+        // but it wants to reorder the pointers, so present a copy of them.
+        std::vector<char*> argv_for_benchmark;
+
+        // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+        argv_for_benchmark.push_back(nullptr);
+
+        // Extract the inputs from the argument list. Anything else is considered a benchmark option.
+        std::vector<std::string> inputPaths;
+        for (int32_t i = 0; i < argc; i++)
+        {
+            bool isInput = false;
+            switch (inputs)
+            {
+                case BenchmarkInputs::None:
+                    break;
+                case BenchmarkInputs::Files:
+                    isInput = Platform::FileExists(argv[i]);
+                    break;
+                case BenchmarkInputs::Directory:
+                    isInput = inputPaths.empty() && Path::DirectoryExists(argv[i]);
+                    break;
+            }
+
+            if (isInput)
+            {
+                inputPaths.emplace_back(argv[i]);
+            }
+            else
+            {
+                argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+            }
+        }
+
+        // Update argc with all the changes made
+        argc = static_cast<int32_t>(argv_for_benchmark.size());
+        ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+        if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+            return EXITCODE_FAIL;
+
+        std::unique_ptr<IContext> context;
+        if (createContext)
+        {
+            core_init();
+            gOpenRCT2Headless = true;
+            gOpenRCT2NoGraphics = true;
+
+            context = CreateContext();
+            if (!context->Initialise())
+            {
+                log_error("Failed to initialise context");
+                return EXITCODE_FAIL;
+            }
+        }
+
+        if (!registerBenchmarks(inputPaths))
+            return EXITCODE_FAIL;
+
+        ::benchmark::RunSpecifiedBenchmarks();
+        return EXITCODE_OK;
+    }
+#endif // USE_BENCHMARK
+
+    exitcode_t HandleBenchmarkNotEnabled([[maybe_unused]] CommandLineArgEnumerator* argEnumerator)
+    {
+        log_error("Sorry, Google benchmark not enabled in this build");
+        return EXITCODE_FAIL;
+    }
+} // namespace CommandLine
@@ -0,0 +1,62 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "CommandLine.hpp"
+
+#include <string>
+#include <vector>
+
+// The options understood by Google benchmark, shown after the inputs of each benchmark command
+#define BENCHMARK_OPTIONS_USAGE                                                                                                \
+    "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "                  \
+    "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "                          \
+    "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "       \
+    "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]"
+
+/**
+ * Defines a benchmark command. inputs is the usage of the arguments the command takes before the benchmark options, either
+ * empty or ending in a space.
+ */
+#ifdef USE_BENCHMARK
+#    define DefineBenchmarkCommand(inputs, func) DefineCommand("", inputs BENCHMARK_OPTIONS_USAGE, nullptr, func)
+#else
+#    define DefineBenchmarkCommand(inputs, func)                                                                               \
+        DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, CommandLine::HandleBenchmarkNotEnabled)
+#endif // USE_BENCHMARK
+
+namespace CommandLine
+{
+    enum class BenchmarkInputs
+    {
+        None,
+        Files,
+        Directory,
+    };
+
+    /**
+     * Registers the benchmarks of a command. inputs holds the files or directory given on the command line.
+     * Returns false if the benchmarks could not be set up.
+     */
+    using BenchmarkRegisterFunc = bool (*)(const std::vector<std::string>& inputs);
+
+#ifdef USE_BENCHMARK
+    /**
+     * Runs the benchmarks of a command. Arguments that are existing files, or the first existing directory, are taken as
+     * inputs depending on inputs. All other arguments are passed to Google benchmark. When createContext is set, a headless
+     * context is initialised before the benchmarks are registered and is kept until they have run.
+     */
+    exitcode_t RunBenchmarks(
+        CommandLineArgEnumerator* argEnumerator, BenchmarkInputs inputs, bool createContext,
+        BenchmarkRegisterFunc registerBenchmarks);
+#endif // USE_BENCHMARK
+
+    exitcode_t HandleBenchmarkNotEnabled(CommandLineArgEnumerator* argEnumerator);
+} // namespace CommandLine
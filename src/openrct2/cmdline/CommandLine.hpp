@@ -116,10 +116,20 @@ namespace CommandLine
     extern const CommandLineCommand RootCommands[];
     extern const CommandLineCommand ScreenshotCommands[];
     extern const CommandLineCommand SpriteCommands[];
+    extern const CommandLineCommand BenchAudioMixingCommands[];
+    extern const CommandLineCommand BenchFormattingCommands[];
     extern const CommandLineCommand BenchGfxCommands[];
+    extern const CommandLineCommand BenchImageAllocCommands[];
+    extern const CommandLineCommand BenchObjectIndexCommands[];
+    extern const CommandLineCommand BenchParkImportCommands[];
+    extern const CommandLineCommand BenchParkMetadataCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
     extern const CommandLineCommand BenchUpdateCommands[];
+    extern const CommandLineCommand BenchReplaySeekCommands[];
+    extern const CommandLineCommand BenchRollbackCommands[];
+    extern const CommandLineCommand ProfileObjectsCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand SimulateBatchCommands[];
 
     extern const CommandLineExample RootExamples[];
 
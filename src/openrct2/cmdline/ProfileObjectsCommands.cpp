@@ -0,0 +1,124 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../drawing/Drawing.h"
+#include "../object/ObjectLoadProfile.h"
+#include "../object/ObjectManager.h"
+#include "../platform/Platform2.h"
+#include "../platform/platform.h"
+#include "../sprites.h"
+#include "CommandLine.hpp"
+
+#include <chrono>
+#include <limits>
+#include <memory>
+
+using namespace OpenRCT2;
+
+static utf8* _sort = nullptr;
+static int32_t _count = 0;
+static bool _images = false;
+static bool _decode = false;
+
+static exitcode_t HandleProfileObjects(CommandLineArgEnumerator* argEnumerator);
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition ProfileObjectsOptions[]
+{
+    { CMDLINE_TYPE_STRING,  &_sort,   NAC, "sort",   "time, read, load, images or size (default: time)"                 },
+    { CMDLINE_TYPE_INTEGER, &_count,  NAC, "count",  "number of objects to list (default: all)"                         },
+    { CMDLINE_TYPE_SWITCH,  &_images, NAC, "images", "load object images as the game does, needs the RCT2 graphics"     },
+    { CMDLINE_TYPE_SWITCH,  &_decode, NAC, "decode", "also decode the images left for the first draw, implies --images" },
+    OptionTableEnd
+};
+
+const CommandLineCommand CommandLine::ProfileObjectsCommands[]
+{
+    // Main commands
+    DefineCommand("", "<park-file>", ProfileObjectsOptions, HandleProfileObjects),
+    CommandTableEnd
+};
+// clang-format on
+
+static void WritePeakMemoryUsage(const char* stage)
+{
+    auto peakMemory = Platform::GetPeakMemoryUsage();
+    if (peakMemory != 0)
+    {
+        Console::WriteLine("Peak memory usage %s: %.1f MiB", stage, peakMemory / (1024.0 * 1024.0));
+    }
+}
+
+/**
+ * Decodes every image in the image list that has not been drawn yet, as drawing the whole park would.
+ */
+static void DecodeAllImages()
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (int32_t imageId = SPR_IMAGE_LIST_BEGIN; imageId < SPR_IMAGE_LIST_END; imageId++)
+    {
+        gfx_get_g1_element(imageId);
+    }
+    std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - startTime;
+    Console::WriteLine("Decoded all images in %.1f ms", duration.count());
+}
+
+static exitcode_t HandleProfileObjects(CommandLineArgEnumerator* argEnumerator)
+{
+    const utf8* inputPath;
+    if (!argEnumerator->TryPopString(&inputPath))
+    {
+        Console::Error::WriteLine("Expected a park file.");
+        return EXITCODE_FAIL;
+    }
+
+    auto sort = ObjectLoadProfileSort::Time;
+    if (_sort != nullptr && !ObjectLoadProfileSortFromString(_sort, sort))
+    {
+        Console::Error::WriteLine("Unknown sort order '%s'.", _sort);
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = !_images && !_decode;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    WritePeakMemoryUsage("after initialisation");
+
+    // Loading the park loads its objects, which records the profile
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto profile = context->GetObjectManager().GetLastLoadProfile();
+    profile.Sort(sort);
+    auto count = _count > 0 ? static_cast<size_t>(_count) : std::numeric_limits<size_t>::max();
+    for (const auto& line : profile.FormatReport(count))
+    {
+        Console::WriteLine("%s", line.c_str());
+    }
+    WritePeakMemoryUsage("after loading the park");
+
+    if (_decode)
+    {
+        DecodeAllImages();
+        WritePeakMemoryUsage("after decoding all images");
+    }
+    return EXITCODE_OK;
+}
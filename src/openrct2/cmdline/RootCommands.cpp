@@ -92,6 +92,7 @@ static exitcode_t HandleCommandJoin(CommandLineArgEnumerator * enumerator);
 #endif
 static exitcode_t HandleCommandSetRCT2(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandScanObjects(CommandLineArgEnumerator * enumerator);
+static exitcode_t HandleCommandBuildObjectCache(CommandLineArgEnumerator * enumerator);
 
 #if defined(_WIN32) && !defined(__MINGW32__)
 
@@ -128,6 +129,7 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
     DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
     DefineCommand("scan-objects", "<path>",             StandardOptions, HandleCommandScanObjects),
+    DefineCommand("build-object-cache", "[<path>]",     StandardOptions, HandleCommandBuildObjectCache),
     DefineCommand("handle-uri", "openrct2://.../",      StandardOptions, CommandLine::HandleCommandUri),
 
 #if defined(_WIN32) && !defined(__MINGW32__)
@@ -140,7 +142,17 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
     DefineSubCommand("benchsimulate",   CommandLine::BenchUpdateCommands      ),
+    DefineSubCommand("benchreplayseek", CommandLine::BenchReplaySeekCommands  ),
+    DefineSubCommand("benchrollback",   CommandLine::BenchRollbackCommands    ),
+    DefineSubCommand("benchimagealloc", CommandLine::BenchImageAllocCommands  ),
+    DefineSubCommand("benchparkmetadata", CommandLine::BenchParkMetadataCommands),
+    DefineSubCommand("benchparkimport", CommandLine::BenchParkImportCommands  ),
+    DefineSubCommand("benchobjectindex", CommandLine::BenchObjectIndexCommands ),
+    DefineSubCommand("benchformatting", CommandLine::BenchFormattingCommands  ),
+    DefineSubCommand("benchaudiomixing", CommandLine::BenchAudioMixingCommands ),
+    DefineSubCommand("profile-objects", CommandLine::ProfileObjectsCommands   ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("simulate-batch",  CommandLine::SimulateBatchCommands    ),
     CommandTableEnd
 };
 
@@ -410,6 +422,40 @@ static exitcode_t HandleCommandScanObjects([[maybe_unused]] CommandLineArgEnumer
     return EXITCODE_OK;
 }
 
+static exitcode_t HandleCommandBuildObjectCache(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto context = OpenRCT2::CreateContext();
+    auto env = context->GetPlatformEnvironment();
+
+    const utf8* outputPath = nullptr;
+    auto cachePath = enumerator->TryPopString(&outputPath) ? std::string(outputPath)
+                                                           : env->GetFilePath(OpenRCT2::PATHID::CACHE_OBJECT_DATA);
+
+    auto objectRepository = CreateObjectRepository(env);
+    objectRepository->Construct(gConfigGeneral.language);
+
+    try
+    {
+        auto numObjects = objectRepository->BuildCache(cachePath);
+        Console::WriteLine("Wrote %zu objects to %s", numObjects, cachePath.c_str());
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to write object cache: %s", e.what());
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
 #if defined(_WIN32) && !defined(__MINGW32__)
 static exitcode_t HandleCommandRegisterShell([[maybe_unused]] CommandLineArgEnumerator* enumerator)
 {
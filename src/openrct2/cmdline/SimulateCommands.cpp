@@ -12,22 +12,93 @@
 #include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../core/Console.hpp"
+#include "../core/Json.hpp"
+#include "../localisation/Date.h"
+#include "../management/Finance.h"
 #include "../network/network.h"
+#include "../peep/Peep.h"
 #include "../platform/platform.h"
+#include "../ride/Ride.h"
+#include "../scenario/Scenario.h"
+#include "../world/Park.h"
 #include "../world/Sprite.h"
 #include "CommandLine.hpp"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#    include <poll.h>
+#    include <sys/wait.h>
+#    include <unistd.h>
+#endif
 
 using namespace OpenRCT2;
 
+static int32_t _batchSeeds = 0;
+static int32_t _batchJobs = 0;
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleSimulateBatch(CommandLineArgEnumerator* argEnumerator);
 
 const CommandLineCommand CommandLine::SimulateCommands[]{ // Main commands
                                                           DefineCommand("", "<ticks>", nullptr, HandleSimulate), CommandTableEnd
 };
 
+// clang-format off
+static constexpr const CommandLineOptionDefinition SimulateBatchOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_batchSeeds, NAC, "seeds", "run every park once per seed 0..n-1 instead of with its saved random state" },
+    { CMDLINE_TYPE_INTEGER, &_batchJobs,  NAC, "jobs",  "number of simulations to run at the same time (default: number of cores)"   },
+    OptionTableEnd
+};
+
+const CommandLineCommand CommandLine::SimulateBatchCommands[]
+{
+    // Main commands
+    DefineCommand("", "<ticks> <output-json> <park-file> [<park-file> ...]", SimulateBatchOptions, HandleSimulateBatch),
+    CommandTableEnd
+};
+
+static constexpr const std::pair<LogicTimePart, const char*> LogicTimePartNames[] = {
+    { LogicTimePart::NetworkUpdate, "NetworkUpdate" },
+    { LogicTimePart::Date, "Date" },
+    { LogicTimePart::Scenario, "Scenario" },
+    { LogicTimePart::Climate, "Climate" },
+    { LogicTimePart::MapTiles, "MapTiles" },
+    { LogicTimePart::MapStashProvisionalElements, "MapStashProvisionalElements" },
+    { LogicTimePart::MapPathWideFlags, "MapPathWideFlags" },
+    { LogicTimePart::Peep, "Peep" },
+    { LogicTimePart::MapRestoreProvisionalElements, "MapRestoreProvisionalElements" },
+    { LogicTimePart::Vehicle, "Vehicle" },
+    { LogicTimePart::Misc, "Misc" },
+    { LogicTimePart::Ride, "Ride" },
+    { LogicTimePart::Park, "Park" },
+    { LogicTimePart::Research, "Research" },
+    { LogicTimePart::RideRatings, "RideRatings" },
+    { LogicTimePart::RideMeasurments, "RideMeasurments" },
+    { LogicTimePart::News, "News" },
+    { LogicTimePart::MapAnimation, "MapAnimation" },
+    { LogicTimePart::Sounds, "Sounds" },
+    { LogicTimePart::GameActions, "GameActions" },
+    { LogicTimePart::NetworkFlush, "NetworkFlush" },
+    { LogicTimePart::Scripts, "Scripts" },
+};
+// clang-format on
+
+struct SimulateBatchRun
+{
+    std::string ParkPath;
+    std::optional<uint32_t> Seed;
+};
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 {
     const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
@@ -73,3 +144,344 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 
     return EXITCODE_OK;
 }
+
+/**
+ * Loads the park for a single batch run into the given context, simulates it and returns the
+ * result as JSON. Timings are accumulated per LogicTimePart over the whole run.
+ */
+static json_t SimulateBatchRunInContext(IContext& context, const SimulateBatchRun& run, uint32_t ticks)
+{
+    json_t result = {
+        { "park", run.ParkPath },
+        { "ticks", ticks },
+    };
+    if (run.Seed)
+    {
+        result["seed"] = *run.Seed;
+    }
+
+    if (!context.LoadParkFromFile(run.ParkPath))
+    {
+        result["error"] = "Unable to load park.";
+        return result;
+    }
+
+    if (run.Seed)
+    {
+        scenario_rand_seed(*run.Seed, ~*run.Seed);
+    }
+
+    // UpdateLogic records the time elapsed since the start of the tick after each part, the
+    // parts are reported in declaration order so the cost of a part is the delta to the previous one.
+    std::array<double, std::size(LogicTimePartNames)> partTotals{};
+    double pluginTotal = 0;
+    LogicTimings timings;
+    auto gameState = context.GetGameState();
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        auto idx = timings.CurrentIdx;
+        gameState->UpdateLogic(&timings);
+
+        double previous = 0;
+        for (size_t j = 0; j < std::size(LogicTimePartNames); j++)
+        {
+            auto elapsed = timings.TimingInfo[LogicTimePartNames[j].first][idx].count();
+            partTotals[j] += std::max(0.0, elapsed - previous);
+            previous = std::max(previous, elapsed);
+        }
+        pluginTotal += timings.PluginTime[idx].count();
+    }
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - startTime;
+
+    json_t timingsJson = json_t::object();
+    for (size_t j = 0; j < std::size(LogicTimePartNames); j++)
+    {
+        timingsJson[LogicTimePartNames[j].second] = partTotals[j] * 1000.0;
+    }
+
+    result["checksum"] = sprite_checksum().ToString();
+    result["duration_ms"] = duration.count() * 1000.0;
+    result["timings_ms"] = timingsJson;
+    // Plugin callbacks run during several of the parts, so this overlaps with the timings above
+    result["plugin_time_ms"] = pluginTotal * 1000.0;
+    result["stats"] = {
+        { "guests", gNumGuestsInPark },
+        { "park_rating", gParkRating },
+        { "cash", gCash },
+        { "park_value", gParkValue },
+        { "company_value", gCompanyValue },
+        { "rides", GetRideManager().size() },
+        { "months_elapsed", gDateMonthsElapsed },
+    };
+    return result;
+}
+
+/**
+ * Creates and initialises a headless context. Returns nullptr if the context could not be initialised.
+ */
+static std::unique_ptr<IContext> CreateSimulateBatchContext()
+{
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        return nullptr;
+    }
+    return context;
+}
+
+static json_t SimulateBatchError(const SimulateBatchRun& run, const char* error)
+{
+    json_t result = {
+        { "park", run.ParkPath },
+        { "error", error },
+    };
+    if (run.Seed)
+    {
+        result["seed"] = *run.Seed;
+    }
+    return result;
+}
+
+#ifndef _WIN32
+/**
+ * Simulation state is global, so every run gets its own forked worker. Workers are forked before this process
+ * creates a context, as initialising one starts threads whose locks a forked child could inherit in a locked state.
+ * Each worker initialises its own context, writes its JSON result to a pipe and exits without tearing the context
+ * down. The first worker runs on its own so that it builds any missing indexes before the other workers read them.
+ */
+static std::vector<json_t> SimulateBatchRuns(const std::vector<SimulateBatchRun>& runs, uint32_t ticks, size_t jobs)
+{
+    struct Worker
+    {
+        pid_t Pid;
+        int Fd;
+        size_t RunIndex;
+        std::string Output;
+    };
+
+    std::vector<json_t> results(runs.size());
+    std::vector<Worker> workers;
+    size_t nextRun = 0;
+    size_t numCompleted = 0;
+    while (nextRun < runs.size() || !workers.empty())
+    {
+        while (nextRun < runs.size() && workers.size() < (numCompleted == 0 ? 1 : jobs))
+        {
+            const auto& run = runs[nextRun];
+            int fds[2];
+            if (pipe(fds) != 0)
+            {
+                results[nextRun++] = SimulateBatchError(run, "Unable to create pipe.");
+                continue;
+            }
+
+            auto pid = fork();
+            if (pid == 0)
+            {
+                close(fds[0]);
+                auto context = CreateSimulateBatchContext();
+                auto output = context != nullptr ? SimulateBatchRunInContext(*context, run, ticks).dump()
+                                                 : SimulateBatchError(run, "Context initialization failed.").dump();
+                const char* data = output.data();
+                size_t remaining = output.size();
+                while (remaining > 0)
+                {
+                    auto written = write(fds[1], data, remaining);
+                    if (written <= 0)
+                    {
+                        _exit(EXIT_FAILURE);
+                    }
+                    data += written;
+                    remaining -= static_cast<size_t>(written);
+                }
+                close(fds[1]);
+                _exit(EXIT_SUCCESS);
+            }
+
+            close(fds[1]);
+            if (pid < 0)
+            {
+                close(fds[0]);
+                results[nextRun++] = SimulateBatchError(run, "Unable to fork worker.");
+                numCompleted++;
+                continue;
+            }
+            workers.push_back({ pid, fds[0], nextRun++, {} });
+        }
+
+        if (workers.empty())
+        {
+            continue;
+        }
+
+        std::vector<pollfd> pollFds;
+        for (const auto& worker : workers)
+        {
+            pollFds.push_back({ worker.Fd, POLLIN, 0 });
+        }
+        if (poll(pollFds.data(), static_cast<nfds_t>(pollFds.size()), -1) < 0)
+        {
+            continue;
+        }
+
+        for (size_t i = pollFds.size(); i-- > 0;)
+        {
+            if (pollFds[i].revents == 0)
+            {
+                continue;
+            }
+
+            auto& worker = workers[i];
+            char buffer[4096];
+            auto bytesRead = read(worker.Fd, buffer, sizeof(buffer));
+            if (bytesRead > 0)
+            {
+                worker.Output.append(buffer, static_cast<size_t>(bytesRead));
+                continue;
+            }
+
+            close(worker.Fd);
+            int status = 0;
+            waitpid(worker.Pid, &status, 0);
+
+            const auto& run = runs[worker.RunIndex];
+            if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS)
+            {
+                try
+                {
+                    results[worker.RunIndex] = Json::FromString(worker.Output);
+                }
+                catch (const std::exception&)
+                {
+                    results[worker.RunIndex] = SimulateBatchError(run, "Worker returned malformed result.");
+                }
+            }
+            else
+            {
+                results[worker.RunIndex] = SimulateBatchError(run, "Worker terminated abnormally.");
+            }
+            Console::WriteLine("[%zu/%zu] %s", worker.RunIndex + 1, runs.size(), run.ParkPath.c_str());
+            workers.erase(workers.begin() + i);
+            numCompleted++;
+        }
+    }
+    return results;
+}
+#else
+static std::vector<json_t> SimulateBatchRuns(
+    const std::vector<SimulateBatchRun>& runs, uint32_t ticks, [[maybe_unused]] size_t jobs)
+{
+    // No fork on Windows, simulate the runs one after the other in this process.
+    std::vector<json_t> results;
+    auto context = CreateSimulateBatchContext();
+    for (const auto& run : runs)
+    {
+        if (context == nullptr)
+        {
+            results.push_back(SimulateBatchError(run, "Context initialization failed."));
+        }
+        else
+        {
+            results.push_back(SimulateBatchRunInContext(*context, run, ticks));
+        }
+        Console::WriteLine("[%zu/%zu] %s", results.size(), runs.size(), run.ParkPath.c_str());
+    }
+    return results;
+}
+#endif
+
+static exitcode_t HandleSimulateBatch(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    for (int32_t i = 0; i < argc; i++)
+    {
+        // Options can only be at the end of the command
+        if (argv[i][0] == '-')
+        {
+            argc = i;
+            break;
+        }
+    }
+
+    if (argc < 3)
+    {
+        Console::Error::WriteLine("Missing arguments <ticks> <output-json> <park-file>.");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    uint32_t ticks = atol(argv[0]);
+    const char* outputPath = argv[1];
+
+    std::vector<SimulateBatchRun> runs;
+    for (int32_t i = 2; i < argc; i++)
+    {
+        if (_batchSeeds > 0)
+        {
+            for (int32_t seed = 0; seed < _batchSeeds; seed++)
+            {
+                runs.push_back({ argv[i], static_cast<uint32_t>(seed) });
+            }
+        }
+        else
+        {
+            runs.push_back({ argv[i], std::nullopt });
+        }
+    }
+
+    size_t jobs = _batchJobs > 0 ? static_cast<size_t>(_batchJobs) : std::max(1u, std::thread::hardware_concurrency());
+
+    Console::WriteLine("Running %zu simulations of %u ticks on %zu workers...", runs.size(), ticks, jobs);
+    auto startTime = std::chrono::high_resolution_clock::now();
+    auto results = SimulateBatchRuns(runs, ticks, jobs);
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - startTime;
+
+    size_t numFailed = 0;
+    json_t totalTimings = json_t::object();
+    double totalPluginTime = 0;
+    for (const auto& result : results)
+    {
+        if (result.contains("error"))
+        {
+            numFailed++;
+            continue;
+        }
+        for (const auto& [part, ms] : result["timings_ms"].items())
+        {
+            totalTimings[part] = Json::GetNumber<double>(totalTimings[part]) + ms.get<double>();
+        }
+        totalPluginTime += result.value("plugin_time_ms", 0.0);
+    }
+
+    json_t output = {
+        { "ticks", ticks },
+        { "jobs", jobs },
+        { "runs", results },
+        { "summary",
+          {
+              { "num_runs", results.size() },
+              { "num_failed", numFailed },
+              { "duration_ms", duration.count() * 1000.0 },
+              { "timings_ms", totalTimings },
+              { "plugin_time_ms", totalPluginTime },
+          } },
+    };
+
+    try
+    {
+        Json::WriteToFile(outputPath, output);
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to write %s: %s", outputPath, e.what());
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Completed %zu simulations (%zu failed) in %.2f s.", results.size(), numFailed, duration.count());
+    return numFailed == 0 ? EXITCODE_OK : EXITCODE_FAIL;
+}
@@ -224,6 +224,7 @@ namespace Config
             model->show_guest_purchases = reader->GetBoolean("show_guest_purchases", false);
             model->show_real_names_of_guests = reader->GetBoolean("show_real_names_of_guests", true);
             model->allow_early_completion = reader->GetBoolean("allow_early_completion", false);
+            model->watch_content_directories = reader->GetBoolean("watch_content_directories", false);
             model->transparent_screenshot = reader->GetBoolean("transparent_screenshot", true);
             model->transparent_water = reader->GetBoolean("transparent_water", true);
             model->last_version_check_time = reader->GetInt64("last_version_check_time", 0);
@@ -301,6 +302,7 @@ namespace Config
         writer->WriteBoolean("show_guest_purchases", model->show_guest_purchases);
         writer->WriteBoolean("show_real_names_of_guests", model->show_real_names_of_guests);
         writer->WriteBoolean("allow_early_completion", model->allow_early_completion);
+        writer->WriteBoolean("watch_content_directories", model->watch_content_directories);
         writer->WriteEnum<VirtualFloorStyles>("virtual_floor_style", model->virtual_floor_style, Enum_VirtualFloorStyle);
         writer->WriteBoolean("transparent_screenshot", model->transparent_screenshot);
         writer->WriteBoolean("transparent_water", model->transparent_water);
@@ -548,6 +550,8 @@ namespace Config
             auto model = &gConfigPlugin;
             model->enable_hot_reloading = reader->GetBoolean("enable_hot_reloading", false);
             model->allowed_hosts = reader->GetString("allowed_hosts", "");
+            model->frame_budget = reader->GetFloat("frame_budget", 5.0f);
+            model->throttle_over_budget = reader->GetBoolean("throttle_over_budget", false);
         }
     }
 
@@ -557,6 +561,8 @@ namespace Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->enable_hot_reloading);
         writer->WriteString("allowed_hosts", model->allowed_hosts);
+        writer->WriteFloat("frame_budget", model->frame_budget);
+        writer->WriteBoolean("throttle_over_budget", model->throttle_over_budget);
     }
 
     static bool SetDefaults()
@@ -97,6 +97,7 @@ struct GeneralConfiguration
     bool steam_overlay_pause;
     bool show_real_names_of_guests;
     bool allow_early_completion;
+    bool watch_content_directories;
 
     // Loading and saving
     bool confirmation_prompt;
@@ -208,6 +209,8 @@ struct PluginConfiguration
 {
     bool enable_hot_reloading;
     std::string allowed_hosts;
+    float frame_budget;
+    bool throttle_over_budget;
 };
 
 enum class Sort : int32_t
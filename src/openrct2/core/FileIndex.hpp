@@ -16,38 +16,33 @@
 #include "FileScanner.h"
 #include "FileStream.h"
 #include "JobPool.h"
-#include "Numerics.hpp"
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
+#include <cstring>
+#include <numeric>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
 {
-private:
-    struct DirectoryStats
-    {
-        uint32_t TotalFiles = 0;
-        uint64_t TotalFileSize = 0;
-        uint32_t FileDateModifiedChecksum = 0;
-        uint32_t PathChecksum = 0;
-    };
-
-    struct ScanResult
+public:
+    /**
+     * A file found in the search paths together with the item created from it. Files that did not
+     * produce an item are kept as well, so they are not parsed again until they change.
+     */
+    struct FileEntry
     {
-        DirectoryStats const Stats;
-        std::vector<std::string> const Files;
-
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
-            : Stats(stats)
-            , Files(files)
-        {
-        }
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+        bool HasItem = false;
+        TItem Item{};
     };
 
+private:
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -55,12 +50,11 @@ private:
         uint8_t VersionA = 0;
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
-        DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -96,32 +90,122 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries the directories and loads the index. Items of files that have not changed since the
+     * index was written are taken from the index, only new or modified files are loaded again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
-        auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto entries = Scan();
+        auto cachedEntries = ReadIndexFile(language);
+
+        std::vector<size_t> changed;
+        for (size_t i = 0; i < entries.size(); i++)
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
+            auto& entry = entries[i];
+            auto cached = cachedEntries.find(entry.Path);
+            if (cached != cachedEntries.end() && cached->second.Size == entry.Size
+                && cached->second.LastModified == entry.LastModified)
+            {
+                entry.HasItem = cached->second.HasItem;
+                entry.Item = std::move(cached->second.Item);
+                cachedEntries.erase(cached);
+            }
+            else
+            {
+                changed.push_back(i);
+            }
         }
-        else
+
+        // Anything left in the cached entries no longer exists
+        if (!changed.empty() || !cachedEntries.empty())
         {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            Build(language, entries, changed);
         }
-        return items;
+        return GetItems(entries);
     }
 
+    /**
+     * Ignores the index and loads every file again.
+     */
     std::vector<TItem> Rebuild(int32_t language) const
     {
-        auto scanResult = Scan();
-        auto items = Build(language, scanResult);
-        return items;
+        auto entries = Scan();
+        std::vector<size_t> all(entries.size());
+        std::iota(all.begin(), all.end(), 0);
+        Build(language, entries, all);
+        return GetItems(entries);
+    }
+
+    /**
+     * Brings the index up to date for the given files without scanning the search paths, e.g. when a
+     * file watcher reported them. Each path may have been added, modified or removed. Returns an entry
+     * for every file that actually changed, removed files and files that did not produce an item have
+     * no item. The index file is only written when an item was added, changed or removed.
+     */
+    std::vector<FileEntry> Update(int32_t language, const std::vector<std::string>& paths) const
+    {
+        std::vector<FileEntry> changes;
+        auto cachedEntries = ReadIndexFile(language);
+        for (const auto& changedPath : paths)
+        {
+            // Scanned paths are absolute, so the index is keyed by absolute paths
+            auto path = Path::GetAbsolute(changedPath);
+            if (!Path::MatchesPattern(path, _pattern))
+            {
+                continue;
+            }
+
+            auto cached = cachedEntries.find(path);
+            if (File::Exists(path))
+            {
+                FileEntry entry;
+                entry.Path = path;
+                entry.Size = File::GetSize(path);
+                entry.LastModified = File::GetLastModified(path);
+                if (cached != cachedEntries.end() && cached->second.Size == entry.Size
+                    && cached->second.LastModified == entry.LastModified)
+                {
+                    continue;
+                }
+
+                log_verbose("FileIndex:Indexing '%s'", path.c_str());
+                auto item = Create(language, path);
+                entry.HasItem = std::get<0>(item);
+                if (entry.HasItem)
+                {
+                    entry.Item = std::move(std::get<1>(item));
+                }
+
+                // Saving a file without changing what is indexed from it, e.g. touching it, is not worth
+                // rewriting the index for. The stale time only costs indexing the file again next start.
+                if (cached != cachedEntries.end() && cached->second.HasItem == entry.HasItem
+                    && (!entry.HasItem || IsSameItem(cached->second.Item, entry.Item)))
+                {
+                    continue;
+                }
+                cachedEntries[path] = entry;
+                changes.push_back(std::move(entry));
+            }
+            else if (cached != cachedEntries.end())
+            {
+                cachedEntries.erase(cached);
+
+                auto& entry = changes.emplace_back();
+                entry.Path = path;
+            }
+        }
+
+        if (!changes.empty())
+        {
+            std::vector<FileEntry> entries;
+            entries.reserve(cachedEntries.size());
+            for (auto& kvp : cachedEntries)
+            {
+                entries.push_back(std::move(kvp.second));
+            }
+            WriteIndexFile(language, entries);
+        }
+        return changes;
     }
 
 protected:
@@ -137,10 +221,22 @@ protected:
     virtual void Serialise(DataSerialiser& ds, TItem& item) const abstract;
 
 private:
-    ScanResult Scan() const
+    bool IsSameItem(TItem& a, TItem& b) const
+    {
+        DataSerialiser dsA(true);
+        Serialise(dsA, a);
+        DataSerialiser dsB(true);
+        Serialise(dsB, b);
+
+        const auto& streamA = dsA.GetStream();
+        const auto& streamB = dsB.GetStream();
+        return streamA.GetLength() == streamB.GetLength()
+            && std::memcmp(streamA.GetData(), streamB.GetData(), static_cast<size_t>(streamA.GetLength())) == 0;
+    }
+
+    std::vector<FileEntry> Scan() const
     {
-        DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<FileEntry> entries;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -151,61 +247,63 @@ private:
             while (scanner->Next())
             {
                 auto fileInfo = scanner->GetFileInfo();
-                auto path = std::string(scanner->GetPath());
 
-                stats.TotalFiles++;
-                stats.TotalFileSize += fileInfo->Size;
-                stats.FileDateModifiedChecksum ^= static_cast<uint32_t>(fileInfo->LastModified >> 32)
-                    ^ static_cast<uint32_t>(fileInfo->LastModified & 0xFFFFFFFF);
-                stats.FileDateModifiedChecksum = Numerics::ror32(stats.FileDateModifiedChecksum, 5);
-                stats.PathChecksum += GetPathChecksum(path);
-
-                files.push_back(std::move(path));
+                auto& entry = entries.emplace_back();
+                entry.Path = scanner->GetPath();
+                entry.Size = fileInfo->Size;
+                entry.LastModified = fileInfo->LastModified;
             }
         }
-        return ScanResult(stats, files);
+        return entries;
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, std::vector<FileEntry>& entries, const std::vector<size_t>& indices, size_t rangeStart,
+        size_t rangeEnd, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            auto& entry = entries.at(indices.at(i));
 
             if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
                 std::lock_guard<std::mutex> lock(printLock);
-                log_verbose("FileIndex:Indexing '%s'", filePath.c_str());
+                log_verbose("FileIndex:Indexing '%s'", entry.Path.c_str());
             }
 
-            auto item = Create(language, filePath);
-            if (std::get<0>(item))
+            auto item = Create(language, entry.Path);
+            entry.HasItem = std::get<0>(item);
+            if (entry.HasItem)
             {
-                items.push_back(std::get<1>(item));
+                entry.Item = std::move(std::get<1>(item));
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Creates the items for the entries at the given indices and writes the updated index.
+     */
+    void Build(int32_t language, std::vector<FileEntry>& entries, const std::vector<size_t>& indices) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        if (indices.size() == entries.size())
+        {
+            Console::WriteLine("Building %s (%zu items)", _name.c_str(), entries.size());
+        }
+        else
+        {
+            Console::WriteLine("Updating %s (%zu of %zu items)", _name.c_str(), indices.size(), entries.size());
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
+        const size_t totalCount = indices.size();
         if (totalCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
-
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
             std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
@@ -222,36 +320,45 @@ private:
                     stepSize = totalCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
-
+                // Every job writes to its own set of entries
                 jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                    &FileIndex<TItem>::BuildRange, this, language, std::ref(entries), std::cref(indices), rangeStart,
+                    rangeStart + stepSize, std::ref(processed), std::ref(printLock)));
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
-
-            for (const auto& itr : containers)
-            {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
-            }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, entries);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
         Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
-
-        return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    static std::vector<TItem> GetItems(std::vector<FileEntry>& entries)
     {
-        bool loadedItems = false;
         std::vector<TItem> items;
+        items.reserve(entries.size());
+        for (auto& entry : entries)
+        {
+            if (entry.HasItem)
+            {
+                items.push_back(std::move(entry.Item));
+            }
+        }
+        return items;
+    }
+
+    /**
+     * Reads the entries of the index file, keyed by path. Returns nothing if the file is missing
+     * or was written by a different version or for a different language.
+     */
+    std::unordered_map<std::string, FileEntry> ReadIndexFile(int32_t language) const
+    {
+        std::unordered_map<std::string, FileEntry> entries;
         if (File::Exists(_indexPath))
         {
             try
@@ -259,24 +366,19 @@ private:
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    entries.reserve(header.NumFiles);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    for (uint32_t i = 0; i < header.NumFiles; i++)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        FileEntry entry;
+                        SerialiseEntry(ds, entry);
+                        auto path = entry.Path;
+                        entries.emplace(std::move(path), std::move(entry));
                     }
-                    loadedItems = true;
                 }
                 else
                 {
@@ -287,12 +389,13 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                entries.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return entries;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, std::vector<FileEntry>& entries) const
     {
         try
         {
@@ -306,15 +409,14 @@ private:
             header.VersionA = FILE_INDEX_VERSION;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumFiles = static_cast<uint32_t>(entries.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (auto& item : items)
+            // Write entries
+            for (auto& entry : entries)
             {
-                Serialise(ds, item);
+                SerialiseEntry(ds, entry);
             }
         }
         catch (const std::exception& e)
@@ -324,18 +426,15 @@ private:
         }
     }
 
-    static uint32_t GetPathChecksum(const std::string& path)
+    void SerialiseEntry(DataSerialiser& ds, FileEntry& entry) const
     {
-        uint32_t hash = 0xD8430DED;
-        for (const utf8* ch = path.c_str(); *ch != '\0'; ch++)
+        ds << entry.Path;
+        ds << entry.Size;
+        ds << entry.LastModified;
+        ds << entry.HasItem;
+        if (entry.HasItem)
         {
-            hash += (*ch);
-            hash += (hash << 10);
-            hash ^= (hash >> 6);
+            Serialise(ds, entry.Item);
         }
-        hash += (hash << 3);
-        hash ^= (hash >> 11);
-        hash += (hash << 15);
-        return hash;
     }
 };
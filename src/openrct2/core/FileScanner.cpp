@@ -369,6 +369,19 @@ void Path::QueryDirectory(QueryDirectoryResult* result, const std::string& patte
     }
 }
 
+bool Path::MatchesPattern(const std::string& path, const std::string& patterns)
+{
+    auto fileName = Path::GetFileName(path);
+    for (const auto& pattern : String::Split(patterns, ";"))
+    {
+        if (!pattern.empty() && MatchWildcard(fileName.c_str(), pattern.c_str()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::vector<std::string> Path::GetDirectories(const std::string& path)
 {
     auto scanner = ScanDirectory(path, false);
@@ -60,5 +60,12 @@ namespace Path
      */
     void QueryDirectory(QueryDirectoryResult* result, const std::string& pattern);
 
+    /**
+     * Checks whether the file name of the given path matches any of the given patterns.
+     * @param path The path of the file.
+     * @param patterns A semi-colon delimited list of wildcard patterns.
+     */
+    [[nodiscard]] bool MatchesPattern(const std::string& path, const std::string& patterns);
+
     [[nodiscard]] std::vector<std::string> GetDirectories(const std::string& path);
 } // namespace Path
@@ -60,7 +60,7 @@ void FileWatcher::FileDescriptor::Close()
 
 FileWatcher::WatchDescriptor::WatchDescriptor(int fd, const std::string& path)
     : Fd(fd)
-    , Wd(inotify_add_watch(fd, path.c_str(), IN_CLOSE_WRITE))
+    , Wd(inotify_add_watch(fd, path.c_str(), IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE))
     , Path(path)
 {
     if (Wd >= 0)
@@ -134,8 +134,8 @@ void FileWatcher::WatchDirectory()
     std::array<char, 1024> eventData;
     DWORD bytesReturned;
     while (ReadDirectoryChangesW(
-        _directoryHandle, eventData.data(), static_cast<DWORD>(eventData.size()), TRUE, FILE_NOTIFY_CHANGE_LAST_WRITE,
-        &bytesReturned, nullptr, nullptr))
+        _directoryHandle, eventData.data(), static_cast<DWORD>(eventData.size()), TRUE,
+        FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME, &bytesReturned, nullptr, nullptr))
     {
         auto onFileChanged = OnFileChanged;
         if (onFileChanged)
@@ -170,19 +170,32 @@ void FileWatcher::WatchDirectory()
                 while (offset < length)
                 {
                     auto e = reinterpret_cast<inotify_event*>(eventData.data() + offset);
-                    if ((e->mask & IN_CLOSE_WRITE) && !(e->mask & IN_ISDIR))
+
+                    // Find watch descriptor
+                    int wd = e->wd;
+                    auto findResult = std::find_if(
+                        _watchDescs.begin(), _watchDescs.end(),
+                        [wd](const WatchDescriptor& watchDesc) { return wd == watchDesc.Wd; });
+                    if (findResult != _watchDescs.end())
                     {
-                        log_verbose("FileWatcher: inotify event received for %s", e->name);
-
-                        // Find watch descriptor
-                        int wd = e->wd;
-                        auto findResult = std::find_if(
-                            _watchDescs.begin(), _watchDescs.end(),
-                            [wd](const WatchDescriptor& watchDesc) { return wd == watchDesc.Wd; });
-                        if (findResult != _watchDescs.end())
+                        auto path = fs::path(findResult->Path) / fs::path(e->name);
+                        if (e->mask & IN_ISDIR)
+                        {
+                            // Watch directories that are created or moved into the tree
+                            if (e->mask & (IN_CREATE | IN_MOVED_TO))
+                            {
+                                try
+                                {
+                                    _watchDescs.emplace_back(_fileDesc.Fd, path.string());
+                                }
+                                catch (const std::exception&)
+                                {
+                                }
+                            }
+                        }
+                        else if (e->mask & (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE))
                         {
-                            auto directory = findResult->Path;
-                            auto path = fs::path(directory) / fs::path(e->name);
+                            log_verbose("FileWatcher: inotify event received for %s", e->name);
                             onFileChanged(path);
                         }
                     }
@@ -196,3 +209,37 @@ void FileWatcher::WatchDirectory()
     }
 #endif
 }
+
+FileChangeCollector::FileChangeCollector(const std::vector<std::string>& directoryPaths)
+{
+    for (const auto& directoryPath : directoryPaths)
+    {
+        try
+        {
+            auto watcher = std::make_unique<FileWatcher>(directoryPath);
+            watcher->OnFileChanged = [this](const std::string& path) {
+                std::lock_guard<std::mutex> guard(_changedFilesMutex);
+                _changedFiles.emplace(path);
+            };
+            _watchers.push_back(std::move(watcher));
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("FileChangeCollector: unable to watch '%s': %s", directoryPath.c_str(), e.what());
+        }
+    }
+}
+
+bool FileChangeCollector::HasChanges()
+{
+    std::lock_guard<std::mutex> guard(_changedFilesMutex);
+    return !_changedFiles.empty();
+}
+
+std::vector<std::string> FileChangeCollector::TakeChanges()
+{
+    std::lock_guard<std::mutex> guard(_changedFilesMutex);
+    std::vector<std::string> changes(_changedFiles.begin(), _changedFiles.end());
+    _changedFiles.clear();
+    return changes;
+}
@@ -10,8 +10,12 @@
 #pragma once
 
 #include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_set>
 #include <vector>
 
 #ifdef _WIN32
@@ -19,7 +23,7 @@ typedef void* HANDLE;
 #endif
 
 /**
- * Creates a new thread that watches a directory tree for file modifications.
+ * Creates a new thread that watches a directory tree for files being modified, added or removed.
  */
 class FileWatcher
 {
@@ -49,7 +53,8 @@ private:
     };
 
     FileDescriptor _fileDesc;
-    std::vector<WatchDescriptor> _watchDescs;
+    // A list so that adding watches never copies (and thereby removes) existing ones
+    std::list<WatchDescriptor> _watchDescs;
 #endif
 
 public:
@@ -65,3 +70,22 @@ private:
 
     void WatchDirectory();
 };
+
+/**
+ * Watches a set of directory trees and collects the paths of changed files until they are taken.
+ * Directories that can not be watched are skipped.
+ */
+class FileChangeCollector
+{
+private:
+    std::mutex _changedFilesMutex;
+    std::unordered_set<std::string> _changedFiles;
+    // Declared last so the watch threads are stopped before the collection is destroyed
+    std::vector<std::unique_ptr<FileWatcher>> _watchers;
+
+public:
+    explicit FileChangeCollector(const std::vector<std::string>& directoryPaths);
+
+    bool HasChanges();
+    std::vector<std::string> TakeChanges();
+};
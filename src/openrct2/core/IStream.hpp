@@ -233,12 +233,12 @@ private:
     class vector_streambuf : public std::basic_streambuf<char, std::char_traits<char>>
     {
     public:
-        explicit vector_streambuf(const std::vector<T>& vec)
+        vector_streambuf(const T* data, size_t size)
         {
             this->setg(
-                reinterpret_cast<char*>(const_cast<unsigned char*>(vec.data())),
-                reinterpret_cast<char*>(const_cast<unsigned char*>(vec.data())),
-                reinterpret_cast<char*>(const_cast<unsigned char*>(vec.data() + vec.size())));
+                reinterpret_cast<char*>(const_cast<unsigned char*>(data)),
+                reinterpret_cast<char*>(const_cast<unsigned char*>(data)),
+                reinterpret_cast<char*>(const_cast<unsigned char*>(data + size)));
         }
     };
 
@@ -246,8 +246,13 @@ private:
 
 public:
     ivstream(const std::vector<T>& vec)
+        : ivstream(vec.data(), vec.size())
+    {
+    }
+
+    ivstream(const T* data, size_t size)
         : std::istream(&_streambuf)
-        , _streambuf(vec)
+        , _streambuf(data, size)
     {
     }
 };
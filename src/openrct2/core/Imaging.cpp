@@ -328,6 +328,12 @@ namespace Imaging
         return ReadFromStream(istream, format);
     }
 
+    Image ReadFromBuffer(const void* data, size_t size, IMAGE_FORMAT format)
+    {
+        ivstream<uint8_t> istream(static_cast<const uint8_t*>(data), size);
+        return ReadFromStream(istream, format);
+    }
+
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format)
     {
         switch (format)
@@ -0,0 +1,331 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "JsonReader.h"
+
+#include "String.hpp"
+
+#include <stdexcept>
+
+using namespace Json;
+
+Reader::Reader(std::string_view text)
+    : _text(text)
+{
+    // Skip the UTF-8 byte order mark some editors add
+    if (_text.size() >= 3 && _text.compare(0, 3, "\xEF\xBB\xBF") == 0)
+    {
+        _position = 3;
+    }
+}
+
+ValueType Reader::Peek()
+{
+    auto c = SkipWhitespace();
+    switch (c)
+    {
+        case '"':
+            return ValueType::String;
+        case '{':
+            return ValueType::Object;
+        case '[':
+            return ValueType::Array;
+        case 't':
+        case 'f':
+            return ValueType::Boolean;
+        case 'n':
+            return ValueType::Null;
+        default:
+            if (c == '-' || (c >= '0' && c <= '9'))
+            {
+                return ValueType::Number;
+            }
+            ThrowError("Expected a value");
+    }
+}
+
+size_t Reader::GetPosition()
+{
+    SkipWhitespace();
+    return _position;
+}
+
+bool Reader::BeginObject()
+{
+    if (Peek() != ValueType::Object)
+    {
+        Skip();
+        return false;
+    }
+    _position++;
+    return true;
+}
+
+bool Reader::NextMember(std::string& key)
+{
+    auto c = SkipWhitespace();
+    if (c == ',')
+    {
+        _position++;
+        c = SkipWhitespace();
+    }
+    if (c == '}')
+    {
+        _position++;
+        return false;
+    }
+    key.clear();
+    ReadStringInto(&key);
+    SkipWhitespace();
+    Expect(':');
+    return true;
+}
+
+bool Reader::BeginArray()
+{
+    if (Peek() != ValueType::Array)
+    {
+        Skip();
+        return false;
+    }
+    _position++;
+    return true;
+}
+
+bool Reader::NextElement()
+{
+    auto c = SkipWhitespace();
+    if (c == ',')
+    {
+        _position++;
+        c = SkipWhitespace();
+    }
+    if (c == ']')
+    {
+        _position++;
+        return false;
+    }
+    return true;
+}
+
+std::optional<std::string> Reader::ReadString()
+{
+    if (Peek() != ValueType::String)
+    {
+        Skip();
+        return std::nullopt;
+    }
+    std::string result;
+    ReadStringInto(&result);
+    return result;
+}
+
+std::optional<bool> Reader::ReadBoolean()
+{
+    if (Peek() != ValueType::Boolean)
+    {
+        Skip();
+        return std::nullopt;
+    }
+    auto value = _text[_position] == 't';
+    Skip();
+    return value;
+}
+
+void Reader::Skip()
+{
+    switch (Peek())
+    {
+        case ValueType::String:
+            ReadStringInto(nullptr);
+            break;
+        case ValueType::Object:
+            _position++;
+            while (true)
+            {
+                auto c = SkipWhitespace();
+                if (c == ',')
+                {
+                    _position++;
+                    c = SkipWhitespace();
+                }
+                if (c == '}')
+                {
+                    _position++;
+                    break;
+                }
+                ReadStringInto(nullptr);
+                SkipWhitespace();
+                Expect(':');
+                Skip();
+            }
+            break;
+        case ValueType::Array:
+            _position++;
+            while (NextElement())
+            {
+                Skip();
+            }
+            break;
+        default:
+        {
+            // Numbers and literals run until the next delimiter
+            auto start = _position;
+            while (_position < _text.size())
+            {
+                auto c = _text[_position];
+                if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-' || c == '+'
+                      || c == '.'))
+                {
+                    break;
+                }
+                _position++;
+            }
+            if (_position == start)
+            {
+                ThrowError("Expected a value");
+            }
+            break;
+        }
+    }
+}
+
+char Reader::SkipWhitespace()
+{
+    while (_position < _text.size())
+    {
+        auto c = _text[_position];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+        {
+            return c;
+        }
+        _position++;
+    }
+    return '\0';
+}
+
+void Reader::Expect(char c)
+{
+    if (_position >= _text.size() || _text[_position] != c)
+    {
+        ThrowError(String::StdFormat("Expected '%c'", c).c_str());
+    }
+    _position++;
+}
+
+void Reader::ReadStringInto(std::string* dst)
+{
+    Expect('"');
+    while (true)
+    {
+        // Copy everything up to the next quote or escape in one go
+        auto end = _text.find_first_of("\"\\", _position);
+        if (end == std::string_view::npos)
+        {
+            ThrowError("Unterminated string");
+        }
+        if (dst != nullptr)
+        {
+            dst->append(_text.data() + _position, end - _position);
+        }
+        _position = end + 1;
+        if (_text[end] == '"')
+        {
+            return;
+        }
+
+        if (_position >= _text.size())
+        {
+            ThrowError("Unterminated string");
+        }
+        auto escape = _text[_position++];
+        char c;
+        switch (escape)
+        {
+            case '"':
+            case '\\':
+            case '/':
+                c = escape;
+                break;
+            case 'b':
+                c = '\b';
+                break;
+            case 'f':
+                c = '\f';
+                break;
+            case 'n':
+                c = '\n';
+                break;
+            case 'r':
+                c = '\r';
+                break;
+            case 't':
+                c = '\t';
+                break;
+            case 'u':
+            {
+                auto codepoint = ReadHex4();
+                if (codepoint >= 0xD800 && codepoint <= 0xDBFF)
+                {
+                    // High surrogate, the low one must follow it
+                    if (_text.compare(_position, 2, "\\u") != 0)
+                    {
+                        ThrowError("Invalid surrogate pair");
+                    }
+                    _position += 2;
+                    auto low = ReadHex4();
+                    if (low < 0xDC00 || low > 0xDFFF)
+                    {
+                        ThrowError("Invalid surrogate pair");
+                    }
+                    codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                }
+                if (dst != nullptr)
+                {
+                    String::AppendCodepoint(*dst, codepoint);
+                }
+                continue;
+            }
+            default:
+                ThrowError("Invalid escape sequence");
+        }
+        if (dst != nullptr)
+        {
+            dst->push_back(c);
+        }
+    }
+}
+
+uint32_t Reader::ReadHex4()
+{
+    if (_position + 4 > _text.size())
+    {
+        ThrowError("Invalid unicode escape");
+    }
+    uint32_t result = 0;
+    for (size_t i = 0; i < 4; i++)
+    {
+        auto c = _text[_position++];
+        result <<= 4;
+        if (c >= '0' && c <= '9')
+            result |= c - '0';
+        else if (c >= 'a' && c <= 'f')
+            result |= c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            result |= c - 'A' + 10;
+        else
+            ThrowError("Invalid unicode escape");
+    }
+    return result;
+}
+
+void Reader::ThrowError(const char* message) const
+{
+    throw std::runtime_error(String::StdFormat("%s at offset %zu.", message, _position));
+}
@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Json
+{
+    enum class ValueType : uint8_t
+    {
+        Null,
+        Boolean,
+        Number,
+        String,
+        Array,
+        Object,
+    };
+
+    /**
+     * Reads a JSON document one value at a time without building a json_t, for when only a few
+     * fields of a large document are needed. Values that are not asked for are skipped over.
+     * @note Malformed documents throw std::runtime_error.
+     */
+    class Reader
+    {
+    private:
+        std::string_view _text;
+        size_t _position{};
+
+    public:
+        explicit Reader(std::string_view text);
+
+        /**
+         * Gets the type of the next value.
+         */
+        ValueType Peek();
+
+        /**
+         * Gets the position of the next value, for reading it again later with a new reader.
+         */
+        size_t GetPosition();
+
+        /**
+         * Enters the next value if it is an object, otherwise skips it and returns false.
+         */
+        bool BeginObject();
+
+        /**
+         * Reads the key of the next member of the current object, returns false when the end
+         * of the object has been reached.
+         */
+        bool NextMember(std::string& key);
+
+        /**
+         * Enters the next value if it is an array, otherwise skips it and returns false.
+         */
+        bool BeginArray();
+
+        /**
+         * Moves to the next element of the current array, returns false when the end of the
+         * array has been reached.
+         */
+        bool NextElement();
+
+        /**
+         * Reads the next value if it is a string, otherwise skips it and returns no value.
+         */
+        std::optional<std::string> ReadString();
+
+        /**
+         * Reads the next value if it is a boolean, otherwise skips it and returns no value.
+         */
+        std::optional<bool> ReadBoolean();
+
+        /**
+         * Skips the next value, including everything inside it.
+         */
+        void Skip();
+
+    private:
+        char SkipWhitespace();
+        void Expect(char c);
+        void ReadStringInto(std::string* dst);
+        uint32_t ReadHex4();
+        [[noreturn]] void ThrowError(const char* message) const;
+    };
+} // namespace Json
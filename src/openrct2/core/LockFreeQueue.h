@@ -0,0 +1,87 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+/**
+ * Unbounded single producer, single consumer queue. One thread may push while another thread
+ * pops without either of them taking a lock. Elements are handed over in FIFO order.
+ */
+template<typename T> class LockFreeQueue
+{
+private:
+    struct Node
+    {
+        T Value{};
+        std::atomic<Node*> Next = { nullptr };
+    };
+
+    // Consumer owned, always points to a node whose value has already been consumed.
+    Node* _head;
+    // Producer owned, last node in the chain.
+    Node* _tail;
+
+public:
+    LockFreeQueue()
+        : _head(new Node())
+        , _tail(_head)
+    {
+    }
+
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    ~LockFreeQueue()
+    {
+        while (_head != nullptr)
+        {
+            auto next = _head->Next.load(std::memory_order_relaxed);
+            delete _head;
+            _head = next;
+        }
+    }
+
+    /**
+     * Producer side, appends a value to the end of the queue.
+     */
+    void push(T&& value)
+    {
+        auto node = new Node();
+        node->Value = std::move(value);
+        _tail->Next.store(node, std::memory_order_release);
+        _tail = node;
+    }
+
+    /**
+     * Consumer side, removes the value at the front of the queue if there is one.
+     */
+    bool try_pop(T& value)
+    {
+        auto next = _head->Next.load(std::memory_order_acquire);
+        if (next == nullptr)
+        {
+            return false;
+        }
+        value = std::move(next->Value);
+        delete _head;
+        _head = next;
+        return true;
+    }
+
+    /**
+     * Consumer side, whether there is nothing left to pop.
+     */
+    bool empty() const
+    {
+        return _head->Next.load(std::memory_order_acquire) == nullptr;
+    }
+};
@@ -0,0 +1,105 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryMappedFile.h"
+
+#include "IStream.hpp"
+#include "String.hpp"
+
+#ifdef _WIN32
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+{
+    auto pathW = String::ToWideChar(path);
+    auto fileHandle = CreateFileW(
+        pathW.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        throw IOException("Unable to open " + path);
+    }
+    _fileHandle = fileHandle;
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(fileHandle);
+        throw IOException("Unable to map empty file " + path);
+    }
+
+    auto mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr)
+    {
+        CloseHandle(fileHandle);
+        throw IOException("Unable to map " + path);
+    }
+    _mappingHandle = mappingHandle;
+
+    auto view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        throw IOException("Unable to map " + path);
+    }
+    _data = static_cast<const uint8_t*>(view);
+    _size = static_cast<size_t>(fileSize.QuadPart);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    UnmapViewOfFile(_data);
+    CloseHandle(_mappingHandle);
+    CloseHandle(_fileHandle);
+}
+#else
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw IOException("Unable to open " + path);
+    }
+
+    struct stat statInfo;
+    if (fstat(fd, &statInfo) != 0 || statInfo.st_size == 0)
+    {
+        close(fd);
+        throw IOException("Unable to map empty file " + path);
+    }
+
+    auto size = static_cast<size_t>(statInfo.st_size);
+    auto view = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (view == MAP_FAILED)
+    {
+        throw IOException("Unable to map " + path);
+    }
+    _data = static_cast<const uint8_t*>(view);
+    _size = size;
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    munmap(const_cast<uint8_t*>(_data), _size);
+}
+#endif
@@ -0,0 +1,48 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+
+/**
+ * Maps a whole file into memory for reading. The pages are backed by the file itself, so every process
+ * that maps the same file shares them through the operating system's page cache.
+ */
+class MemoryMappedFile
+{
+private:
+    const uint8_t* _data{};
+    size_t _size{};
+#ifdef _WIN32
+    void* _fileHandle{};
+    void* _mappingHandle{};
+#endif
+
+public:
+    /**
+     * Throws an IOException if the file can not be opened or mapped.
+     */
+    explicit MemoryMappedFile(const std::string& path);
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    ~MemoryMappedFile();
+
+    const uint8_t* GetData() const
+    {
+        return _data;
+    }
+
+    size_t GetSize() const
+    {
+        return _size;
+    }
+};
@@ -9,9 +9,15 @@
 
 #include "Zip.h"
 
+#include "File.h"
 #include "IStream.hpp"
+#include "MemoryMappedFile.h"
 
 #include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #ifndef __ANDROID__
 #    include <zip.h>
 #endif
@@ -65,15 +71,55 @@ bool IZipArchive::Exists(std::string_view path) const
     return GetIndexFromPath(path).has_value();
 }
 
+bool IZipArchive::ReadFileData(size_t index, void* dst, size_t dstSize) const
+{
+    auto data = GetFileData(GetFileName(index));
+    if (data.size() != dstSize)
+    {
+        return false;
+    }
+    std::memcpy(dst, data.data(), dstSize);
+    return true;
+}
+
+std::shared_ptr<const uint8_t> IZipArchive::GetMappedFileData([[maybe_unused]] size_t index) const
+{
+    return nullptr;
+}
+
 #ifndef __ANDROID__
 
+static uint16_t ReadUInt16(const uint8_t* src)
+{
+    return static_cast<uint16_t>(src[0] | (src[1] << 8));
+}
+
+static uint32_t ReadUInt32(const uint8_t* src)
+{
+    return src[0] | (src[1] << 8) | (src[2] << 16) | (static_cast<uint32_t>(src[3]) << 24);
+}
+
 class ZipArchive final : public IZipArchive
 {
 private:
+    struct StoredFile
+    {
+        size_t Offset;
+        size_t Size;
+    };
+
     zip_t* _zip;
     ZIP_ACCESS _access;
     std::vector<std::vector<uint8_t>> _writeBuffers;
 
+    // libzip handles can not be used from more than one thread at a time
+    mutable std::mutex _mutex;
+
+    // Only kept for archives opened for reading, as they can not change
+    std::unordered_map<std::string, size_t> _indexByPath;
+    std::shared_ptr<MemoryMappedFile> _file;
+    std::unordered_map<std::string, StoredFile> _storedFiles;
+
 public:
     ZipArchive(std::string_view path, ZIP_ACCESS access)
     {
@@ -91,6 +137,32 @@ public:
         }
 
         _access = access;
+        if (access == ZIP_ACCESS::READ)
+        {
+            BuildIndex();
+        }
+    }
+
+    /**
+     * Opens an archive for reading from a memory mapping of it, which does not keep a file handle open.
+     */
+    explicit ZipArchive(std::shared_ptr<MemoryMappedFile> file)
+        : _access(ZIP_ACCESS::READ)
+        , _file(std::move(file))
+    {
+        zip_error_t error;
+        zip_error_init(&error);
+        auto source = zip_source_buffer_create(_file->GetData(), _file->GetSize(), 0, &error);
+        _zip = source != nullptr ? zip_open_from_source(source, ZIP_RDONLY, &error) : nullptr;
+        zip_error_fini(&error);
+        if (_zip == nullptr)
+        {
+            zip_source_free(source);
+            throw IOException("Unable to open zip file.");
+        }
+
+        BuildIndex();
+        FindStoredFiles();
     }
 
     ~ZipArchive() override
@@ -100,29 +172,35 @@ public:
 
     size_t GetNumFiles() const override
     {
+        std::lock_guard<std::mutex> lock(_mutex);
         return zip_get_num_entries(_zip, 0);
     }
 
     std::string GetFileName(size_t index) const override
     {
-        std::string result;
-        auto name = zip_get_name(_zip, index, ZIP_FL_ENC_GUESS);
-        if (name != nullptr)
-        {
-            result = name;
-        }
-        return result;
+        std::lock_guard<std::mutex> lock(_mutex);
+        return GetFileNameUnlocked(index);
     }
 
     uint64_t GetFileSize(size_t index) const override
     {
-        zip_stat_t zipFileStat;
-        if (zip_stat_index(_zip, index, 0, &zipFileStat) == ZIP_ER_OK)
+        std::lock_guard<std::mutex> lock(_mutex);
+        return GetFileSizeUnlocked(index);
+    }
+
+    std::optional<size_t> GetIndexFromPath(std::string_view path) const override
+    {
+        if (_access != ZIP_ACCESS::READ)
         {
-            return zipFileStat.size;
+            return IZipArchive::GetIndexFromPath(path);
         }
 
-        return 0;
+        auto it = _indexByPath.find(NormalisePath(path));
+        if (it == _indexByPath.end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
     }
 
     std::vector<uint8_t> GetFileData(std::string_view path) const override
@@ -134,28 +212,65 @@ public:
             auto dataSize = GetFileSize(index.value());
             if (dataSize > 0 && dataSize < SIZE_MAX)
             {
-                auto zipFile = zip_fopen_index(_zip, index.value(), 0);
-                if (zipFile != nullptr)
+                result.resize(static_cast<size_t>(dataSize));
+                if (!ReadFileData(index.value(), result.data(), result.size()))
                 {
-                    result.resize(static_cast<size_t>(dataSize));
-                    uint64_t readBytes = zip_fread(zipFile, result.data(), dataSize);
-                    if (readBytes != dataSize)
-                    {
-                        result = {};
-                    }
-                    zip_fclose(zipFile);
+                    result = {};
                 }
             }
         }
         return result;
     }
 
+    bool ReadFileData(size_t index, void* dst, size_t dstSize) const override
+    {
+        auto mappedData = GetMappedFileData(index);
+        if (mappedData != nullptr)
+        {
+            if (GetFileSize(index) != dstSize)
+            {
+                return false;
+            }
+            std::memcpy(dst, mappedData.get(), dstSize);
+            return true;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (GetFileSizeUnlocked(index) != dstSize)
+        {
+            return false;
+        }
+        auto zipFile = zip_fopen_index(_zip, index, 0);
+        if (zipFile == nullptr)
+        {
+            return false;
+        }
+        auto readBytes = zip_fread(zipFile, dst, dstSize);
+        zip_fclose(zipFile);
+        return readBytes >= 0 && static_cast<uint64_t>(readBytes) == dstSize;
+    }
+
+    std::shared_ptr<const uint8_t> GetMappedFileData(size_t index) const override
+    {
+        if (_storedFiles.empty())
+        {
+            return nullptr;
+        }
+
+        auto it = _storedFiles.find(NormalisePath(GetFileName(index)));
+        if (it == _storedFiles.end())
+        {
+            return nullptr;
+        }
+        return std::shared_ptr<const uint8_t>(_file, _file->GetData() + it->second.Offset);
+    }
+
     std::unique_ptr<IStream> GetFileStream(std::string_view path) const override
     {
         auto index = GetIndexFromPath(path);
         if (index.has_value())
         {
-            return std::make_unique<ZipItemStream>(_zip, index.value());
+            return std::make_unique<ZipItemStream>(_zip, _mutex, index.value());
         }
         return {};
     }
@@ -167,8 +282,9 @@ public:
         _writeBuffers.push_back(std::move(data));
         const auto& writeBuffer = *_writeBuffers.rbegin();
 
-        auto source = zip_source_buffer(_zip, writeBuffer.data(), writeBuffer.size(), 0);
         auto index = GetIndexFromPath(path);
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto source = zip_source_buffer(_zip, writeBuffer.data(), writeBuffer.size(), 0);
         if (index.has_value())
         {
             zip_replace(_zip, index.value(), source);
@@ -184,6 +300,7 @@ public:
         auto index = GetIndexFromPath(path);
         if (index.has_value())
         {
+            std::lock_guard<std::mutex> lock(_mutex);
             zip_delete(_zip, index.value());
         }
         else
@@ -197,6 +314,7 @@ public:
         auto index = GetIndexFromPath(path);
         if (index)
         {
+            std::lock_guard<std::mutex> lock(_mutex);
             zip_file_rename(_zip, *index, newPath.data(), ZIP_FL_ENC_GUESS);
         }
         else
@@ -205,19 +323,130 @@ public:
         }
     }
 
+private:
+    std::string GetFileNameUnlocked(size_t index) const
+    {
+        std::string result;
+        auto name = zip_get_name(_zip, index, ZIP_FL_ENC_GUESS);
+        if (name != nullptr)
+        {
+            result = name;
+        }
+        return result;
+    }
+
+    uint64_t GetFileSizeUnlocked(size_t index) const
+    {
+        zip_stat_t zipFileStat;
+        if (zip_stat_index(_zip, index, 0, &zipFileStat) == ZIP_ER_OK)
+        {
+            return zipFileStat.size;
+        }
+
+        return 0;
+    }
+
+    void BuildIndex()
+    {
+        // The first file wins if several have the same normalised path, as with IZipArchive::GetIndexFromPath
+        auto numFiles = static_cast<size_t>(zip_get_num_entries(_zip, 0));
+        _indexByPath.reserve(numFiles);
+        for (size_t i = 0; i < numFiles; i++)
+        {
+            _indexByPath.emplace(NormalisePath(GetFileNameUnlocked(i)), i);
+        }
+    }
+
+    /**
+     * libzip does not say where the data of a file starts, so the central directory is read from the
+     * mapping to find the files that are stored uncompressed. Anything unusual is left to libzip.
+     */
+    void FindStoredFiles()
+    {
+        constexpr size_t EndRecordSize = 22;
+        constexpr size_t DirectoryRecordSize = 46;
+        constexpr size_t LocalRecordSize = 30;
+
+        auto data = _file->GetData();
+        auto size = _file->GetSize();
+        if (size < EndRecordSize)
+        {
+            return;
+        }
+
+        // The end of central directory record is followed by a comment of up to 64 KiB
+        size_t endRecord = size - EndRecordSize;
+        while (ReadUInt32(data + endRecord) != 0x06054B50)
+        {
+            if (endRecord == 0 || size - EndRecordSize - endRecord >= 0xFFFF)
+            {
+                return;
+            }
+            endRecord--;
+        }
+
+        auto numEntries = ReadUInt16(data + endRecord + 10);
+        size_t directorySize = ReadUInt32(data + endRecord + 12);
+        size_t directoryOffset = ReadUInt32(data + endRecord + 16);
+        if (directoryOffset > endRecord || directorySize > endRecord - directoryOffset)
+        {
+            return;
+        }
+
+        auto directoryEnd = directoryOffset + directorySize;
+        auto record = directoryOffset;
+        for (uint16_t i = 0; i < numEntries; i++)
+        {
+            if (directoryEnd - record < DirectoryRecordSize || ReadUInt32(data + record) != 0x02014B50)
+            {
+                return;
+            }
+
+            auto flags = ReadUInt16(data + record + 8);
+            auto method = ReadUInt16(data + record + 10);
+            size_t compressedSize = ReadUInt32(data + record + 20);
+            size_t uncompressedSize = ReadUInt32(data + record + 24);
+            size_t nameLength = ReadUInt16(data + record + 28);
+            size_t extraLength = ReadUInt16(data + record + 30);
+            size_t commentLength = ReadUInt16(data + record + 32);
+            size_t localOffset = ReadUInt32(data + record + 42);
+            auto recordSize = DirectoryRecordSize + nameLength + extraLength + commentLength;
+            if (directoryEnd - record < recordSize)
+            {
+                return;
+            }
+
+            // Stored, not encrypted and with the local header inside the file
+            if (method == ZIP_CM_STORE && (flags & 1) == 0 && compressedSize == uncompressedSize
+                && localOffset <= size - LocalRecordSize && ReadUInt32(data + localOffset) == 0x04034B50)
+            {
+                auto dataOffset = localOffset + LocalRecordSize + ReadUInt16(data + localOffset + 26)
+                    + ReadUInt16(data + localOffset + 28);
+                if (dataOffset <= size && uncompressedSize <= size - dataOffset)
+                {
+                    auto name = std::string(reinterpret_cast<const char*>(data + record + DirectoryRecordSize), nameLength);
+                    _storedFiles.emplace(NormalisePath(name), StoredFile{ dataOffset, uncompressedSize });
+                }
+            }
+            record += recordSize;
+        }
+    }
+
 private:
     class ZipItemStream final : public IStream
     {
     private:
         zip* _zip;
+        std::mutex& _mutex;
         zip_int64_t _index;
         zip_file_t* _zipFile{};
         zip_uint64_t _len{};
         zip_uint64_t _pos{};
 
     public:
-        ZipItemStream(zip* zip, zip_int64_t index)
+        ZipItemStream(zip* zip, std::mutex& mutex, zip_int64_t index)
             : _zip(zip)
+            , _mutex(mutex)
             , _index(index)
         {
         }
@@ -299,6 +528,7 @@ private:
                 return 0;
             }
 
+            std::lock_guard<std::mutex> lock(_mutex);
             auto readBytes = zip_fread(_zipFile, buffer, length);
             if (readBytes < 0)
             {
@@ -319,6 +549,7 @@ private:
         {
             if (_zipFile != nullptr)
             {
+                std::lock_guard<std::mutex> lock(_mutex);
                 zip_fclose(_zipFile);
                 _zipFile = nullptr;
             }
@@ -328,6 +559,7 @@ private:
         {
             Close();
 
+            std::lock_guard<std::mutex> lock(_mutex);
             _pos = 0;
             _len = 0;
             _zipFile = zip_fopen_index(_zip, _index, 0);
@@ -351,6 +583,7 @@ private:
             // zip_fseek can not be used on compressed data, so skip bytes by
             // reading into a temporary buffer
             char buffer[2048]{};
+            std::lock_guard<std::mutex> lock(_mutex);
             while (len > 0)
             {
                 auto readLen = std::min<zip_int64_t>(len, sizeof(buffer));
@@ -388,3 +621,96 @@ namespace Zip
 } // namespace Zip
 
 #endif
+
+namespace Zip
+{
+    struct SharedArchive
+    {
+        std::string Path;
+        uint64_t Size;
+        uint64_t LastModified;
+        std::shared_ptr<const IZipArchive> Archive;
+    };
+
+    // Enough for every object of a large park, most recently used first
+    static constexpr size_t MaxSharedArchives = 256;
+
+    static std::mutex _sharedArchivesMutex;
+    static std::list<SharedArchive> _sharedArchives;
+    static size_t _numSharedArchiveScopes;
+
+    static std::shared_ptr<const IZipArchive> OpenArchiveForSharing(std::string_view path)
+    {
+        try
+        {
+#ifndef __ANDROID__
+            auto file = std::make_shared<MemoryMappedFile>(std::string(path));
+            return std::make_shared<ZipArchive>(std::move(file));
+#else
+            return Open(path, ZIP_ACCESS::READ);
+#endif
+        }
+        catch (const std::exception&)
+        {
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<const IZipArchive> OpenShared(std::string_view path)
+    {
+        auto pathString = std::string(path);
+        auto size = File::GetSize(pathString);
+        auto lastModified = File::GetLastModified(pathString);
+        {
+            std::lock_guard<std::mutex> lock(_sharedArchivesMutex);
+            auto it = std::find_if(_sharedArchives.begin(), _sharedArchives.end(), [&pathString](const SharedArchive& item) {
+                return item.Path == pathString;
+            });
+            if (it != _sharedArchives.end())
+            {
+                if (it->Size == size && it->LastModified == lastModified)
+                {
+                    _sharedArchives.splice(_sharedArchives.begin(), _sharedArchives, it);
+                    return it->Archive;
+                }
+                _sharedArchives.erase(it);
+            }
+        }
+
+        // Opened without the lock so that other archives can be opened at the same time
+        auto archive = OpenArchiveForSharing(path);
+        if (archive != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(_sharedArchivesMutex);
+            if (_numSharedArchiveScopes == 0)
+            {
+                return archive;
+            }
+            _sharedArchives.push_front({ std::move(pathString), size, lastModified, archive });
+            if (_sharedArchives.size() > MaxSharedArchives)
+            {
+                _sharedArchives.pop_back();
+            }
+        }
+        return archive;
+    }
+
+    SharedArchiveScope::SharedArchiveScope()
+    {
+        std::lock_guard<std::mutex> lock(_sharedArchivesMutex);
+        _numSharedArchiveScopes++;
+    }
+
+    SharedArchiveScope::~SharedArchiveScope()
+    {
+        // The archives are closed once the lock is released
+        std::list<SharedArchive> closing;
+        {
+            std::lock_guard<std::mutex> lock(_sharedArchivesMutex);
+            if (--_numSharedArchiveScopes == 0)
+            {
+                closing.swap(_sharedArchives);
+            }
+        }
+    }
+} // namespace Zip
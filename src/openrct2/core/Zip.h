@@ -47,8 +47,19 @@ struct IZipArchive
     virtual void DeleteFile(std::string_view path) abstract;
     virtual void RenameFile(std::string_view path, std::string_view newPath) abstract;
 
-    [[nodiscard]] std::optional<size_t> GetIndexFromPath(std::string_view path) const;
+    [[nodiscard]] virtual std::optional<size_t> GetIndexFromPath(std::string_view path) const;
     [[nodiscard]] bool Exists(std::string_view path) const;
+
+    /**
+     * Reads the file at the given index straight into dst, which must be the size of the file.
+     */
+    [[nodiscard]] virtual bool ReadFileData(size_t index, void* dst, size_t dstSize) const;
+
+    /**
+     * Gets the file at the given index from the archive's memory mapping if it is stored uncompressed,
+     * so it can be used without being copied. The data stays valid for as long as the pointer is held.
+     */
+    [[nodiscard]] virtual std::shared_ptr<const uint8_t> GetMappedFileData(size_t index) const;
 };
 
 enum class ZIP_ACCESS
@@ -61,4 +72,26 @@ namespace Zip
 {
     [[nodiscard]] std::unique_ptr<IZipArchive> Open(std::string_view path, ZIP_ACCESS zipAccess);
     [[nodiscard]] std::unique_ptr<IZipArchive> TryOpen(std::string_view path, ZIP_ACCESS zipAccess);
+
+    /**
+     * Opens an archive for reading. While a SharedArchiveScope exists the archive is kept open for the next
+     * caller, so that its central directory is only read again once the file has changed. Returns nullptr if
+     * the archive can not be opened.
+     */
+    [[nodiscard]] std::shared_ptr<const IZipArchive> OpenShared(std::string_view path);
+
+    /**
+     * Keeps the archives opened by OpenShared open until the last scope ends, e.g. for loading a batch of
+     * objects. Outside of a scope the archives are closed as soon as they are no longer used, so the files
+     * are not left mapped, which would stop them being replaced on Windows and fault reads if they are
+     * truncated elsewhere.
+     */
+    class SharedArchiveScope
+    {
+    public:
+        SharedArchiveScope();
+        SharedArchiveScope(const SharedArchiveScope&) = delete;
+        SharedArchiveScope& operator=(const SharedArchiveScope&) = delete;
+        ~SharedArchiveScope();
+    };
 } // namespace Zip
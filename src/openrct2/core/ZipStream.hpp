@@ -22,11 +22,11 @@ namespace OpenRCT2
     class ZipStreamWrapper final : public IStream
     {
     private:
-        std::unique_ptr<IZipArchive> _zipArchive;
+        std::shared_ptr<const IZipArchive> _zipArchive;
         std::unique_ptr<IStream> _base;
 
     public:
-        ZipStreamWrapper(std::unique_ptr<IZipArchive> zipArchive, std::unique_ptr<IStream> base)
+        ZipStreamWrapper(std::shared_ptr<const IZipArchive> zipArchive, std::unique_ptr<IStream> base)
             : _zipArchive(std::move(zipArchive))
             , _base(std::move(base))
         {
@@ -21,7 +21,9 @@
 #include "ScrollingText.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
@@ -186,6 +188,19 @@ static bool _csgLoaded = false;
 
 static rct_g1_element _g1Temp = {};
 static std::vector<rct_g1_element> _imageListElements;
+
+struct DeferredImage
+{
+    std::shared_ptr<IDeferredImageSource> Source;
+    uint32_t Index{};
+};
+
+// Image list entries that still have to be decoded, images can be requested by several drawing threads at once.
+// The entries are only accessed under the mutex, the pending flags let drawing threads skip the lock for images that are
+// already decoded. Both are sized once for the whole image list so they are never reallocated under the drawing threads.
+static std::vector<std::unique_ptr<DeferredImage>> _imageListDeferred(SPR_IMAGE_LIST_END - SPR_IMAGE_LIST_BEGIN);
+static std::vector<std::atomic<bool>> _imageListDeferredPending(SPR_IMAGE_LIST_END - SPR_IMAGE_LIST_BEGIN);
+static std::mutex _imageListDeferredMutex;
 bool gTinyFontAntiAliased = false;
 
 /**
@@ -649,6 +664,19 @@ void FASTCALL gfx_draw_sprite_raw_masked_software(
     mask_fn(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+static void LoadDeferredImage(size_t idx)
+{
+    std::lock_guard<std::mutex> guard(_imageListDeferredMutex);
+
+    // Another thread may have decoded or replaced the image while waiting for the lock
+    auto deferred = std::move(_imageListDeferred[idx]);
+    if (deferred != nullptr)
+    {
+        _imageListElements[idx] = deferred->Source->DecodeImage(deferred->Index);
+    }
+    _imageListDeferredPending[idx].store(false, std::memory_order_release);
+}
+
 const rct_g1_element* gfx_get_g1_element(ImageId imageId)
 {
     return gfx_get_g1_element(imageId.GetIndex());
@@ -712,6 +740,10 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id)
         size_t idx = offset - SPR_IMAGE_LIST_BEGIN;
         if (idx < _imageListElements.size())
         {
+            if (_imageListDeferredPending[idx].load(std::memory_order_acquire))
+            {
+                LoadDeferredImage(idx);
+            }
             return &_imageListElements[idx];
         }
     }
@@ -767,6 +799,27 @@ void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1)
     }
 }
 
+void gfx_set_g1_element_source(int32_t imageId, const std::shared_ptr<IDeferredImageSource>& source, uint32_t index)
+{
+    openrct2_assert(
+        imageId >= SPR_IMAGE_LIST_BEGIN && imageId < SPR_IMAGE_LIST_END,
+        "gfx_set_g1_element_source called with unexpected image id");
+
+    size_t idx = static_cast<size_t>(imageId) - SPR_IMAGE_LIST_BEGIN;
+    std::unique_ptr<DeferredImage> deferred;
+    if (source != nullptr)
+    {
+        deferred = std::make_unique<DeferredImage>();
+        deferred->Source = source;
+        deferred->Index = index;
+    }
+
+    // Another thread may be decoding the image being replaced
+    std::lock_guard<std::mutex> guard(_imageListDeferredMutex);
+    _imageListDeferred[idx] = std::move(deferred);
+    _imageListDeferredPending[idx].store(source != nullptr, std::memory_order_release);
+}
+
 bool is_csg_loaded()
 {
     return _csgLoaded;
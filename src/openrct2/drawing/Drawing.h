@@ -694,6 +694,22 @@ void gfx_fill_rect(rct_drawpixelinfo* dpi, const ScreenRect& rect, int32_t colou
 void gfx_fill_rect_inset(rct_drawpixelinfo* dpi, const ScreenRect& rect, int32_t colour, uint8_t flags);
 void gfx_filter_rect(rct_drawpixelinfo* dpi, const ScreenRect& rect, FilterPaletteID palette);
 
+/**
+ * Provides the data of object images that are registered as placeholders and only decoded the first time
+ * they are requested through gfx_get_g1_element.
+ */
+struct IDeferredImageSource
+{
+    virtual ~IDeferredImageSource() = default;
+
+    virtual bool IsDeferred(uint32_t index) const abstract;
+    /**
+     * Decodes the image at the given index of the object's image table. The returned element points to data
+     * that stays owned by the source. Calls are serialised by the caller.
+     */
+    virtual rct_g1_element DecodeImage(uint32_t index) abstract;
+};
+
 // sprite
 bool gfx_load_g1(const OpenRCT2::IPlatformEnvironment& env);
 bool gfx_load_g2();
@@ -704,8 +720,10 @@ void gfx_unload_csg();
 const rct_g1_element* gfx_get_g1_element(ImageId imageId);
 const rct_g1_element* gfx_get_g1_element(int32_t image_id);
 void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1);
+void gfx_set_g1_element_source(int32_t imageId, const std::shared_ptr<IDeferredImageSource>& source, uint32_t index);
 bool is_csg_loaded();
-uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count);
+uint32_t gfx_object_allocate_images(
+    const rct_g1_element* images, uint32_t count, const std::shared_ptr<IDeferredImageSource>& deferredSource = nullptr);
 void gfx_object_free_images(uint32_t baseImageId, uint32_t count);
 void gfx_object_check_all_images_freed();
 size_t ImageListGetUsedCount();
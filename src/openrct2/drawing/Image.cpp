@@ -12,6 +12,7 @@
 #include "../core/Guard.hpp"
 #include "../sprites.h"
 #include "Drawing.h"
+#include "ImageIdAllocator.h"
 
 #include <algorithm>
 #include <list>
@@ -27,8 +28,7 @@ struct ImageList
 };
 
 static bool _initialised = false;
-static std::list<ImageList> _freeLists;
-static uint32_t _allocatedImageCount;
+static ImageIdAllocator _allocator(BASE_IMAGE_ID, MAX_IMAGES);
 
 #ifdef DEBUG_LEVEL_1
 static std::list<ImageList> _allocatedLists;
@@ -65,75 +65,17 @@ static bool AllocatedListRemove(uint32_t baseImageId, uint32_t count)
 }
 #endif
 
-static uint32_t GetNumFreeImagesRemaining()
-{
-    return MAX_IMAGES - _allocatedImageCount;
-}
-
 static void InitialiseImageList()
 {
     Guard::Assert(!_initialised, GUARD_LINE);
 
-    _freeLists.clear();
-    _freeLists.push_back({ BASE_IMAGE_ID, MAX_IMAGES });
+    _allocator.Reset();
 #ifdef DEBUG_LEVEL_1
     _allocatedLists.clear();
 #endif
-    _allocatedImageCount = 0;
     _initialised = true;
 }
 
-/**
- * Merges all the free lists into one, a process of defragmentation.
- */
-static void MergeFreeLists()
-{
-    _freeLists.sort([](const ImageList& a, const ImageList& b) -> bool { return a.BaseId < b.BaseId; });
-    for (auto it = _freeLists.begin(); it != _freeLists.end(); it++)
-    {
-        bool mergeHappened;
-        do
-        {
-            mergeHappened = false;
-            auto nextIt = std::next(it);
-            if (nextIt != _freeLists.end())
-            {
-                if (it->BaseId + it->Count == nextIt->BaseId)
-                {
-                    // Merge next list into this list
-                    it->Count += nextIt->Count;
-                    _freeLists.erase(nextIt);
-                    mergeHappened = true;
-                }
-            }
-        } while (mergeHappened);
-    }
-}
-
-static uint32_t TryAllocateImageList(uint32_t count)
-{
-    for (auto it = _freeLists.begin(); it != _freeLists.end(); it++)
-    {
-        ImageList imageList = *it;
-        if (imageList.Count >= count)
-        {
-            _freeLists.erase(it);
-            if (imageList.Count > count)
-            {
-                ImageList remainder = { imageList.BaseId + count, imageList.Count - count };
-                _freeLists.push_back(remainder);
-            }
-
-#ifdef DEBUG_LEVEL_1
-            _allocatedLists.push_back({ imageList.BaseId, count });
-#endif
-            _allocatedImageCount += count;
-            return imageList.BaseId;
-        }
-    }
-    return INVALID_IMAGE_ID;
-}
-
 static uint32_t AllocateImageList(uint32_t count)
 {
     Guard::Assert(count != 0, GUARD_LINE);
@@ -143,18 +85,14 @@ static uint32_t AllocateImageList(uint32_t count)
         InitialiseImageList();
     }
 
-    uint32_t baseImageId = INVALID_IMAGE_ID;
-    uint32_t freeImagesRemaining = GetNumFreeImagesRemaining();
-    if (freeImagesRemaining >= count)
+    uint32_t baseImageId = _allocator.Allocate(count);
+    if (baseImageId == ImageIdAllocator::INVALID_ID)
     {
-        baseImageId = TryAllocateImageList(count);
-        if (baseImageId == INVALID_IMAGE_ID)
-        {
-            // Defragment and try again
-            MergeFreeLists();
-            baseImageId = TryAllocateImageList(count);
-        }
+        return INVALID_IMAGE_ID;
     }
+#ifdef DEBUG_LEVEL_1
+    _allocatedLists.push_back({ baseImageId, count });
+#endif
     return baseImageId;
 }
 
@@ -169,28 +107,14 @@ static void FreeImageList(uint32_t baseImageId, uint32_t count)
         log_error("Cannot unload %u items from offset %u", count, baseImageId);
     }
 #endif
-    _allocatedImageCount -= count;
-
-    for (auto it = _freeLists.begin(); it != _freeLists.end(); it++)
+    if (!_allocator.Free(baseImageId, count))
     {
-        if (it->BaseId + it->Count == baseImageId)
-        {
-            it->Count += count;
-            return;
-        }
-
-        if (baseImageId + count == it->BaseId)
-        {
-            it->BaseId = baseImageId;
-            it->Count += count;
-            return;
-        }
+        log_error("Cannot free %u images from offset %u, they are not allocated", count, baseImageId);
     }
-
-    _freeLists.push_back({ baseImageId, count });
 }
 
-uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count)
+uint32_t gfx_object_allocate_images(
+    const rct_g1_element* images, uint32_t count, const std::shared_ptr<IDeferredImageSource>& deferredSource)
 {
     if (count == 0 || gOpenRCT2NoGraphics)
     {
@@ -208,6 +132,10 @@ uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count
     for (uint32_t i = 0; i < count; i++)
     {
         gfx_set_g1_element(imageId, &images[i]);
+        if (deferredSource != nullptr && deferredSource->IsDeferred(i))
+        {
+            gfx_set_g1_element_source(imageId, deferredSource, i);
+        }
         drawing_engine_invalidate_image(imageId);
         imageId++;
     }
@@ -225,6 +153,7 @@ void gfx_object_free_images(uint32_t baseImageId, uint32_t count)
         {
             uint32_t imageId = baseImageId + i;
             rct_g1_element g1 = {};
+            gfx_set_g1_element_source(imageId, nullptr, 0);
             gfx_set_g1_element(imageId, &g1);
             drawing_engine_invalidate_image(imageId);
         }
@@ -235,19 +164,20 @@ void gfx_object_free_images(uint32_t baseImageId, uint32_t count)
 
 void gfx_object_check_all_images_freed()
 {
-    if (_allocatedImageCount != 0)
+    auto numAllocated = _allocator.GetNumAllocated();
+    if (numAllocated != 0)
     {
 #ifdef DEBUG_LEVEL_1
-        Guard::Assert(_allocatedImageCount == 0, "%u images were not freed", _allocatedImageCount);
+        Guard::Assert(numAllocated == 0, "%u images were not freed", numAllocated);
 #else
-        Console::Error::WriteLine("%u images were not freed", _allocatedImageCount);
+        Console::Error::WriteLine("%u images were not freed", numAllocated);
 #endif
     }
 }
 
 size_t ImageListGetUsedCount()
 {
-    return _allocatedImageCount;
+    return _allocator.GetNumAllocated();
 }
 
 size_t ImageListGetMaximum()
@@ -0,0 +1,107 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ImageIdAllocator.h"
+
+#include "../core/Guard.hpp"
+
+#include <iterator>
+
+ImageIdAllocator::ImageIdAllocator(uint32_t baseId, uint32_t count)
+    : _baseId(baseId)
+    , _count(count)
+{
+    Reset();
+}
+
+void ImageIdAllocator::Reset()
+{
+    _freeByBase.clear();
+    _freeBySize.clear();
+    _numAllocated = 0;
+    if (_count != 0)
+    {
+        InsertFreeRange(_baseId, _count);
+    }
+}
+
+uint32_t ImageIdAllocator::Allocate(uint32_t count)
+{
+    Guard::Assert(count != 0, GUARD_LINE);
+
+    // Best fit, smallest range that is large enough. Ties go to the lowest base id.
+    auto sizeIt = _freeBySize.lower_bound({ count, 0 });
+    if (sizeIt == _freeBySize.end())
+    {
+        return INVALID_ID;
+    }
+
+    auto [rangeCount, rangeBaseId] = *sizeIt;
+    EraseFreeRange(_freeByBase.find(rangeBaseId));
+    if (rangeCount > count)
+    {
+        InsertFreeRange(rangeBaseId + count, rangeCount - count);
+    }
+    _numAllocated += count;
+    return rangeBaseId;
+}
+
+bool ImageIdAllocator::Free(uint32_t baseId, uint32_t count)
+{
+    if (count == 0 || count > _count || baseId < _baseId || baseId - _baseId > _count - count)
+    {
+        return false;
+    }
+
+    // The free ranges around the freed one must not overlap with it.
+    auto nextIt = _freeByBase.lower_bound(baseId);
+    if (nextIt != _freeByBase.end() && nextIt->first < baseId + count)
+    {
+        return false;
+    }
+    auto prevIt = nextIt != _freeByBase.begin() ? std::prev(nextIt) : _freeByBase.end();
+    if (prevIt != _freeByBase.end() && prevIt->first + prevIt->second > baseId)
+    {
+        return false;
+    }
+
+    uint32_t mergedBaseId = baseId;
+    uint32_t mergedCount = count;
+    if (prevIt != _freeByBase.end() && prevIt->first + prevIt->second == baseId)
+    {
+        mergedBaseId = prevIt->first;
+        mergedCount += prevIt->second;
+        EraseFreeRange(prevIt);
+    }
+    if (nextIt != _freeByBase.end() && nextIt->first == baseId + count)
+    {
+        mergedCount += nextIt->second;
+        EraseFreeRange(nextIt);
+    }
+    InsertFreeRange(mergedBaseId, mergedCount);
+    _numAllocated -= count;
+    return true;
+}
+
+uint32_t ImageIdAllocator::GetLargestFreeRange() const
+{
+    return _freeBySize.empty() ? 0 : _freeBySize.rbegin()->first;
+}
+
+void ImageIdAllocator::InsertFreeRange(uint32_t baseId, uint32_t count)
+{
+    _freeByBase.emplace(baseId, count);
+    _freeBySize.emplace(count, baseId);
+}
+
+void ImageIdAllocator::EraseFreeRange(std::map<uint32_t, uint32_t>::iterator it)
+{
+    _freeBySize.erase({ it->second, it->first });
+    _freeByBase.erase(it);
+}
@@ -0,0 +1,76 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <map>
+#include <set>
+#include <utility>
+
+/**
+ * Hands out ranges of consecutive image ids from a fixed block of ids. The free ranges are kept in two
+ * balanced trees: one ordered by base id so that a freed range is merged with its neighbours straight away,
+ * and one ordered by size so that the smallest free range that fits a request is found in logarithmic time.
+ */
+class ImageIdAllocator
+{
+public:
+    static constexpr uint32_t INVALID_ID = UINT32_MAX;
+
+    ImageIdAllocator(uint32_t baseId, uint32_t count);
+
+    /**
+     * Marks every id as free again.
+     */
+    void Reset();
+
+    /**
+     * Returns the first id of a range of count consecutive ids or INVALID_ID if there is no free range
+     * that is large enough.
+     */
+    [[nodiscard]] uint32_t Allocate(uint32_t count);
+
+    /**
+     * Returns a range that was handed out by Allocate. Returns false, without changing anything, if
+     * any of the ids is outside of the block or already free.
+     */
+    bool Free(uint32_t baseId, uint32_t count);
+
+    uint32_t GetNumAllocated() const
+    {
+        return _numAllocated;
+    }
+
+    uint32_t GetNumFree() const
+    {
+        return _count - _numAllocated;
+    }
+
+    size_t GetNumFreeRanges() const
+    {
+        return _freeByBase.size();
+    }
+
+    uint32_t GetLargestFreeRange() const;
+
+private:
+    void InsertFreeRange(uint32_t baseId, uint32_t count);
+    void EraseFreeRange(std::map<uint32_t, uint32_t>::iterator it);
+
+    uint32_t _baseId;
+    uint32_t _count;
+    uint32_t _numAllocated{};
+
+    // Free ranges keyed by base id, the value is the number of ids in the range.
+    std::map<uint32_t, uint32_t> _freeByBase;
+    // The same free ranges as (count, base id).
+    std::set<std::pair<uint32_t, uint32_t>> _freeBySize;
+};
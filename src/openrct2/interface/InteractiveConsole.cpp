@@ -38,6 +38,7 @@
 #include "../network/network.h"
 #include "../object/Object.h"
 #include "../object/ObjectList.h"
+#include "../object/ObjectLoadProfile.h"
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
 #include "../peep/Staff.h"
@@ -45,6 +46,7 @@
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
+#include "../scripting/ScriptEngine.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
@@ -1164,6 +1166,91 @@ static int32_t cc_object_count(InteractiveConsole& console, [[maybe_unused]] con
     return 0;
 }
 
+static int32_t cc_profile_objects(InteractiveConsole& console, const arguments_t& argv)
+{
+    auto sort = ObjectLoadProfileSort::Time;
+    if (!argv.empty() && !ObjectLoadProfileSortFromString(argv[0], sort))
+    {
+        console.WriteLineError("Unknown sort order, expected time, read, load, images or size.");
+        return 1;
+    }
+
+    size_t count = 20;
+    if (argv.size() >= 2)
+    {
+        count = static_cast<size_t>(std::max(0, atoi(argv[1].c_str())));
+    }
+
+    auto profile = OpenRCT2::GetContext()->GetObjectManager().GetLastLoadProfile();
+    profile.Sort(sort);
+    for (const auto& line : profile.FormatReport(count))
+    {
+        console.WriteLine(line);
+    }
+    return 0;
+}
+
+static int32_t cc_plugin_profile(InteractiveConsole& console, const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    auto& scriptEngine = OpenRCT2::GetContext()->GetScriptEngine();
+    auto& profiler = scriptEngine.GetProfiler();
+    if (argv.empty())
+    {
+        for (const auto& line : OpenRCT2::Scripting::ScriptProfiler::FormatCounterReport(scriptEngine.GetPlugins()))
+        {
+            console.WriteLine(line);
+        }
+    }
+    else if (argv[0] == "startup")
+    {
+        for (const auto& line : OpenRCT2::Scripting::ScriptProfiler::FormatStartupReport(scriptEngine.GetPlugins()))
+        {
+            console.WriteLine(line);
+        }
+    }
+    else if (argv[0] == "reset")
+    {
+        for (const auto& plugin : scriptEngine.GetPlugins())
+        {
+            plugin->ResetCounters();
+        }
+    }
+    else if (argv[0] == "start")
+    {
+        int32_t interval = 1000;
+        if (argv.size() >= 2)
+        {
+            interval = std::max(100, atoi(argv[1].c_str()));
+        }
+        profiler.StartSampling(std::chrono::microseconds(interval));
+        console.WriteFormatLine("Sampling plugin callbacks every %d us.", interval);
+    }
+    else if (argv[0] == "stop")
+    {
+        size_t count = 20;
+        if (argv.size() >= 2)
+        {
+            count = static_cast<size_t>(std::max(0, atoi(argv[1].c_str())));
+        }
+        profiler.StopSampling();
+        for (const auto& line : profiler.FormatSampleReport(count))
+        {
+            console.WriteLine(line);
+        }
+    }
+    else
+    {
+        console.WriteLineError("Unknown subcommand, expected startup, reset, start or stop.");
+        return 1;
+    }
+    return 0;
+#else
+    console.WriteLineError("Plugins are not supported in this build.");
+    return 1;
+#endif
+}
+
 static int32_t cc_open(InteractiveConsole& console, const arguments_t& argv)
 {
     if (!argv.empty())
@@ -1556,6 +1643,37 @@ static int32_t cc_replay_stop(InteractiveConsole& console, const arguments_t& ar
     return 0;
 }
 
+static int32_t cc_replay_seek(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (network_get_mode() != NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return 0;
+    }
+
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <tick>");
+        return 0;
+    }
+
+    auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (!replayManager->IsReplaying())
+    {
+        console.WriteFormatLine("No replay is currently playing.");
+        return 0;
+    }
+
+    uint32_t tick = static_cast<uint32_t>(atol(argv[0].c_str()));
+    if (replayManager->SeekPlayback(tick))
+    {
+        console.WriteFormatLine("Seeked replay to tick %u", tick);
+        return 1;
+    }
+
+    return 0;
+}
+
 static int32_t cc_replay_normalise(InteractiveConsole& console, const arguments_t& argv)
 {
     if (network_get_mode() != NETWORK_MODE_NONE)
@@ -1807,6 +1925,12 @@ static constexpr const console_command console_command_table[] = {
     { "load_park", cc_load_park, "Load park from save directory or by absolute path", "load_park <filename>" },
     { "object_count", cc_object_count, "Shows the number of objects of each type in the scenario.", "object_count" },
     { "open", cc_open, "Opens the window with the give name.", "open <window>." },
+    { "plugin_profile", cc_plugin_profile,
+      "Shows the calls and time of each plugin's hooks and intervals, how long plugins took to load, or samples which "
+      "plugin callbacks are running.",
+      "plugin_profile [startup|reset|start [interval_us]|stop [count]]" },
+    { "profile_objects", cc_profile_objects, "Lists the time taken by each object loaded with the current park, slowest first.",
+      "profile_objects [time|read|load|images|size] [count]" },
     { "quit", cc_close, "Closes the console.", "quit" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences" },
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.",
@@ -1826,6 +1950,7 @@ static constexpr const console_command console_command_table[] = {
     { "replay_stoprecord", cc_replay_stoprecord, "Stops recording a new replay.", "replay_stoprecord" },
     { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name>" },
     { "replay_stop", cc_replay_stop, "Stops the replay", "replay_stop" },
+    { "replay_seek", cc_replay_seek, "Seeks the replay to the given tick, counted from the start of the replay.", "replay_seek <tick>" },
     { "replay_normalise", cc_replay_normalise, "Normalises the replay to remove all gaps",
       "replay_normalise <input file> <output file>" },
     { "mp_desync", cc_mp_desync, "Forces a multiplayer desync",
@@ -436,115 +436,17 @@ template<typename FN> static inline double MeasureFunctionTime(const FN& fn)
     return std::chrono::duration<double>(endTime - startTime).count();
 }
 
-static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<IContext>& context, uint32_t iterationCount)
+double benchgfx_render_rotations(ZoomLevel zoom)
 {
-    if (!context->LoadParkFromFile(inputPath))
+    double totalTime = 0.0;
+    for (int32_t rotation = 0; rotation < 4; rotation++)
     {
-        return;
-    }
-
-    gIntroState = IntroState::None;
-    gScreenFlags = SCREEN_FLAGS_PLAYING;
-
-    // Create Viewport and DPI for every rotation and zoom.
-    constexpr int32_t MAX_ROTATIONS = 4;
-    constexpr int32_t MAX_ZOOM_LEVEL = 3;
-    std::array<rct_drawpixelinfo, MAX_ROTATIONS * MAX_ZOOM_LEVEL> dpis;
-    std::array<rct_viewport, MAX_ROTATIONS * MAX_ZOOM_LEVEL> viewports;
-
-    for (int32_t zoom = 0; zoom < MAX_ZOOM_LEVEL; zoom++)
-    {
-        for (int32_t rotation = 0; rotation < MAX_ROTATIONS; rotation++)
-        {
-            auto& viewport = viewports[zoom * MAX_ZOOM_LEVEL + rotation];
-            auto& dpi = dpis[zoom * MAX_ZOOM_LEVEL + rotation];
-            viewport = GetGiantViewport(gMapSize, rotation, zoom);
-            dpi = CreateDPI(viewport);
-        }
-    }
-
-    const uint32_t totalRenderCount = iterationCount * MAX_ROTATIONS * MAX_ZOOM_LEVEL;
-
-    try
-    {
-        double totalTime = 0.0;
-
-        std::array<double, MAX_ZOOM_LEVEL> zoomAverages;
-
-        // Render at every zoom.
-        for (int32_t zoom = 0; zoom < MAX_ZOOM_LEVEL; zoom++)
-        {
-            double zoomLevelTime = 0.0;
-
-            // Render at every rotation.
-            for (int32_t rotation = 0; rotation < MAX_ROTATIONS; rotation++)
-            {
-                // N iterations.
-                for (uint32_t i = 0; i < iterationCount; i++)
-                {
-                    auto& dpi = dpis[zoom * MAX_ZOOM_LEVEL + rotation];
-                    auto& viewport = viewports[zoom * MAX_ZOOM_LEVEL + rotation];
-                    double elapsed = MeasureFunctionTime([&viewport, &dpi]() { RenderViewport(nullptr, viewport, dpi); });
-                    totalTime += elapsed;
-                    zoomLevelTime += elapsed;
-                }
-            }
-
-            zoomAverages[zoom] = zoomLevelTime / static_cast<double>(MAX_ROTATIONS * iterationCount);
-        }
-
-        const double average = totalTime / static_cast<double>(totalRenderCount);
-        const auto engineStringId = DrawingEngineStringIds[EnumValue(DrawingEngine::Software)];
-        const auto engineName = format_string(engineStringId, nullptr);
-        std::printf("Engine: %s\n", engineName.c_str());
-        std::printf("Render Count: %u\n", totalRenderCount);
-        for (int32_t zoom = 0; zoom < MAX_ZOOM_LEVEL; zoom++)
-        {
-            const auto zoomAverage = zoomAverages[zoom];
-            std::printf("Zoom[%d] average: %.06fs, %.f FPS\n", zoom, zoomAverage, 1.0 / zoomAverage);
-        }
-        std::printf("Total average: %.06fs, %.f FPS\n", average, 1.0 / average);
-        std::printf("Time: %.05fs\n", totalTime);
-    }
-    catch (const std::exception& e)
-    {
-        Console::Error::WriteLine("%s", e.what());
-    }
-
-    for (auto& dpi : dpis)
+        auto viewport = GetGiantViewport(gMapSize, rotation, zoom);
+        auto dpi = CreateDPI(viewport);
+        totalTime += MeasureFunctionTime([&viewport, &dpi]() { RenderViewport(nullptr, viewport, dpi); });
         ReleaseDPI(dpi);
-}
-
-int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
-{
-    if (argc != 1 && argc != 2)
-    {
-        printf("Usage: openrct2 benchgfx <file> [<iteration_count>]\n");
-        return -1;
     }
-
-    core_init();
-    int32_t iterationCount = 5;
-    if (argc == 2)
-    {
-        iterationCount = atoi(argv[1]);
-    }
-
-    const char* inputPath = argv[0];
-
-    gOpenRCT2Headless = true;
-
-    std::unique_ptr<IContext> context(CreateContext());
-    if (context->Initialise())
-    {
-        drawing_engine_init();
-
-        benchgfx_render_screenshots(inputPath, context, iterationCount);
-
-        drawing_engine_dispose();
-    }
-
-    return 1;
+    return totalTime;
 }
 
 static void ApplyOptions(const ScreenshotOptions* options, rct_viewport& viewport)
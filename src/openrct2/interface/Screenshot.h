@@ -59,6 +59,11 @@ std::string screenshot_dump_png_32bpp(int32_t width, int32_t height, const void*
 
 void screenshot_giant();
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
-int32_t cmdline_for_gfxbench(const char** argv, int32_t argc);
+
+/**
+ * Renders the whole map of the loaded park at every rotation of the given zoom level and returns the time spent rendering
+ * in seconds.
+ */
+double benchgfx_render_rotations(ZoomLevel zoom);
 
 void CaptureImage(const CaptureOptions& options);
@@ -1161,6 +1161,40 @@ CoordsXY viewport_coord_to_map_coord(const ScreenCoordsXY& coords, int32_t z)
     return ret.Rotate(inverseRotation);
 }
 
+/**
+ * Gets the area of the map in which entities can be drawn within the area of the screen, at any height.
+ */
+MapRange viewport_get_entity_map_range(const ScreenRect& screenRect)
+{
+    // Entities are drawn around their position, no further out than the largest sprite bounds
+    constexpr int32_t spriteMargin = 256;
+    const ScreenRect rect(
+        screenRect.GetLeft() - spriteMargin, screenRect.GetTop() - spriteMargin, screenRect.GetRight() + spriteMargin,
+        screenRect.GetBottom() + spriteMargin);
+
+    // The projection is linear, so the corners of the screen area at the lowest and highest points of the map bound
+    // every position that can be drawn within it
+    auto first = viewport_coord_to_map_coord(rect.Point1, 0);
+    auto left = first.x;
+    auto top = first.y;
+    auto right = first.x;
+    auto bottom = first.y;
+    const ScreenCoordsXY corners[] = { rect.Point1, rect.Point2, { rect.GetLeft(), rect.GetBottom() },
+                                       { rect.GetRight(), rect.GetTop() } };
+    for (auto z : { 0, MAX_ELEMENT_HEIGHT * COORDS_Z_STEP })
+    {
+        for (const auto& corner : corners)
+        {
+            auto pos = viewport_coord_to_map_coord(corner, z);
+            left = std::min(left, pos.x);
+            top = std::min(top, pos.y);
+            right = std::max(right, pos.x);
+            bottom = std::max(bottom, pos.y);
+        }
+    }
+    return MapRange(left, top, right, bottom);
+}
+
 /**
  *
  *  rct2: 0x00664689
@@ -123,6 +123,7 @@ void viewport_paint(
 CoordsXYZ viewport_adjust_for_map_height(const ScreenCoordsXY& startCoords);
 
 CoordsXY viewport_coord_to_map_coord(const ScreenCoordsXY& coords, int32_t z);
+MapRange viewport_get_entity_map_range(const ScreenRect& screenRect);
 std::optional<CoordsXY> screen_pos_to_map_pos(const ScreenCoordsXY& screenCoords, int32_t* direction);
 
 void show_gridlines();
@@ -33,14 +33,30 @@
 #include "Window_internal.h"
 
 #include <algorithm>
+#include <bitset>
 #include <cmath>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <list>
+#include <unordered_map>
+#include <unordered_set>
 
 std::list<std::shared_ptr<rct_window>> g_window_list;
 rct_window* gWindowAudioExclusive;
 
+// Indexes of the window list, so that windows can be found without searching the whole list. Windows are only indexed
+// by class as the number of a window is often set after it has been created.
+static std::unordered_map<const rct_window*, std::list<std::shared_ptr<rct_window>>::iterator> _windowIterators;
+static std::unordered_map<rct_windowclass, std::vector<rct_window*>> _windowsByClass;
+
+// Windows invalidated by class or number are only invalidated once, when the invalidations are flushed before drawing
+static std::bitset<std::numeric_limits<rct_windowclass>::max() + 1> _pendingInvalidateClasses;
+static std::unordered_set<uint32_t> _pendingInvalidateNumbers;
+static bool _pendingInvalidateAll;
+static WindowInvalidationStats _invalidationStats;
+static WindowInvalidationStats _lastInvalidationStats;
+
 widget_identifier gCurrentTextBox = { { 255, 0 }, 0 };
 char gTextBoxInput[TEXT_INPUT_SIZE] = { 0 };
 int32_t gMaxTextBoxInputLength = 0;
@@ -88,14 +104,35 @@ static void window_draw_single(rct_drawpixelinfo* dpi, rct_window* w, int32_t le
 
 std::list<std::shared_ptr<rct_window>>::iterator window_get_iterator(const rct_window* w)
 {
-    return std::find_if(g_window_list.begin(), g_window_list.end(), [w](const std::shared_ptr<rct_window>& w2) -> bool {
-        return w == w2.get();
-    });
+    auto it = _windowIterators.find(w);
+    return it != _windowIterators.end() ? it->second : g_window_list.end();
+}
+
+/**
+ * Adds a window that has been inserted into the window list to the indexes, once its class has been set.
+ */
+void window_register(std::list<std::shared_ptr<rct_window>>::iterator it)
+{
+    auto* w = it->get();
+    _windowIterators[w] = it;
+    _windowsByClass[w->classification].push_back(w);
+}
+
+static void window_unregister(const rct_window* w)
+{
+    _windowIterators.erase(w);
+    auto it = _windowsByClass.find(w->classification);
+    if (it != _windowsByClass.end())
+    {
+        auto& windows = it->second;
+        windows.erase(std::remove(windows.begin(), windows.end(), w), windows.end());
+    }
 }
 
 void window_visit_each(std::function<void(rct_window*)> func)
 {
-    auto windowList = g_window_list;
+    // Windows may be opened or closed by the function, the pointers keep the windows being visited alive
+    std::vector<std::shared_ptr<rct_window>> windowList(g_window_list.begin(), g_window_list.end());
     for (auto& w : windowList)
     {
         func(w.get());
@@ -225,7 +262,10 @@ void window_close(rct_window* w)
     // The window list may have been modified in the close event
     itWindow = window_get_iterator(w);
     if (itWindow != g_window_list.end())
+    {
+        window_unregister(w);
         g_window_list.erase(itWindow);
+    }
 }
 
 template<typename TPred> static void window_close_by_condition(TPred pred, uint32_t flags = WindowCloseFlags::None)
@@ -308,6 +348,17 @@ void window_close_by_number(rct_windowclass cls, rct_windownumber number)
  */
 rct_window* window_find_by_class(rct_windowclass cls)
 {
+    auto it = _windowsByClass.find(cls);
+    if (it == _windowsByClass.end() || it->second.empty())
+    {
+        return nullptr;
+    }
+    if (it->second.size() == 1)
+    {
+        return it->second[0];
+    }
+
+    // The first window of the class in the window list is the one furthest back
     for (auto& w : g_window_list)
     {
         if (w->classification == cls)
@@ -327,6 +378,27 @@ rct_window* window_find_by_class(rct_windowclass cls)
  */
 rct_window* window_find_by_number(rct_windowclass cls, rct_windownumber number)
 {
+    auto it = _windowsByClass.find(cls);
+    if (it == _windowsByClass.end())
+    {
+        return nullptr;
+    }
+
+    rct_window* result = nullptr;
+    size_t numFound = 0;
+    for (auto* w : it->second)
+    {
+        if (w->number == number)
+        {
+            result = w;
+            numFound++;
+        }
+    }
+    if (numFound <= 1)
+    {
+        return result;
+    }
+
     for (auto& w : g_window_list)
     {
         if (w->classification == cls && w->number == number)
@@ -455,20 +527,16 @@ rct_widgetindex window_find_widget_from_point(rct_window* w, const ScreenCoordsX
     return widget_index;
 }
 
-/**
- * Invalidates the specified window.
- *  rct2: 0x006EB13A
- *
- * @param window The window to invalidate (esi).
- */
-template<typename TPred> static void window_invalidate_by_condition(TPred pred)
+static uint32_t window_get_invalidate_key(rct_windowclass cls, rct_windownumber number)
 {
-    window_visit_each([pred](rct_window* w) {
-        if (pred(w))
-        {
-            w->Invalidate();
-        }
-    });
+    return (static_cast<uint32_t>(cls) << 16) | number;
+}
+
+// Invalidations are only flushed when a frame is painted, which never happens when running headless. Requests made when
+// there are no windows to invalidate are dropped so that they do not pile up until the next frame.
+static bool window_can_invalidate()
+{
+    return !gOpenRCT2Headless && !g_window_list.empty();
 }
 
 /**
@@ -478,7 +546,11 @@ template<typename TPred> static void window_invalidate_by_condition(TPred pred)
  */
 void window_invalidate_by_class(rct_windowclass cls)
 {
-    window_invalidate_by_condition([cls](rct_window* w) -> bool { return w->classification == cls; });
+    if (!window_can_invalidate())
+        return;
+
+    _invalidationStats.Requested++;
+    _pendingInvalidateClasses.set(cls);
 }
 
 /**
@@ -487,8 +559,11 @@ void window_invalidate_by_class(rct_windowclass cls)
  */
 void window_invalidate_by_number(rct_windowclass cls, rct_windownumber number)
 {
-    window_invalidate_by_condition(
-        [cls, number](rct_window* w) -> bool { return w->classification == cls && w->number == number; });
+    if (!window_can_invalidate())
+        return;
+
+    _invalidationStats.Requested++;
+    _pendingInvalidateNumbers.insert(window_get_invalidate_key(cls, number));
 }
 
 /**
@@ -496,7 +571,42 @@ void window_invalidate_by_number(rct_windowclass cls, rct_windownumber number)
  */
 void window_invalidate_all()
 {
-    window_visit_each([](rct_window* w) { w->Invalidate(); });
+    if (!window_can_invalidate())
+        return;
+
+    _invalidationStats.Requested++;
+    _pendingInvalidateAll = true;
+}
+
+/**
+ * Invalidates the windows that have been invalidated by class, number or all since the last flush, each window once.
+ */
+void window_flush_invalidations()
+{
+    if (_pendingInvalidateAll || _pendingInvalidateClasses.any() || !_pendingInvalidateNumbers.empty())
+    {
+        for (auto& w : g_window_list)
+        {
+            if (_pendingInvalidateAll || _pendingInvalidateClasses[w->classification]
+                || (!_pendingInvalidateNumbers.empty()
+                    && _pendingInvalidateNumbers.count(window_get_invalidate_key(w->classification, w->number)) != 0))
+            {
+                w->Invalidate();
+                _invalidationStats.Invalidated++;
+            }
+        }
+        _pendingInvalidateAll = false;
+        _pendingInvalidateClasses.reset();
+        _pendingInvalidateNumbers.clear();
+    }
+
+    _lastInvalidationStats = _invalidationStats;
+    _invalidationStats = {};
+}
+
+WindowInvalidationStats window_get_invalidation_stats()
+{
+    return _lastInvalidationStats;
 }
 
 /**
@@ -536,12 +646,14 @@ template<typename TPred> static void widget_invalidate_by_condition(TPred pred)
  */
 void widget_invalidate_by_class(rct_windowclass cls, rct_widgetindex widgetIndex)
 {
-    window_visit_each([cls, widgetIndex](rct_window* w) {
-        if (w->classification == cls)
+    auto it = _windowsByClass.find(cls);
+    if (it != _windowsByClass.end())
+    {
+        for (auto* w : it->second)
         {
             widget_invalidate(w, widgetIndex);
         }
-    });
+    }
 }
 
 /**
@@ -550,12 +662,17 @@ void widget_invalidate_by_class(rct_windowclass cls, rct_widgetindex widgetIndex
  */
 void widget_invalidate_by_number(rct_windowclass cls, rct_windownumber number, rct_widgetindex widgetIndex)
 {
-    window_visit_each([cls, number, widgetIndex](rct_window* w) {
-        if (w->classification == cls && w->number == number)
+    auto it = _windowsByClass.find(cls);
+    if (it != _windowsByClass.end())
+    {
+        for (auto* w : it->second)
         {
-            widget_invalidate(w, widgetIndex);
+            if (w->number == number)
+            {
+                widget_invalidate(w, widgetIndex);
+            }
         }
-    });
+    }
 }
 
 /**
@@ -785,14 +902,7 @@ void window_push_others_below(rct_window* w1)
  */
 rct_window* window_get_main()
 {
-    for (auto& w : g_window_list)
-    {
-        if (w->classification == WC_MAIN_WINDOW)
-        {
-            return w.get();
-        }
-    }
-    return nullptr;
+    return window_find_by_class(WC_MAIN_WINDOW);
 }
 
 /**
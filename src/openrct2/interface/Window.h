@@ -660,7 +660,21 @@ extern colour_t gCurrentWindowColours[4];
 
 extern bool gDisableErrorWindowSound;
 
+struct WindowInvalidationStats
+{
+    // Number of times windows were invalidated by class, number or all
+    uint32_t Requested{};
+    // Number of windows invalidated once those were flushed
+    uint32_t Invalidated{};
+};
+
+/**
+ * Gets the invalidations of the last frame drawn.
+ */
+WindowInvalidationStats window_get_invalidation_stats();
+
 std::list<std::shared_ptr<rct_window>>::iterator window_get_iterator(const rct_window* w);
+void window_register(std::list<std::shared_ptr<rct_window>>::iterator it);
 void window_visit_each(std::function<void(rct_window*)> func);
 
 void window_dispatch_update_all();
@@ -729,6 +743,7 @@ rct_widgetindex window_find_widget_from_point(rct_window* w, const ScreenCoordsX
 void window_invalidate_by_class(rct_windowclass cls);
 void window_invalidate_by_number(rct_windowclass cls, rct_windownumber number);
 void window_invalidate_all();
+void window_flush_invalidations();
 void widget_invalidate(rct_window* w, rct_widgetindex widgetIndex);
 void widget_invalidate_by_class(rct_windowclass cls, rct_widgetindex widgetIndex);
 void widget_invalidate_by_number(rct_windowclass cls, rct_windownumber number, rct_widgetindex widgetIndex);
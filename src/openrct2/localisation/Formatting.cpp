@@ -14,11 +14,43 @@
 #include "Localisation.h"
 #include "StringIds.h"
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
+#include <unordered_map>
 
 namespace OpenRCT2
 {
+    /**
+     * A format string split into its tokens, so that strings formatted again do not have to be parsed again.
+     */
+    struct FmtProgram
+    {
+        struct Op
+        {
+            FormatToken Kind{};
+            uint32_t Offset{};
+            uint32_t Length{};
+        };
+
+        std::string Text;
+        std::vector<Op> Ops;
+    };
+
+    /**
+     * The format programs of the strings formatted by a thread. Programs are compiled on first use and kept until the
+     * language strings change. The cache is only cleared while no string is being formatted, as programs are
+     * referenced for the whole of a format.
+     */
+    struct FmtProgramCache
+    {
+        uint32_t Generation{};
+        uint32_t Depth{};
+        std::unordered_map<rct_string_id, FmtProgram> Programs;
+    };
+
+    static std::atomic<uint32_t> _fmtProgramCacheGeneration{ 1 };
+
     static void FormatMonthYear(FormatBuffer& ss, int32_t month, int32_t year);
 
     static std::optional<int32_t> ParseNumericToken(std::string_view s)
@@ -744,6 +776,42 @@ namespace OpenRCT2
         return CopyStringStreamToBuffer(buffer, bufferLen, ss);
     }
 
+    static FmtProgramCache& GetFmtProgramCache()
+    {
+        thread_local FmtProgramCache cache;
+        auto generation = _fmtProgramCacheGeneration.load(std::memory_order_relaxed);
+        if (cache.Depth == 0 && cache.Generation != generation)
+        {
+            cache.Programs.clear();
+            cache.Generation = generation;
+        }
+        return cache;
+    }
+
+    static const FmtProgram& GetFmtProgramById(FmtProgramCache& cache, rct_string_id id)
+    {
+        auto [it, added] = cache.Programs.try_emplace(id);
+        auto& program = it->second;
+        if (added)
+        {
+            auto text = language_get_string(id);
+            program.Text = text != nullptr ? text : "";
+
+            FmtString fmt(std::string_view(program.Text));
+            for (const auto& token : fmt)
+            {
+                auto offset = static_cast<uint32_t>(token.text.data() - program.Text.data());
+                program.Ops.push_back({ token.kind, offset, static_cast<uint32_t>(token.text.size()) });
+            }
+        }
+        return program;
+    }
+
+    void InvalidateFormatCache()
+    {
+        _fmtProgramCacheGeneration++;
+    }
+
     template<typename T> static T ReadFromArgs(const void*& args)
     {
         T value;
@@ -752,46 +820,70 @@ namespace OpenRCT2
         return value;
     }
 
-    static void BuildAnyArgListFromLegacyArgBuffer(const FmtString& fmt, std::vector<FormatArg_t>& anyArgs, const void*& args)
+    /**
+     * Formats the string with the arguments read straight from a legacy argument buffer. When skipping, the
+     * arguments are read without any output, which is how the arguments of real names are passed over.
+     */
+    static void FormatProgramLegacy(
+        FormatBuffer& ss, FmtProgramCache& cache, const FmtProgram& program, const void*& args, bool skip = false)
     {
-        for (const auto& t : fmt)
+        for (const auto& op : program.Ops)
         {
-            switch (t.kind)
+            switch (op.Kind)
             {
                 case FormatToken::Comma32:
                 case FormatToken::Int32:
                 case FormatToken::Comma2dp32:
                 case FormatToken::Sprite:
-                    anyArgs.push_back(ReadFromArgs<int32_t>(args));
+                {
+                    auto value = ReadFromArgs<int32_t>(args);
+                    if (!skip)
+                        FormatArgument(ss, op.Kind, value);
                     break;
+                }
                 case FormatToken::Currency2dp:
                 case FormatToken::Currency:
-                    anyArgs.push_back(ReadFromArgs<int64_t>(args));
+                {
+                    auto value = ReadFromArgs<int64_t>(args);
+                    if (!skip)
+                        FormatArgument(ss, op.Kind, value);
                     break;
+                }
                 case FormatToken::UInt16:
                 case FormatToken::MonthYear:
                 case FormatToken::Month:
                 case FormatToken::Velocity:
                 case FormatToken::DurationShort:
                 case FormatToken::DurationLong:
-                    anyArgs.push_back(ReadFromArgs<uint16_t>(args));
+                {
+                    auto value = ReadFromArgs<uint16_t>(args);
+                    if (!skip)
+                        FormatArgument(ss, op.Kind, value);
                     break;
+                }
                 case FormatToken::Comma16:
                 case FormatToken::Length:
                 case FormatToken::Comma1dp16:
-                    anyArgs.push_back(ReadFromArgs<int16_t>(args));
+                {
+                    auto value = static_cast<int32_t>(ReadFromArgs<int16_t>(args));
+                    if (!skip)
+                        FormatArgument(ss, op.Kind, value);
                     break;
+                }
                 case FormatToken::StringId:
                 {
                     auto stringId = ReadFromArgs<rct_string_id>(args);
-                    anyArgs.push_back(stringId);
-                    BuildAnyArgListFromLegacyArgBuffer(GetFmtStringById(stringId), anyArgs, args);
+                    auto realName = IsRealNameStringId(stringId);
+                    if (realName && !skip)
+                        FormatRealName(ss, stringId);
+                    FormatProgramLegacy(ss, cache, GetFmtProgramById(cache, stringId), args, skip || realName);
                     break;
                 }
                 case FormatToken::String:
                 {
-                    auto sz = ReadFromArgs<const char*>(args);
-                    anyArgs.push_back(sz);
+                    auto value = ReadFromArgs<const char*>(args);
+                    if (!skip)
+                        FormatArgument(ss, op.Kind, value);
                     break;
                 }
                 case FormatToken::Pop16:
@@ -801,33 +893,42 @@ namespace OpenRCT2
                     args = reinterpret_cast<const char*>(reinterpret_cast<uintptr_t>(args) - 2);
                     break;
                 default:
+                    if (!skip)
+                        ss.append(program.Text.data() + op.Offset, op.Length);
                     break;
             }
         }
     }
 
+    static void FormatStringLegacy(FormatBuffer& ss, rct_string_id id, const void* args)
+    {
+        auto& cache = GetFmtProgramCache();
+        cache.Depth++;
+        try
+        {
+            FormatProgramLegacy(ss, cache, GetFmtProgramById(cache, id), args);
+        }
+        catch (...)
+        {
+            cache.Depth--;
+            throw;
+        }
+        cache.Depth--;
+    }
+
     size_t FormatStringLegacy(char* buffer, size_t bufferLen, rct_string_id id, const void* args)
     {
-        thread_local std::vector<FormatArg_t> anyArgs;
-        anyArgs.clear();
-        auto fmt = GetFmtStringById(id);
-        BuildAnyArgListFromLegacyArgBuffer(fmt, anyArgs, args);
-        return FormatStringAny(buffer, bufferLen, fmt, anyArgs);
+        auto& ss = GetThreadFormatStream();
+        FormatStringLegacy(ss, id, args);
+        return CopyStringStreamToBuffer(buffer, bufferLen, ss);
     }
 
     static void FormatMonthYear(FormatBuffer& ss, int32_t month, int32_t year)
     {
-        thread_local std::vector<FormatArg_t> tempArgs;
-        tempArgs.clear();
-
-        auto fmt = GetFmtStringById(STR_DATE_FORMAT_MY);
         Formatter ft;
         ft.Add<uint16_t>(month);
         ft.Add<uint16_t>(year);
-        const void* legacyArgs = ft.Data();
-        BuildAnyArgListFromLegacyArgBuffer(fmt, tempArgs, legacyArgs);
-        size_t argIndex = 0;
-        FormatStringAny(ss, fmt, tempArgs, argIndex);
+        FormatStringLegacy(ss, STR_DATE_FORMAT_MY, ft.Data());
     }
 
 } // namespace OpenRCT2
@@ -306,4 +306,9 @@ namespace OpenRCT2
     std::string FormatStringAny(const FmtString& fmt, const std::vector<FormatArg_t>& args);
     size_t FormatStringAny(char* buffer, size_t bufferLen, const FmtString& fmt, const std::vector<FormatArg_t>& args);
     size_t FormatStringLegacy(char* buffer, size_t bufferLen, rct_string_id id, const void* args);
+
+    /**
+     * Discards the compiled format strings, must be called whenever language strings are loaded or changed.
+     */
+    void InvalidateFormatCache();
 } // namespace OpenRCT2
@@ -14,6 +14,7 @@
 #include "../core/Path.hpp"
 #include "../interface/Fonts.h"
 #include "../object/ObjectManager.h"
+#include "Formatting.h"
 #include "Language.h"
 #include "LanguagePack.h"
 #include "StringIds.h"
@@ -91,6 +92,7 @@ void LocalisationService::OpenLanguage(int32_t id)
 
     filename = GetLanguagePath(id);
     _languageCurrent = LanguagePackFactory::FromFile(id, filename.c_str());
+    InvalidateFormatCache();
     if (_languageCurrent != nullptr)
     {
         _currentLanguage = id;
@@ -107,6 +109,7 @@ void LocalisationService::CloseLanguages()
     _languageFallback = nullptr;
     _languageCurrent = nullptr;
     _currentLanguage = LANGUAGE_UNDEFINED;
+    InvalidateFormatCache();
 }
 
 std::tuple<rct_string_id, rct_string_id, rct_string_id> LocalisationService::GetLocalisedScenarioStrings(
@@ -132,6 +135,7 @@ rct_string_id LocalisationService::AllocateObjectString(const std::string& targe
     auto stringId = _availableObjectStringIds.top();
     _availableObjectStringIds.pop();
     _languageCurrent->SetString(stringId, target);
+    InvalidateFormatCache();
     return stringId;
 }
 
@@ -142,6 +146,7 @@ void LocalisationService::FreeObjectString(rct_string_id stringId)
         if (_languageCurrent != nullptr)
         {
             _languageCurrent->RemoveString(stringId);
+            InvalidateFormatCache();
         }
         _availableObjectStringIds.push(stringId);
     }
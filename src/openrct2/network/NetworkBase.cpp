@@ -223,6 +223,8 @@ void NetworkBase::DecayCooldown(NetworkPlayer* player)
 
 void NetworkBase::CloseConnection()
 {
+    _ioThread.Stop();
+
     if (mode == NETWORK_MODE_CLIENT)
     {
         _serverConnection.reset();
@@ -258,6 +260,8 @@ bool NetworkBase::BeginClient(const std::string& host, uint16_t port)
     _serverConnection = std::make_unique<NetworkConnection>();
     _serverConnection->Socket = CreateTcpSocket();
     _serverConnection->Socket->ConnectAsync(host, port);
+    _ioThread.AddConnection(_serverConnection.get());
+    _ioThread.Start();
     _serverState.gamestateSnapshotsEnabled = false;
 
     status = NETWORK_STATUS_CONNECTING;
@@ -400,6 +404,7 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
     listening_port = port;
     _serverState.gamestateSnapshotsEnabled = gConfigNetwork.desync_debugging;
     _advertiser = CreateServerAdvertiser(listening_port);
+    _ioThread.Start();
 
     game_load_scripts();
 
@@ -485,17 +490,8 @@ void NetworkBase::Update()
 
 void NetworkBase::Flush()
 {
-    if (GetMode() == NETWORK_MODE_CLIENT)
-    {
-        _serverConnection->SendQueuedPackets();
-    }
-    else
-    {
-        for (auto& it : client_connection_list)
-        {
-            it->SendQueuedPackets();
-        }
-    }
+    // Sending is done by the I/O thread, only let it know there is something to send.
+    _ioThread.Wake();
 }
 
 void NetworkBase::UpdateServer()
@@ -713,6 +709,8 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd)
 {
+    // Frame the packet once, all connections share the same buffer.
+    const auto buffer = packet.ToBuffer();
     for (auto& client_connection : client_connection_list)
     {
         if (gameCmd)
@@ -726,8 +724,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        auto packetCopy = packet;
-        client_connection->QueuePacket(std::move(packetCopy), front);
+        client_connection->QueuePacket(buffer, front);
     }
 }
 
@@ -769,6 +766,25 @@ bool NetworkBase::IsDesynchronised()
     return _serverState.state == NetworkServerState::Desynced;
 }
 
+/**
+ * Whether objects are being negotiated with or downloaded from the other side, the object repository
+ * has to stay as it is until that is finished.
+ */
+bool NetworkBase::IsTransferringObjects() const
+{
+    switch (mode)
+    {
+        case NETWORK_MODE_CLIENT:
+            return !_clientMapLoaded;
+        case NETWORK_MODE_SERVER:
+            return std::any_of(client_connection_list.begin(), client_connection_list.end(), [](const auto& connection) {
+                return connection->NegotiatingObjects;
+            });
+        default:
+            return false;
+    }
+}
+
 bool NetworkBase::CheckDesynchronizaton()
 {
     // Check synchronisation
@@ -1319,16 +1335,17 @@ NetworkStats_t NetworkBase::GetStats() const
     NetworkStats_t stats = {};
     if (mode == NETWORK_MODE_CLIENT)
     {
-        stats = _serverConnection->Stats;
+        stats = _serverConnection->GetStats();
     }
     else
     {
         for (auto& connection : client_connection_list)
         {
+            auto connectionStats = connection->GetStats();
             for (size_t n = 0; n < EnumValue(NetworkStatisticsGroup::Max); n++)
             {
-                stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
-                stats.bytesSent[n] += connection->Stats.bytesSent[n];
+                stats.bytesReceived[n] += connectionStats.bytesReceived[n];
+                stats.bytesSent[n] += connectionStats.bytesSent[n];
             }
         }
     }
@@ -1653,38 +1670,38 @@ void NetworkBase::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName,
 
 bool NetworkBase::ProcessConnection(NetworkConnection& connection)
 {
-    NetworkReadPacket packetStatus;
+    // Sample this before draining, the I/O thread queues all packets it received before flagging the connection as closed.
+    const bool ioClosed = connection.IsIoClosed();
 
-    uint32_t countProcessed = 0;
-    do
+    // Packets arrive fully read from the I/O thread, they are handled here in the order they were received
+    // so game actions are still applied deterministically.
+    NetworkPacket packet;
+    bool drained = true;
+    for (uint32_t countProcessed = 0; countProcessed < MaxPacketsPerUpdate; countProcessed++)
     {
-        countProcessed++;
-        packetStatus = connection.ReadPacket();
-        switch (packetStatus)
+        if (!connection.TryGetInboundPacket(packet))
         {
-            case NetworkReadPacket::Disconnected:
-                // closed connection or network error
-                if (!connection.GetLastDisconnectReason())
-                {
-                    connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
-                }
-                return false;
-            case NetworkReadPacket::Success:
-                // done reading in packet
-                ProcessPacket(connection, connection.InboundPacket);
-                if (!connection.IsValid())
-                {
-                    return false;
-                }
-                break;
-            case NetworkReadPacket::MoreData:
-                // more data required to be read
-                break;
-            case NetworkReadPacket::NoData:
-                // could not read anything from socket
-                break;
+            drained = true;
+            break;
+        }
+        drained = false;
+
+        ProcessPacket(connection, packet);
+        if (!connection.IsValid())
+        {
+            return false;
         }
-    } while (packetStatus == NetworkReadPacket::Success && countProcessed < MaxPacketsPerUpdate);
+    }
+
+    if (ioClosed && drained)
+    {
+        // closed connection or network error
+        if (!connection.GetLastDisconnectReason())
+        {
+            connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+        }
+        return false;
+    }
 
     if (!connection.ReceivedPacketRecently())
     {
@@ -1932,6 +1949,7 @@ void NetworkBase::ProcessDisconnectedClients()
         }
 
         // Make sure to send all remaining packets out before disconnecting.
+        _ioThread.RemoveConnection(connection.get());
         connection->SendQueuedPackets();
         connection->Socket->Disconnect();
 
@@ -1953,6 +1971,7 @@ void NetworkBase::AddClient(std::unique_ptr<ITcpSocket>&& socket)
     auto connection = std::make_unique<NetworkConnection>();
     connection->Socket = std::move(socket);
 
+    _ioThread.AddConnection(connection.get());
     client_connection_list.push_back(std::move(connection));
 }
 
@@ -2280,6 +2299,7 @@ void NetworkBase::Server_Client_Joined(std::string_view name, const std::string&
         auto& objManager = context.GetObjectManager();
         auto objects = objManager.GetPackableObjects();
         Server_Send_OBJECTS_LIST(connection, objects);
+        connection.NegotiatingObjects = true;
         Server_Send_SCRIPTS(connection);
 
         // Log player joining event
@@ -2506,6 +2526,10 @@ void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, Networ
 
     const char* player_name = static_cast<const char*>(connection.Player->Name.c_str());
     Server_Send_MAP(&connection);
+
+    // The map holds copies of the objects, the repository items may go away with the next content update.
+    connection.RequestedObjects.clear();
+    connection.NegotiatingObjects = false;
     Server_Send_EVENT_PLAYER_JOINED(player_name);
     Server_Send_GROUPLIST(connection);
 }
@@ -3260,6 +3284,11 @@ bool network_is_desynchronised()
     return OpenRCT2::GetContext()->GetNetwork().IsDesynchronised();
 }
 
+bool network_is_transferring_objects()
+{
+    return OpenRCT2::GetContext()->GetNetwork().IsTransferringObjects();
+}
+
 bool network_check_desynchronisation()
 {
     return OpenRCT2::GetContext()->GetNetwork().CheckDesynchronizaton();
@@ -4033,6 +4062,10 @@ bool network_is_desynchronised()
 {
     return false;
 }
+bool network_is_transferring_objects()
+{
+    return false;
+}
 bool network_gamestate_snapshots_enabled()
 {
     return false;
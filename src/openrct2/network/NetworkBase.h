@@ -4,6 +4,7 @@
 #include "../actions/GameAction.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
+#include "NetworkIoThread.h"
 #include "NetworkPlayer.h"
 #include "NetworkServerAdvertiser.h"
 #include "NetworkTypes.h"
@@ -124,6 +125,7 @@ public: // Client
     bool CheckDesynchronizaton();
     void RequestStateSnapshot();
     bool IsDesynchronised();
+    bool IsTransferringObjects() const;
     NetworkServerState_t GetServerState() const;
     void ServerClientDisconnected();
     bool LoadMap(OpenRCT2::IStream* stream);
@@ -235,6 +237,10 @@ private: // Client Data
     SocketStatus _lastConnectStatus = SocketStatus::Closed;
     bool _requireReconnect = false;
     bool _clientMapLoaded = false;
+
+private: // I/O
+    // Declared last so it is stopped before any of the connections it refers to are destroyed.
+    NetworkIoThread _ioThread;
 };
 
 #endif // DISABLE_NETWORK
@@ -20,6 +20,9 @@
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
 
+// Limit how much a single connection can read per I/O pass so other connections are not starved.
+constexpr uint32_t MaxPacketsPerIoPass = 100;
+
 NetworkConnection::NetworkConnection()
 {
     ResetLastPacketTime();
@@ -89,7 +92,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             // Received complete packet.
             _lastPacketTime = platform_get_ticks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
 
             return NetworkReadPacket::Success;
         }
@@ -98,61 +101,109 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+bool NetworkConnection::SendPacket(OutboundPacket& packet)
 {
-    auto header = packet.Header;
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
-
-    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
-    // Previously the Id field was not part of the header rather part of the body.
-    header.Size += sizeof(header.Id);
-    header.Size = Convert::HostToNetwork(header.Size);
-    header.Id = ByteSwapBE(header.Id);
-
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
+    const auto& bytes = *packet.Buffer.Bytes;
 
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
+    size_t sent = Socket->SendData(bytes.data() + packet.BytesTransferred, bytes.size() - packet.BytesTransferred);
     if (sent > 0)
     {
         packet.BytesTransferred += sent;
     }
 
-    bool sendComplete = packet.BytesTransferred == buffer.size();
+    bool sendComplete = packet.BytesTransferred == bytes.size();
     if (sendComplete)
     {
-        RecordPacketStats(packet, true);
+        RecordPacketStats(packet.Buffer.Command, bytes.size(), true);
     }
     return sendComplete;
 }
 
-void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
+bool NetworkConnection::TryGetInboundPacket(NetworkPacket& packet)
+{
+    if (_pendingInbound.try_pop(packet))
+    {
+        packet.BytesRead = 0;
+        return true;
+    }
+    return false;
+}
+
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
-        if (front)
+        QueuePacket(packet.ToBuffer(), front);
+    }
+}
+
+void NetworkConnection::QueuePacket(const NetworkPacketBuffer& buffer, bool front)
+{
+    if (AuthStatus == NetworkAuth::Ok || !buffer.CommandRequiresAuth())
+    {
+        _pendingOutbound.push({ buffer, front });
+    }
+}
+
+void NetworkConnection::DequeueOutboundPackets()
+{
+    QueuedPacket queued;
+    while (_pendingOutbound.try_pop(queued))
+    {
+        if (queued.Front)
         {
             // If the first packet was already partially sent add new packet to second position
             if (!_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0)
             {
                 auto it = _outboundPackets.begin();
                 it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
+                _outboundPackets.insert(it, { std::move(queued.Buffer) });
             }
             else
             {
-                _outboundPackets.push_front(std::move(packet));
+                _outboundPackets.push_front({ std::move(queued.Buffer) });
             }
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            _outboundPackets.push_back({ std::move(queued.Buffer) });
+        }
+    }
+}
+
+void NetworkConnection::ProcessIo()
+{
+    if (_ioClosed || Socket->GetStatus() != SocketStatus::Connected)
+    {
+        return;
+    }
+
+    try
+    {
+        SendQueuedPackets();
+
+        for (uint32_t i = 0; i < MaxPacketsPerIoPass; i++)
+        {
+            auto status = ReadPacket();
+            if (status == NetworkReadPacket::Disconnected)
+            {
+                _ioClosed = true;
+                break;
+            }
+            if (status != NetworkReadPacket::Success)
+            {
+                break;
+            }
+
+            _pendingInbound.push(std::move(InboundPacket));
+            InboundPacket = {};
         }
     }
+    catch (const std::exception& ex)
+    {
+        log_verbose("Network I/O error: %s", ex.what());
+        _ioClosed = true;
+    }
 }
 
 void NetworkConnection::Disconnect()
@@ -165,8 +216,14 @@ bool NetworkConnection::IsValid() const
     return !ShouldDisconnect && Socket->GetStatus() == SocketStatus::Connected;
 }
 
+bool NetworkConnection::IsIoClosed() const
+{
+    return _ioClosed;
+}
+
 void NetworkConnection::SendQueuedPackets()
 {
+    DequeueOutboundPackets();
     while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
     {
         _outboundPackets.pop_front();
@@ -206,12 +263,22 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+NetworkStats_t NetworkConnection::GetStats() const
+{
+    NetworkStats_t stats = {};
+    for (size_t n = 0; n < EnumValue(NetworkStatisticsGroup::Max); n++)
+    {
+        stats.bytesReceived[n] = _bytesReceived[n].load(std::memory_order_relaxed);
+        stats.bytesSent[n] = _bytesSent[n].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void NetworkConnection::RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (command)
     {
         case NetworkCommand::GameAction:
             trafficGroup = NetworkStatisticsGroup::Commands;
@@ -224,16 +291,9 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
             break;
     }
 
-    if (sending)
-    {
-        Stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
-    }
-    else
-    {
-        Stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
-    }
+    auto& counters = sending ? _bytesSent : _bytesReceived;
+    counters[EnumValue(trafficGroup)].fetch_add(packetSize, std::memory_order_relaxed);
+    counters[EnumValue(NetworkStatisticsGroup::Total)].fetch_add(packetSize, std::memory_order_relaxed);
 }
 
 #endif
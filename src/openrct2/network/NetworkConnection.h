@@ -11,11 +11,14 @@
 
 #ifndef DISABLE_NETWORK
 #    include "../common.h"
+#    include "../core/LockFreeQueue.h"
 #    include "NetworkKey.h"
 #    include "NetworkPacket.h"
 #    include "NetworkTypes.h"
 #    include "Socket.h"
 
+#    include <array>
+#    include <atomic>
 #    include <deque>
 #    include <memory>
 #    include <string_view>
@@ -30,45 +33,69 @@ public:
     std::unique_ptr<ITcpSocket> Socket = nullptr;
     NetworkPacket InboundPacket;
     NetworkAuth AuthStatus = NetworkAuth::None;
-    NetworkStats_t Stats = {};
     NetworkPlayer* Player = nullptr;
     uint32_t PingTime = 0;
     NetworkKey Key;
     std::vector<uint8_t> Challenge;
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
+    // Set from sending the object list until the map is sent, the client picks objects from the repository meanwhile.
+    bool NegotiatingObjects = false;
     bool ShouldDisconnect = false;
 
     NetworkConnection();
     ~NetworkConnection();
 
     NetworkReadPacket ReadPacket();
-    void QueuePacket(NetworkPacket&& packet, bool front = false);
-    void QueuePacket(const NetworkPacket& packet, bool front = false)
-    {
-        auto copy = packet;
-        return QueuePacket(std::move(copy), front);
-    }
+    bool TryGetInboundPacket(NetworkPacket& packet);
+    void QueuePacket(const NetworkPacket& packet, bool front = false);
+    void QueuePacket(const NetworkPacketBuffer& buffer, bool front = false);
 
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
     void Disconnect();
 
     bool IsValid() const;
+    bool IsIoClosed() const;
     void SendQueuedPackets();
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
+    NetworkStats_t GetStats() const;
+
+    // Called from the network I/O thread, reads and writes as much as the socket allows without blocking.
+    void ProcessIo();
 
     const utf8* GetLastDisconnectReason() const;
     void SetLastDisconnectReason(std::string_view src);
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
-    uint32_t _lastPacketTime = 0;
+    struct QueuedPacket
+    {
+        NetworkPacketBuffer Buffer;
+        bool Front = false;
+    };
+
+    struct OutboundPacket
+    {
+        NetworkPacketBuffer Buffer;
+        size_t BytesTransferred = 0;
+    };
+
+    // Game thread -> I/O thread.
+    LockFreeQueue<QueuedPacket> _pendingOutbound;
+    // I/O thread -> game thread, only complete packets.
+    LockFreeQueue<NetworkPacket> _pendingInbound;
+    // Only accessed by the I/O thread, or the game thread once the connection is no longer registered with it.
+    std::deque<OutboundPacket> _outboundPackets;
+    std::atomic<uint32_t> _lastPacketTime = { 0 };
+    std::atomic_bool _ioClosed = { false };
+    std::array<std::atomic<uint64_t>, EnumValue(NetworkStatisticsGroup::Max)> _bytesReceived{};
+    std::array<std::atomic<uint64_t>, EnumValue(NetworkStatisticsGroup::Max)> _bytesSent{};
     std::string _lastDisconnectReason;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending);
+    bool SendPacket(OutboundPacket& packet);
+    void DequeueOutboundPackets();
 };
 
 #endif // DISABLE_NETWORK
@@ -0,0 +1,89 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkIoThread.h"
+
+#    include "NetworkConnection.h"
+
+#    include <algorithm>
+#    include <chrono>
+
+// Sockets are non-blocking, so the thread polls them at this interval unless it is woken up early.
+static constexpr auto IoPollInterval = std::chrono::milliseconds(1);
+
+NetworkIoThread::~NetworkIoThread()
+{
+    Stop();
+}
+
+void NetworkIoThread::Start()
+{
+    if (_thread.joinable())
+        return;
+
+    _shouldStop = false;
+    _thread = std::thread(&NetworkIoThread::Run, this);
+}
+
+void NetworkIoThread::Stop()
+{
+    if (_thread.joinable())
+    {
+        {
+            unique_lock lock(_wakeMutex);
+            _shouldStop = true;
+            _wakeCondition.notify_one();
+        }
+        _thread.join();
+    }
+
+    unique_lock lock(_connectionsMutex);
+    _connections.clear();
+}
+
+void NetworkIoThread::AddConnection(NetworkConnection* connection)
+{
+    unique_lock lock(_connectionsMutex);
+    _connections.push_back(connection);
+}
+
+void NetworkIoThread::RemoveConnection(NetworkConnection* connection)
+{
+    unique_lock lock(_connectionsMutex);
+    _connections.erase(std::remove(_connections.begin(), _connections.end(), connection), _connections.end());
+}
+
+void NetworkIoThread::Wake()
+{
+    unique_lock lock(_wakeMutex);
+    _wakeRequested = true;
+    _wakeCondition.notify_one();
+}
+
+void NetworkIoThread::Run()
+{
+    while (!_shouldStop)
+    {
+        {
+            unique_lock lock(_connectionsMutex);
+            for (auto* connection : _connections)
+            {
+                connection->ProcessIo();
+            }
+        }
+
+        unique_lock lock(_wakeMutex);
+        _wakeCondition.wait_for(lock, IoPollInterval, [this]() { return _wakeRequested || _shouldStop; });
+        _wakeRequested = false;
+    }
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+
+#    include <atomic>
+#    include <condition_variable>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+class NetworkConnection;
+
+/**
+ * Performs all socket reads and writes for the registered connections on a dedicated thread,
+ * so that a slow client or a burst of traffic does not hold up the game tick. Packets are
+ * exchanged with the game thread through the lock-free queues of each connection.
+ */
+class NetworkIoThread final
+{
+private:
+    std::thread _thread;
+    std::vector<NetworkConnection*> _connections;
+    std::mutex _connectionsMutex;
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
+    std::atomic_bool _shouldStop = { false };
+    bool _wakeRequested = false;
+
+    using unique_lock = std::unique_lock<std::mutex>;
+
+public:
+    NetworkIoThread() = default;
+    NetworkIoThread(const NetworkIoThread&) = delete;
+    NetworkIoThread& operator=(const NetworkIoThread&) = delete;
+    ~NetworkIoThread();
+
+    void Start();
+    void Stop();
+
+    void AddConnection(NetworkConnection* connection);
+
+    // Blocks until the I/O thread no longer touches the connection.
+    void RemoveConnection(NetworkConnection* connection);
+
+    // Requests an immediate I/O pass, e.g. after the game thread has queued packets.
+    void Wake();
+
+private:
+    void Run();
+};
+
+#endif // DISABLE_NETWORK
@@ -12,8 +12,84 @@
 #    include "NetworkPacket.h"
 
 #    include "NetworkTypes.h"
+#    include "Socket.h"
 
 #    include <memory>
+#    include <mutex>
+
+// Packets are at most 64 KiB, keeping a few hundred buffers around covers a busy server.
+static constexpr size_t MaxPooledPacketBuffers = 256;
+
+class NetworkPacketBufferPool final : public std::enable_shared_from_this<NetworkPacketBufferPool>
+{
+private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<std::vector<uint8_t>>> _available;
+
+public:
+    std::shared_ptr<std::vector<uint8_t>> Acquire()
+    {
+        std::unique_ptr<std::vector<uint8_t>> buffer;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_available.empty())
+            {
+                buffer = std::move(_available.back());
+                _available.pop_back();
+            }
+        }
+        if (buffer == nullptr)
+        {
+            buffer = std::make_unique<std::vector<uint8_t>>();
+        }
+
+        // The buffer may be released from the network I/O thread, keep the pool alive until then.
+        return std::shared_ptr<std::vector<uint8_t>>(
+            buffer.release(), [pool = shared_from_this()](std::vector<uint8_t>* released) { pool->Release(released); });
+    }
+
+private:
+    void Release(std::vector<uint8_t>* buffer)
+    {
+        std::unique_ptr<std::vector<uint8_t>> owned(buffer);
+        owned->clear();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_available.size() < MaxPooledPacketBuffers)
+        {
+            _available.push_back(std::move(owned));
+        }
+    }
+};
+
+static NetworkPacketBufferPool& GetPacketBufferPool()
+{
+    static auto pool = std::make_shared<NetworkPacketBufferPool>();
+    return *pool;
+}
+
+static bool NetworkCommandRequiresAuth(NetworkCommand command)
+{
+    switch (command)
+    {
+        case NetworkCommand::Ping:
+        case NetworkCommand::Auth:
+        case NetworkCommand::Token:
+        case NetworkCommand::GameInfo:
+        case NetworkCommand::ObjectsList:
+        case NetworkCommand::Scripts:
+        case NetworkCommand::MapRequest:
+        case NetworkCommand::Heartbeat:
+            return false;
+        default:
+            return true;
+    }
+}
+
+bool NetworkPacketBuffer::CommandRequiresAuth() const
+{
+    return NetworkCommandRequiresAuth(Command);
+}
 
 NetworkPacket::NetworkPacket(NetworkCommand id)
     : Header{ 0, id }
@@ -42,22 +118,26 @@ void NetworkPacket::Clear()
     Data.clear();
 }
 
-bool NetworkPacket::CommandRequiresAuth()
+bool NetworkPacket::CommandRequiresAuth() const
 {
-    switch (GetCommand())
-    {
-        case NetworkCommand::Ping:
-        case NetworkCommand::Auth:
-        case NetworkCommand::Token:
-        case NetworkCommand::GameInfo:
-        case NetworkCommand::ObjectsList:
-        case NetworkCommand::Scripts:
-        case NetworkCommand::MapRequest:
-        case NetworkCommand::Heartbeat:
-            return false;
-        default:
-            return true;
-    }
+    return NetworkCommandRequiresAuth(GetCommand());
+}
+
+NetworkPacketBuffer NetworkPacket::ToBuffer() const
+{
+    PacketHeader header;
+    header.Id = ByteSwapBE(GetCommand());
+
+    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
+    // Previously the Id field was not part of the header rather part of the body.
+    header.Size = Convert::HostToNetwork(static_cast<uint16_t>(Data.size() + sizeof(header.Id)));
+
+    auto bytes = GetPacketBufferPool().Acquire();
+    bytes->reserve(sizeof(header) + Data.size());
+    bytes->insert(bytes->end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+    bytes->insert(bytes->end(), Data.begin(), Data.end());
+
+    return { GetCommand(), std::move(bytes) };
 }
 
 void NetworkPacket::Write(const void* bytes, size_t size)
@@ -25,6 +25,19 @@ struct PacketHeader
 static_assert(sizeof(PacketHeader) == 6);
 #pragma pack(pop)
 
+/**
+ * A packet framed for sending, header included. The bytes are immutable and reference counted so
+ * the same buffer can be queued on any number of connections without copying, the storage is
+ * returned to a pool once the last connection has sent it.
+ */
+struct NetworkPacketBuffer
+{
+    NetworkCommand Command = NetworkCommand::Invalid;
+    std::shared_ptr<const std::vector<uint8_t>> Bytes;
+
+    bool CommandRequiresAuth() const;
+};
+
 struct NetworkPacket final
 {
     NetworkPacket() = default;
@@ -36,7 +49,9 @@ struct NetworkPacket final
     NetworkCommand GetCommand() const;
 
     void Clear();
-    bool CommandRequiresAuth();
+    bool CommandRequiresAuth() const;
+
+    NetworkPacketBuffer ToBuffer() const;
 
     const uint8_t* Read(size_t size);
     std::string_view ReadString();
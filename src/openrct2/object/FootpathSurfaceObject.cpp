@@ -21,7 +21,7 @@ void FootpathSurfaceObject::Load()
     auto numImages = GetImageTable().GetCount();
     if (numImages != 0)
     {
-        PreviewImageId = gfx_object_allocate_images(GetImageTable().GetImages(), GetImageTable().GetCount());
+        PreviewImageId = GetImageTable().AllocateImages();
         BaseImageId = PreviewImageId + 1;
     }
 
@@ -24,8 +24,11 @@
 #include "ObjectFactory.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
+#include <optional>
 #include <stdexcept>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -34,6 +37,7 @@ struct ImageTable::RequiredImage
 {
     rct_g1_element g1{};
     std::unique_ptr<RequiredImage> next_zoom;
+    std::optional<size_t> deferred_image;
 
     bool HasData() const
     {
@@ -80,6 +84,209 @@ struct ImageTable::RequiredImage
     }
 };
 
+struct ImageTable::DeferredImageSource final : public IDeferredImageSource
+{
+    struct SourceFile
+    {
+        std::string Path;
+        ObjectAsset Asset;
+        IMAGE_FORMAT Format{};
+        // Read from the header when the object loads.
+        uint32_t Width{};
+        uint32_t Height{};
+        std::optional<Image> Decoded;
+        size_t NumPending{};
+    };
+
+    struct PendingImage
+    {
+        size_t FileIndex{};
+        int16_t X{};
+        int16_t Y{};
+        int16_t SrcX{};
+        int16_t SrcY{};
+        int16_t SrcWidth{};
+        int16_t SrcHeight{};
+        int32_t ZoomOffset{};
+        ImageImporter::IMPORT_FLAGS Flags{};
+        std::vector<uint8_t> Buffer;
+    };
+
+    std::string ObjectIdentifier;
+    std::vector<SourceFile> Files;
+    std::vector<PendingImage> Images;
+    std::unordered_map<uint32_t, size_t> ImagesByTableIndex;
+
+    /**
+     * Records where the image described by el comes from, only the header of the image file is read to check
+     * the file and the source rectangle. Returns nothing if the source rectangle does not fit the file.
+     * @note el is deliberately left non-const: json_t behaviour changes when const
+     */
+    std::optional<size_t> AddImage(IReadObjectContext* context, json_t& el)
+    {
+        auto path = Json::GetString(el["path"]);
+        auto keepPalette = Json::GetString(el["palette"]) == "keep";
+
+        PendingImage image;
+        image.X = Json::GetNumber<int16_t>(el["x"]);
+        image.Y = Json::GetNumber<int16_t>(el["y"]);
+        image.SrcX = Json::GetNumber<int16_t>(el["srcX"]);
+        image.SrcY = Json::GetNumber<int16_t>(el["srcY"]);
+        image.SrcWidth = Json::GetNumber<int16_t>(el["srcWidth"]);
+        image.SrcHeight = Json::GetNumber<int16_t>(el["srcHeight"]);
+        image.ZoomOffset = Json::GetNumber<int32_t>(el["zoom"]);
+        image.Flags = ImageImporter::IMPORT_FLAGS::NONE;
+        if (Json::GetString(el["format"]) != "raw")
+        {
+            image.Flags = static_cast<ImageImporter::IMPORT_FLAGS>(image.Flags | ImageImporter::IMPORT_FLAGS::RLE);
+        }
+        if (keepPalette)
+        {
+            image.Flags = static_cast<ImageImporter::IMPORT_FLAGS>(image.Flags | ImageImporter::IMPORT_FLAGS::KEEP_PALETTE);
+        }
+
+        // The first image that uses a file decides how the file is decoded.
+        auto itFile = std::find_if(Files.begin(), Files.end(), [&path](const SourceFile& file) { return file.Path == path; });
+        if (itFile == Files.end())
+        {
+            auto& file = Files.emplace_back();
+            file.Path = path;
+            file.Asset = context->GetAsset(path);
+            file.Format = keepPalette ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32;
+            // A file that can not be read fails the object, as it did when every image was decoded up front
+            ReadFileSize(file);
+            itFile = Files.end() - 1;
+        }
+
+        auto srcRight = image.SrcX + (image.SrcWidth == 0 ? static_cast<int32_t>(itFile->Width) : image.SrcWidth);
+        auto srcBottom = image.SrcY + (image.SrcHeight == 0 ? static_cast<int32_t>(itFile->Height) : image.SrcHeight);
+        if (image.SrcX < 0 || image.SrcY < 0 || srcRight > static_cast<int32_t>(itFile->Width)
+            || srcBottom > static_cast<int32_t>(itFile->Height))
+        {
+            auto msg = String::StdFormat(
+                "Unable to load image '%s': Source rectangle is outside of the %ux%u image.", path.c_str(), itFile->Width,
+                itFile->Height);
+            context->LogWarning(ObjectError::BadImageTable, msg.c_str());
+            return std::nullopt;
+        }
+        image.FileIndex = static_cast<size_t>(itFile - Files.begin());
+
+        Images.push_back(std::move(image));
+        return Images.size() - 1;
+    }
+
+    void SetTableIndex(size_t image, uint32_t tableIndex)
+    {
+        ImagesByTableIndex[tableIndex] = image;
+        Files[Images[image].FileIndex].NumPending++;
+    }
+
+    bool IsDeferred(uint32_t index) const override
+    {
+        return ImagesByTableIndex.find(index) != ImagesByTableIndex.end();
+    }
+
+    rct_g1_element DecodeImage(uint32_t index) override
+    {
+        auto it = ImagesByTableIndex.find(index);
+        if (it == ImagesByTableIndex.end())
+        {
+            return {};
+        }
+
+        auto& image = Images[it->second];
+        auto& file = Files[image.FileIndex];
+        rct_g1_element result{};
+        try
+        {
+            if (!file.Decoded.has_value())
+            {
+                file.Decoded = ReadFile(file);
+            }
+
+            auto& source = *file.Decoded;
+            auto srcWidth = image.SrcWidth == 0 ? static_cast<int16_t>(source.Width) : image.SrcWidth;
+            auto srcHeight = image.SrcHeight == 0 ? static_cast<int16_t>(source.Height) : image.SrcHeight;
+
+            ImageImporter importer;
+            auto importResult = importer.Import(
+                source, image.SrcX, image.SrcY, srcWidth, srcHeight, image.X, image.Y, image.Flags);
+            image.Buffer = std::move(importResult.Buffer);
+            result = importResult.Element;
+            result.offset = image.Buffer.data();
+            result.zoomed_offset = image.ZoomOffset;
+        }
+        catch (const std::exception& e)
+        {
+            log_warning("[%s] Unable to load image '%s': %s", ObjectIdentifier.c_str(), file.Path.c_str(), e.what());
+        }
+
+        // Keep the decoded file only for as long as some of its images have not been drawn yet.
+        if (file.NumPending > 0 && --file.NumPending == 0)
+        {
+            file.Decoded.reset();
+        }
+        return result;
+    }
+
+private:
+    /**
+     * Reads the size of the image from the PNG header without decoding any of the image.
+     */
+    static void ReadFileSize(SourceFile& file)
+    {
+        static constexpr uint8_t PngSignature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+        auto stream = file.Asset.GetStream();
+        if (stream == nullptr)
+        {
+            throw std::runtime_error("Unable to open image file.");
+        }
+
+        // Signature, then the IHDR chunk which starts with the width and height
+        uint8_t header[24];
+        if (stream->GetLength() < sizeof(header))
+        {
+            throw std::runtime_error("Image file is too short.");
+        }
+        stream->Read(header, sizeof(header));
+        if (std::memcmp(header, PngSignature, sizeof(PngSignature)) != 0 || std::memcmp(header + 12, "IHDR", 4) != 0)
+        {
+            throw std::runtime_error("Image file is not a PNG.");
+        }
+
+        auto readUInt32BE = [](const uint8_t* src) -> uint32_t {
+            return (static_cast<uint32_t>(src[0]) << 24) | (src[1] << 16) | (src[2] << 8) | src[3];
+        };
+        file.Width = readUInt32BE(header + 16);
+        file.Height = readUInt32BE(header + 20);
+        if (file.Width == 0 || file.Height == 0)
+        {
+            throw std::runtime_error("Image file has no pixels.");
+        }
+    }
+
+    static Image ReadFile(const SourceFile& file)
+    {
+        auto stream = file.Asset.GetStream();
+        if (stream == nullptr)
+        {
+            throw std::runtime_error("Unable to open image file.");
+        }
+
+        // Assets in memory or stored uncompressed in their archive can be decoded where they are
+        auto streamData = stream->GetData();
+        if (streamData != nullptr)
+        {
+            return Imaging::ReadFromBuffer(streamData, static_cast<size_t>(stream->GetLength()), file.Format);
+        }
+
+        std::vector<uint8_t> data(static_cast<size_t>(stream->GetLength()));
+        stream->Read(data.data(), data.size());
+        return Imaging::ReadFromBuffer(data, file.Format);
+    }
+};
+
 std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(IReadObjectContext* context, std::string s)
 {
     std::vector<std::unique_ptr<RequiredImage>> result;
@@ -149,65 +356,6 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
     return result;
 }
 
-std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
-    IReadObjectContext* context, std::vector<std::pair<std::string, Image>>& imageSources, json_t& el)
-{
-    Guard::Assert(el.is_object(), "ImageTable::ParseImages expects parameter el to be object");
-
-    auto path = Json::GetString(el["path"]);
-    auto x = Json::GetNumber<int16_t>(el["x"]);
-    auto y = Json::GetNumber<int16_t>(el["y"]);
-    auto srcX = Json::GetNumber<int16_t>(el["srcX"]);
-    auto srcY = Json::GetNumber<int16_t>(el["srcY"]);
-    auto srcWidth = Json::GetNumber<int16_t>(el["srcWidth"]);
-    auto srcHeight = Json::GetNumber<int16_t>(el["srcHeight"]);
-    auto raw = Json::GetString(el["format"]) == "raw";
-    auto keepPalette = Json::GetString(el["palette"]) == "keep";
-    auto zoomOffset = Json::GetNumber<int32_t>(el["zoom"]);
-
-    std::vector<std::unique_ptr<RequiredImage>> result;
-    try
-    {
-        auto flags = ImageImporter::IMPORT_FLAGS::NONE;
-        if (!raw)
-        {
-            flags = static_cast<ImageImporter::IMPORT_FLAGS>(flags | ImageImporter::IMPORT_FLAGS::RLE);
-        }
-        if (keepPalette)
-        {
-            flags = static_cast<ImageImporter::IMPORT_FLAGS>(flags | ImageImporter::IMPORT_FLAGS::KEEP_PALETTE);
-        }
-
-        auto itSource = std::find_if(
-            imageSources.begin(), imageSources.end(),
-            [&path](const std::pair<std::string, Image>& item) { return item.first == path; });
-        if (itSource == imageSources.end())
-        {
-            throw std::runtime_error("Unable to find image in image source list.");
-        }
-        auto& image = itSource->second;
-
-        if (srcWidth == 0)
-            srcWidth = image.Width;
-
-        if (srcHeight == 0)
-            srcHeight = image.Height;
-
-        ImageImporter importer;
-        auto importResult = importer.Import(image, srcX, srcY, srcWidth, srcHeight, x, y, flags);
-        auto g1element = importResult.Element;
-        g1element.zoomed_offset = zoomOffset;
-        result.push_back(std::make_unique<RequiredImage>(g1element));
-    }
-    catch (const std::exception& e)
-    {
-        auto msg = String::StdFormat("Unable to load image '%s': %s", path.c_str(), e.what());
-        context->LogWarning(ObjectError::BadImageTable, msg.c_str());
-        result.push_back(std::make_unique<RequiredImage>());
-    }
-    return result;
-}
-
 std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectImages(
     IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range)
 {
@@ -341,7 +489,7 @@ ImageTable::~ImageTable()
 
 void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
 {
-    if (gOpenRCT2NoGraphics)
+    if (!context->ShouldLoadImages())
     {
         return;
     }
@@ -408,41 +556,18 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
     }
 }
 
-std::vector<std::pair<std::string, Image>> ImageTable::GetImageSources(IReadObjectContext* context, json_t& jsonImages)
-{
-    std::vector<std::pair<std::string, Image>> result;
-    for (auto& jsonImage : jsonImages)
-    {
-        if (jsonImage.is_object())
-        {
-            auto path = Json::GetString(jsonImage["path"]);
-            auto keepPalette = Json::GetString(jsonImage["palette"]) == "keep";
-            auto itSource = std::find_if(result.begin(), result.end(), [&path](const std::pair<std::string, Image>& item) {
-                return item.first == path;
-            });
-            if (itSource == result.end())
-            {
-                auto imageData = context->GetData(path);
-                auto imageFormat = keepPalette ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32;
-                auto image = Imaging::ReadFromBuffer(imageData, imageFormat);
-                auto pair = std::make_pair<std::string, Image>(std::move(path), std::move(image));
-                result.push_back(std::move(pair));
-            }
-        }
-    }
-    return result;
-}
-
 void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
 {
     Guard::Assert(root.is_object(), "ImageTable::ReadJson expects parameter root to be object");
 
     if (context->ShouldLoadImages())
     {
-        // First gather all the required images from inspecting the JSON
+        // First gather all the required images from inspecting the JSON, images from the object's own
+        // files are not read until they are first drawn.
         std::vector<std::unique_ptr<RequiredImage>> allImages;
         auto jsonImages = root["images"];
-        auto imageSources = GetImageSources(context, jsonImages);
+        auto deferredSource = std::make_shared<DeferredImageSource>();
+        deferredSource->ObjectIdentifier = context->GetObjectIdentifier();
 
         for (auto& jsonImage : jsonImages)
         {
@@ -455,9 +580,9 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
             }
             else if (jsonImage.is_object())
             {
-                auto images = ParseImages(context, imageSources, jsonImage);
-                allImages.insert(
-                    allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
+                // Images that can not be loaded stay in the table as empty images, like before
+                auto& image = allImages.emplace_back(std::make_unique<RequiredImage>());
+                image->deferred_image = deferredSource->AddImage(context, jsonImage);
             }
         }
 
@@ -465,9 +590,17 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
         auto imagesStartIndex = GetCount();
         for (const auto& img : allImages)
         {
+            if (img->deferred_image.has_value())
+            {
+                deferredSource->SetTableIndex(*img->deferred_image, GetCount());
+            }
             const auto& g1 = img->g1;
             AddImage(&g1);
         }
+        if (!deferredSource->Images.empty())
+        {
+            _deferredSource = std::move(deferredSource);
+        }
 
         // Add all the zoom images at the very end of the image table.
         // This way it should not affect the offsets used within the object logic.
@@ -498,6 +631,11 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
     }
 }
 
+uint32_t ImageTable::AllocateImages() const
+{
+    return gfx_object_allocate_images(_entries.data(), GetCount(), _deferredSource);
+}
+
 void ImageTable::AddImage(const rct_g1_element* g1)
 {
     rct_g1_element newg1 = *g1;
@@ -16,7 +16,6 @@
 #include <memory>
 #include <vector>
 
-struct Image;
 struct IReadObjectContext;
 namespace OpenRCT2
 {
@@ -26,21 +25,21 @@ namespace OpenRCT2
 class ImageTable
 {
 private:
+    /**
+     * Images taken from the object's own files, these are only decoded once they are drawn.
+     */
+    struct DeferredImageSource;
+
     std::unique_ptr<uint8_t[]> _data;
     std::vector<rct_g1_element> _entries;
+    std::shared_ptr<DeferredImageSource> _deferredSource;
 
     /**
      * Container for a G1 image, additional information and RAII. Used by ReadJson
      */
     struct RequiredImage;
-    [[nodiscard]] std::vector<std::pair<std::string, Image>> GetImageSources(IReadObjectContext* context, json_t& jsonImages);
     [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> ParseImages(
         IReadObjectContext* context, std::string s);
-    /**
-     * @note root is deliberately left non-const: json_t behaviour changes when const
-     */
-    [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> ParseImages(
-        IReadObjectContext* context, std::vector<std::pair<std::string, Image>>& imageSources, json_t& el);
     [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadObjectImages(
         IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range);
     [[nodiscard]] static std::vector<int32_t> ParseRange(std::string s);
@@ -66,4 +65,8 @@ public:
         return static_cast<uint32_t>(_entries.size());
     }
     void AddImage(const rct_g1_element* g1);
+    /**
+     * Registers the images with the drawing code, see gfx_object_allocate_images.
+     */
+    uint32_t AllocateImages() const;
 };
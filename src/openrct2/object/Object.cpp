@@ -13,6 +13,7 @@
 #include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/Memory.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/String.hpp"
 #include "../core/ZipStream.hpp"
 #include "../localisation/Language.h"
@@ -274,23 +275,31 @@ bool rct_object_entry::operator!=(const rct_object_entry& rhs) const
 
 bool ObjectAsset::IsAvailable() const
 {
+    if (_data != nullptr)
+    {
+        return true;
+    }
     if (_zipPath.empty())
     {
         return File::Exists(_path);
     }
 
-    auto zipArchive = Zip::TryOpen(_zipPath, ZIP_ACCESS::READ);
+    auto zipArchive = Zip::OpenShared(_zipPath);
     return zipArchive != nullptr && zipArchive->Exists(_path);
 }
 
 uint64_t ObjectAsset::GetSize() const
 {
+    if (_data != nullptr)
+    {
+        return _dataSize;
+    }
     if (_zipPath.empty())
     {
         return File::GetSize(_path);
     }
 
-    auto zipArchive = Zip::TryOpen(_zipPath, ZIP_ACCESS::READ);
+    auto zipArchive = Zip::OpenShared(_zipPath);
     if (zipArchive != nullptr)
     {
         auto index = zipArchive->GetIndexFromPath(_path);
@@ -305,14 +314,30 @@ uint64_t ObjectAsset::GetSize() const
 
 std::unique_ptr<IStream> ObjectAsset::GetStream() const
 {
+    if (_data != nullptr)
+    {
+        return std::make_unique<MemoryStream>(_data.get(), _dataSize);
+    }
     if (_zipPath.empty())
     {
         return std::make_unique<FileStream>(_path, FILE_MODE_OPEN);
     }
 
-    auto zipArchive = Zip::TryOpen(_zipPath, ZIP_ACCESS::READ);
+    auto zipArchive = Zip::OpenShared(_zipPath);
     if (zipArchive != nullptr)
     {
+        auto index = zipArchive->GetIndexFromPath(_path);
+        if (index.has_value())
+        {
+            // Files stored uncompressed are read straight from the archive's memory mapping
+            auto data = zipArchive->GetMappedFileData(index.value());
+            if (data != nullptr)
+            {
+                auto size = static_cast<size_t>(zipArchive->GetFileSize(index.value()));
+                return std::make_unique<ZipStreamWrapper>(zipArchive, std::make_unique<MemoryStream>(data.get(), size));
+            }
+        }
+
         auto stream = zipArchive->GetFileStream(_path);
         if (stream != nullptr)
         {
@@ -211,6 +211,8 @@ class ObjectAsset
 private:
     std::string _zipPath;
     std::string _path;
+    std::shared_ptr<const uint8_t> _data;
+    size_t _dataSize{};
 
 public:
     ObjectAsset() = default;
@@ -223,6 +225,14 @@ public:
         , _path(path)
     {
     }
+    /**
+     * An asset that is already in memory, data must stay valid for as long as the asset or any copy of it exists.
+     */
+    ObjectAsset(std::shared_ptr<const uint8_t> data, size_t dataSize)
+        : _data(std::move(data))
+        , _dataSize(dataSize)
+    {
+    }
 
     [[nodiscard]] bool IsAvailable() const;
     [[nodiscard]] uint64_t GetSize() const;
@@ -0,0 +1,271 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ObjectCache.h"
+
+#include "../core/Console.hpp"
+#include "../core/DataSerialiser.h"
+#include "../core/File.h"
+#include "../core/FileStream.h"
+#include "../core/Json.hpp"
+#include "../core/MemoryMappedFile.h"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../core/Zip.h"
+#include "../rct12/SawyerChunkReader.h"
+
+#include <tuple>
+
+using namespace OpenRCT2;
+
+static constexpr uint32_t MAGIC_NUMBER = 0x4843424F; // OBCH
+static constexpr uint16_t VERSION = 1;
+
+static ObjectCacheEntryKind GetEntryKind(const std::string& path)
+{
+    auto extension = Path::GetExtension(path);
+    if (String::Equals(extension, ".json", true))
+    {
+        return ObjectCacheEntryKind::Json;
+    }
+    if (String::Equals(extension, ".parkobj", true))
+    {
+        return ObjectCacheEntryKind::ParkObj;
+    }
+    return ObjectCacheEntryKind::Legacy;
+}
+
+static uint64_t WriteBlob(IStream& stream, const void* data, size_t dataSize)
+{
+    auto offset = stream.GetPosition();
+    stream.Write(data, dataSize);
+    return offset;
+}
+
+/**
+ * Reads the object file at path, appends its data and assets to stream and its entry to table.
+ */
+static void WriteEntry(IStream& stream, const std::string& path, DataSerialiser& table)
+{
+    auto kind = GetEntryKind(path);
+    auto size = File::GetSize(path);
+    auto lastModified = File::GetLastModified(path);
+
+    rct_object_entry objectEntry{};
+    uint64_t dataOffset{};
+    uint64_t dataSize{};
+    std::vector<std::tuple<std::string, uint64_t, uint64_t>> assets;
+    if (kind == ObjectCacheEntryKind::Legacy)
+    {
+        auto fs = FileStream(path, FILE_MODE_OPEN);
+        objectEntry = fs.ReadValue<rct_object_entry>();
+        auto chunk = SawyerChunkReader(&fs).ReadChunk();
+        dataOffset = WriteBlob(stream, chunk->GetData(), chunk->GetLength());
+        dataSize = chunk->GetLength();
+    }
+    else if (kind == ObjectCacheEntryKind::Json)
+    {
+        auto msgpack = json_t::to_msgpack(Json::ReadFromFile(path.c_str()));
+        dataOffset = WriteBlob(stream, msgpack.data(), msgpack.size());
+        dataSize = msgpack.size();
+    }
+    else
+    {
+        auto archive = Zip::Open(path, ZIP_ACCESS::READ);
+        auto jsonBytes = archive->GetFileData("object.json");
+        if (jsonBytes.empty())
+        {
+            throw std::runtime_error("Unable to open object.json.");
+        }
+        auto msgpack = json_t::to_msgpack(Json::FromVector(jsonBytes));
+        dataOffset = WriteBlob(stream, msgpack.data(), msgpack.size());
+        dataSize = msgpack.size();
+
+        // Assets are stored uncompressed so that they can be read straight from the mapping
+        for (size_t i = 0; i < archive->GetNumFiles(); i++)
+        {
+            auto name = archive->GetFileName(i);
+            if (name == "object.json" || String::EndsWith(name, "/"))
+            {
+                continue;
+            }
+            auto assetData = archive->GetFileData(name);
+            auto assetOffset = WriteBlob(stream, assetData.data(), assetData.size());
+            assets.emplace_back(name, assetOffset, assetData.size());
+        }
+    }
+
+    auto rawKind = static_cast<uint8_t>(kind);
+    auto numAssets = static_cast<uint32_t>(assets.size());
+    table << path << size << lastModified << rawKind << objectEntry << dataOffset << dataSize << numAssets;
+    for (auto& [name, assetOffset, assetSize] : assets)
+    {
+        table << name << assetOffset << assetSize;
+    }
+}
+
+size_t ObjectCache::Build(const std::string& path, const std::vector<std::string>& objectPaths)
+{
+    // Processes may still have the old cache mapped, so the new one is written next to it and then moved over
+    // it rather than being rewritten in place.
+    auto tempPath = path + ".tmp";
+    uint32_t numEntries = 0;
+    {
+        auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+        fs.WriteValue<uint32_t>(0);
+        fs.WriteValue<uint16_t>(0);
+        fs.WriteValue<uint16_t>(0);
+        fs.WriteValue<uint32_t>(0);
+        fs.WriteValue<uint64_t>(0);
+        fs.WriteValue<uint64_t>(0);
+
+        // Entries only go into the table once all of their data has been written
+        MemoryStream table;
+        DataSerialiser ds(true, table);
+        for (const auto& objectPath : objectPaths)
+        {
+            try
+            {
+                WriteEntry(fs, objectPath, ds);
+                numEntries++;
+            }
+            catch (const std::exception& e)
+            {
+                Console::Error::WriteLine("Unable to cache '%s': %s", objectPath.c_str(), e.what());
+            }
+        }
+
+        auto tableOffset = fs.GetPosition();
+        fs.Write(table.GetData(), static_cast<size_t>(table.GetLength()));
+
+        fs.SetPosition(0);
+        fs.WriteValue<uint32_t>(MAGIC_NUMBER);
+        fs.WriteValue<uint16_t>(VERSION);
+        fs.WriteValue<uint16_t>(0);
+        fs.WriteValue<uint32_t>(numEntries);
+        fs.WriteValue<uint64_t>(tableOffset);
+        fs.WriteValue<uint64_t>(table.GetLength());
+    }
+
+    if (!File::Move(tempPath, path))
+    {
+        File::Delete(path);
+        if (!File::Move(tempPath, path))
+        {
+            File::Delete(tempPath);
+            throw IOException("Unable to replace " + path);
+        }
+    }
+    return numEntries;
+}
+
+std::unique_ptr<ObjectCache> ObjectCache::TryOpen(const std::string& path)
+{
+    if (!File::Exists(path))
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        auto cache = std::make_unique<ObjectCache>(std::make_shared<MemoryMappedFile>(path));
+        log_verbose("Opened object cache %s with %zu objects", path.c_str(), cache->GetNumEntries());
+        return cache;
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to use object cache %s: %s", path.c_str(), e.what());
+    }
+    return nullptr;
+}
+
+ObjectCache::ObjectCache(std::shared_ptr<MemoryMappedFile> file)
+    : _file(std::move(file))
+{
+    auto fileData = _file->GetData();
+    auto fileSize = static_cast<uint64_t>(_file->GetSize());
+    auto getRange = [fileData, fileSize](uint64_t offset, uint64_t size) {
+        if (offset > fileSize || size > fileSize - offset)
+        {
+            throw IOException("Object cache is corrupt.");
+        }
+        return fileData + offset;
+    };
+
+    auto header = MemoryStream(fileData, _file->GetSize());
+    auto magic = header.ReadValue<uint32_t>();
+    auto version = header.ReadValue<uint16_t>();
+    header.ReadValue<uint16_t>();
+    auto numEntries = header.ReadValue<uint32_t>();
+    auto tableOffset = header.ReadValue<uint64_t>();
+    auto tableSize = header.ReadValue<uint64_t>();
+    if (magic != MAGIC_NUMBER || version != VERSION)
+    {
+        throw IOException("Object cache is from a different version.");
+    }
+
+    auto table = MemoryStream(getRange(tableOffset, tableSize), static_cast<size_t>(tableSize));
+    DataSerialiser ds(false, table);
+    _entries.resize(numEntries);
+    for (auto& entry : _entries)
+    {
+        uint8_t rawKind{};
+        uint64_t dataOffset{};
+        uint64_t dataSize{};
+        uint32_t numAssets{};
+        ds << entry.Path << entry.Size << entry.LastModified << rawKind << entry.ObjectEntry << dataOffset << dataSize
+           << numAssets;
+        if (rawKind > static_cast<uint8_t>(ObjectCacheEntryKind::ParkObj))
+        {
+            throw IOException("Object cache is corrupt.");
+        }
+        entry.Kind = static_cast<ObjectCacheEntryKind>(rawKind);
+        entry.Data = getRange(dataOffset, dataSize);
+        entry.DataSize = static_cast<size_t>(dataSize);
+
+        for (uint32_t i = 0; i < numAssets; i++)
+        {
+            auto& asset = entry.Assets.emplace_back();
+            uint64_t assetOffset{};
+            uint64_t assetSize{};
+            ds << asset.Name << assetOffset << assetSize;
+            asset.Data = getRange(assetOffset, assetSize);
+            asset.DataSize = static_cast<size_t>(assetSize);
+        }
+    }
+
+    for (size_t i = 0; i < _entries.size(); i++)
+    {
+        _entriesByPath.emplace(_entries[i].Path, i);
+    }
+}
+
+const ObjectCacheEntry* ObjectCache::GetEntry(std::string_view path) const
+{
+    auto it = _entriesByPath.find(std::string(path));
+    if (it == _entriesByPath.end())
+    {
+        return nullptr;
+    }
+
+    const auto& entry = _entries[it->second];
+    if (File::GetSize(entry.Path) != entry.Size || File::GetLastModified(entry.Path) != entry.LastModified)
+    {
+        log_verbose("Object cache entry for %s is out of date", entry.Path.c_str());
+        return nullptr;
+    }
+    return &entry;
+}
+
+ObjectAsset ObjectCache::GetAsset(const ObjectCacheEntry::Asset& asset) const
+{
+    // Share ownership of the mapping so it outlives the cache if the object is still loaded
+    return ObjectAsset(std::shared_ptr<const uint8_t>(_file, asset.Data), asset.DataSize);
+}
@@ -0,0 +1,92 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Object.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class MemoryMappedFile;
+
+enum class ObjectCacheEntryKind : uint8_t
+{
+    // Data is the decoded chunk of a .dat file
+    Legacy,
+    // Data is object.json of a loose JSON object encoded as MessagePack
+    Json,
+    // Data is object.json of a .parkobj encoded as MessagePack, the other files in the zip are assets
+    ParkObj,
+};
+
+struct ObjectCacheEntry
+{
+    struct Asset
+    {
+        std::string Name;
+        const uint8_t* Data{};
+        size_t DataSize{};
+    };
+
+    std::string Path;
+    uint64_t Size{};
+    uint64_t LastModified{};
+    ObjectCacheEntryKind Kind{};
+    rct_object_entry ObjectEntry{};
+    const uint8_t* Data{};
+    size_t DataSize{};
+    std::vector<Asset> Assets;
+};
+
+/**
+ * A single read-only file holding the pre-read data of every object in the repository. The file is memory
+ * mapped, so servers running on the same host share its pages instead of each one reading and decompressing
+ * every object file. Entries are only used when the size and modification time of the object file on disk
+ * still match, anything else falls back to reading the object file.
+ */
+class ObjectCache
+{
+private:
+    std::shared_ptr<MemoryMappedFile> _file;
+    std::vector<ObjectCacheEntry> _entries;
+    std::unordered_map<std::string, size_t> _entriesByPath;
+
+public:
+    /**
+     * Opens the cache at path, returns nullptr if there is none or if it is not valid.
+     */
+    static std::unique_ptr<ObjectCache> TryOpen(const std::string& path);
+
+    /**
+     * Writes a cache of the given object files to path. Returns the number of objects that were written.
+     */
+    static size_t Build(const std::string& path, const std::vector<std::string>& objectPaths);
+
+    explicit ObjectCache(std::shared_ptr<MemoryMappedFile> file);
+
+    size_t GetNumEntries() const
+    {
+        return _entries.size();
+    }
+
+    /**
+     * Returns the entry for the object file at path if it is up to date, otherwise nullptr.
+     */
+    const ObjectCacheEntry* GetEntry(std::string_view path) const;
+
+    /**
+     * Returns an asset that points into the mapped file and keeps it mapped for as long as the asset is used.
+     */
+    ObjectAsset GetAsset(const ObjectCacheEntry::Asset& asset) const;
+};
@@ -9,17 +9,24 @@
 
 #include "ObjectFactory.h"
 
+#include "../Context.h"
 #include "../OpenRCT2.h"
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/Json.hpp"
+#include "../core/JsonReader.h"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../core/Zip.h"
+#include "../localisation/Language.h"
+#include "../localisation/LocalisationService.h"
+#include "../localisation/StringIds.h"
 #include "../rct12/SawyerChunkReader.h"
+#include "../ride/RideData.h"
+#include "../world/Footpath.h"
 #include "BannerObject.h"
 #include "EntranceObject.h"
 #include "FootpathItemObject.h"
@@ -29,8 +36,10 @@
 #include "LargeSceneryObject.h"
 #include "MusicObject.h"
 #include "Object.h"
+#include "ObjectCache.h"
 #include "ObjectLimits.h"
 #include "ObjectList.h"
+#include "ObjectRepository.h"
 #include "RideObject.h"
 #include "SceneryGroupObject.h"
 #include "SmallSceneryObject.h"
@@ -41,6 +50,7 @@
 #include "WaterObject.h"
 
 #include <algorithm>
+#include <optional>
 #include <unordered_map>
 
 struct IFileDataRetriever
@@ -78,26 +88,71 @@ class ZipDataRetriever : public IFileDataRetriever
 {
 private:
     const std::string _path;
-    const IZipArchive& _zipArchive;
+    const std::shared_ptr<const IZipArchive> _zipArchive;
 
 public:
-    ZipDataRetriever(std::string_view path, const IZipArchive& zipArchive)
+    ZipDataRetriever(std::string_view path, std::shared_ptr<const IZipArchive> zipArchive)
         : _path(path)
-        , _zipArchive(zipArchive)
+        , _zipArchive(std::move(zipArchive))
     {
     }
 
     std::vector<uint8_t> GetData(std::string_view path) const override
     {
-        return _zipArchive.GetFileData(path);
+        return _zipArchive->GetFileData(path);
     }
 
     ObjectAsset GetAsset(std::string_view path) const override
     {
+        // Assets can outlive the archive's mapping, e.g. images that are decoded on first draw, so they only refer to the
+        // archive. Streams opened while a batch of objects loads still read stored files from the shared mapping.
         return ObjectAsset(_path, path);
     }
 };
 
+class CacheDataRetriever : public IFileDataRetriever
+{
+private:
+    const ObjectCache& _cache;
+    const ObjectCacheEntry& _entry;
+
+public:
+    CacheDataRetriever(const ObjectCache& cache, const ObjectCacheEntry& entry)
+        : _cache(cache)
+        , _entry(entry)
+    {
+    }
+
+    std::vector<uint8_t> GetData(std::string_view path) const override
+    {
+        auto asset = FindAsset(path);
+        if (asset != nullptr)
+        {
+            return std::vector<uint8_t>(asset->Data, asset->Data + asset->DataSize);
+        }
+        return {};
+    }
+
+    ObjectAsset GetAsset(std::string_view path) const override
+    {
+        auto asset = FindAsset(path);
+        if (asset != nullptr)
+        {
+            return _cache.GetAsset(*asset);
+        }
+        return ObjectAsset(_entry.Path, path);
+    }
+
+private:
+    const ObjectCacheEntry::Asset* FindAsset(std::string_view path) const
+    {
+        auto it = std::find_if(_entry.Assets.begin(), _entry.Assets.end(), [path](const ObjectCacheEntry::Asset& asset) {
+            return asset.Name == path;
+        });
+        return it != _entry.Assets.end() ? &*it : nullptr;
+    }
+};
+
 class ReadObjectContext : public IReadObjectContext
 {
 private:
@@ -206,7 +261,7 @@ namespace ObjectFactory
      * @note jRoot is deliberately left non-const: json_t behaviour changes when const
      */
     static std::unique_ptr<Object> CreateObjectFromJson(
-        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever);
+        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever, bool loadImages);
 
     static ObjectSourceGame ParseSourceGame(const std::string& s)
     {
@@ -241,7 +296,37 @@ namespace ObjectFactory
         }
     }
 
-    std::unique_ptr<Object> CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path)
+    /**
+     * Creates an object from the decoded chunk of a .dat file, returns nullptr for scenario texts.
+     */
+    static std::unique_ptr<Object> CreateObjectFromLegacyChunk(
+        IObjectRepository& objectRepository, const rct_object_entry& entry, const void* data, size_t dataSize, bool loadImages)
+    {
+        if (entry.GetType() == ObjectType::ScenarioText)
+        {
+            return nullptr;
+        }
+
+        auto result = CreateObject(entry.GetType());
+        result->SetDescriptor(ObjectEntryDescriptor(entry));
+
+        utf8 objectName[DAT_NAME_LENGTH + 1] = { 0 };
+        object_entry_get_name_fixed(objectName, sizeof(objectName), &entry);
+        log_verbose("  entry: { 0x%08X, \"%s\", 0x%08X }", entry.flags, objectName, entry.checksum);
+        log_verbose("  size: %zu", dataSize);
+
+        auto chunkStream = OpenRCT2::MemoryStream(data, dataSize);
+        auto readContext = ReadObjectContext(objectRepository, objectName, loadImages && !gOpenRCT2NoGraphics, nullptr);
+        ReadObjectLegacy(*result, &readContext, &chunkStream);
+        if (readContext.WasError())
+        {
+            throw std::runtime_error("Object has errors");
+        }
+        result->SetSourceGames({ entry.GetSourceGame() });
+        return result;
+    }
+
+    std::unique_ptr<Object> CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path, bool loadImages)
     {
         log_verbose("CreateObjectFromLegacyFile(..., \"%s\")", path);
 
@@ -252,27 +337,10 @@ namespace ObjectFactory
             auto chunkReader = SawyerChunkReader(&fs);
 
             rct_object_entry entry = fs.ReadValue<rct_object_entry>();
-
             if (entry.GetType() != ObjectType::ScenarioText)
             {
-                result = CreateObject(entry.GetType());
-                result->SetDescriptor(ObjectEntryDescriptor(entry));
-
-                utf8 objectName[DAT_NAME_LENGTH + 1] = { 0 };
-                object_entry_get_name_fixed(objectName, sizeof(objectName), &entry);
-                log_verbose("  entry: { 0x%08X, \"%s\", 0x%08X }", entry.flags, objectName, entry.checksum);
-
                 auto chunk = chunkReader.ReadChunk();
-                log_verbose("  size: %zu", chunk->GetLength());
-
-                auto chunkStream = OpenRCT2::MemoryStream(chunk->GetData(), chunk->GetLength());
-                auto readContext = ReadObjectContext(objectRepository, objectName, !gOpenRCT2NoGraphics, nullptr);
-                ReadObjectLegacy(*result, &readContext, &chunkStream);
-                if (readContext.WasError())
-                {
-                    throw std::runtime_error("Object has errors");
-                }
-                result->SetSourceGames({ entry.GetSourceGame() });
+                result = CreateObjectFromLegacyChunk(objectRepository, entry, chunk->GetData(), chunk->GetLength(), loadImages);
             }
         }
         catch (const std::exception& e)
@@ -410,11 +478,15 @@ namespace ObjectFactory
         return ObjectType::None;
     }
 
-    std::unique_ptr<Object> CreateObjectFromZipFile(IObjectRepository& objectRepository, std::string_view path)
+    std::unique_ptr<Object> CreateObjectFromZipFile(IObjectRepository& objectRepository, std::string_view path, bool loadImages)
     {
         try
         {
-            auto archive = Zip::Open(path, ZIP_ACCESS::READ);
+            auto archive = Zip::OpenShared(path);
+            if (archive == nullptr)
+            {
+                throw std::runtime_error("Unable to open zip file.");
+            }
             auto jsonBytes = archive->GetFileData("object.json");
             if (jsonBytes.empty())
             {
@@ -425,8 +497,8 @@ namespace ObjectFactory
 
             if (jRoot.is_object())
             {
-                auto fileDataRetriever = ZipDataRetriever(path, *archive);
-                return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
+                auto fileDataRetriever = ZipDataRetriever(path, std::move(archive));
+                return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, loadImages);
             }
         }
         catch (const std::exception& e)
@@ -436,7 +508,8 @@ namespace ObjectFactory
         return nullptr;
     }
 
-    std::unique_ptr<Object> CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path)
+    std::unique_ptr<Object> CreateObjectFromJsonFile(
+        IObjectRepository& objectRepository, const std::string& path, bool loadImages)
     {
         log_verbose("CreateObjectFromJsonFile(\"%s\")", path.c_str());
 
@@ -444,7 +517,7 @@ namespace ObjectFactory
         {
             json_t jRoot = Json::ReadFromFile(path.c_str());
             auto fileDataRetriever = FileSystemDataRetriever(Path::GetDirectory(path));
-            return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
+            return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, loadImages);
         }
         catch (const std::runtime_error& err)
         {
@@ -454,6 +527,54 @@ namespace ObjectFactory
         return nullptr;
     }
 
+    std::unique_ptr<Object> CreateObjectFromCache(
+        IObjectRepository& objectRepository, const ObjectCache& cache, const ObjectCacheEntry& entry, bool loadImages)
+    {
+        log_verbose("CreateObjectFromCache(\"%s\")", entry.Path.c_str());
+
+        try
+        {
+            if (entry.Kind == ObjectCacheEntryKind::Legacy)
+            {
+                return CreateObjectFromLegacyChunk(objectRepository, entry.ObjectEntry, entry.Data, entry.DataSize, loadImages);
+            }
+
+            json_t jRoot = json_t::from_msgpack(entry.Data, entry.Data + entry.DataSize);
+            if (jRoot.is_object())
+            {
+                if (entry.Kind == ObjectCacheEntryKind::Json)
+                {
+                    auto fileDataRetriever = FileSystemDataRetriever(Path::GetDirectory(entry.Path));
+                    return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, loadImages);
+                }
+                auto fileDataRetriever = CacheDataRetriever(cache, entry);
+                return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, loadImages);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read '%s' from the object cache: %s", entry.Path.c_str(), e.what());
+        }
+        return nullptr;
+    }
+
+    static ObjectEntryDescriptor ParseDescriptor(ObjectType objectType, const std::string& id, const std::string& originalId)
+    {
+        if (originalId.length() == 8 + 1 + 8 + 1 + 8)
+        {
+            auto originalName = originalId.substr(9, 8);
+
+            rct_object_entry entry = {};
+            entry.flags = std::stoul(originalId.substr(0, 8), nullptr, 16);
+            entry.checksum = std::stoul(originalId.substr(18, 8), nullptr, 16);
+            entry.SetType(objectType);
+            auto minLength = std::min<size_t>(8, originalName.length());
+            std::memcpy(entry.name, originalName.c_str(), minLength);
+            return ObjectEntryDescriptor(entry);
+        }
+        return ObjectEntryDescriptor(objectType, id);
+    }
+
     static void ExtractSourceGames(const std::string& id, json_t& jRoot, Object& result)
     {
         auto sourceGames = jRoot["sourceGame"];
@@ -487,7 +608,7 @@ namespace ObjectFactory
     }
 
     std::unique_ptr<Object> CreateObjectFromJson(
-        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever)
+        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever, bool loadImages)
     {
         Guard::Assert(jRoot.is_object(), "ObjectFactory::CreateObjectFromJson expects parameter jRoot to be object");
 
@@ -499,31 +620,13 @@ namespace ObjectFactory
         if (objectType != ObjectType::None)
         {
             auto id = Json::GetString(jRoot["id"]);
-
-            ObjectEntryDescriptor descriptor;
-            auto originalId = Json::GetString(jRoot["originalId"]);
-            if (originalId.length() == 8 + 1 + 8 + 1 + 8)
-            {
-                auto originalName = originalId.substr(9, 8);
-
-                rct_object_entry entry = {};
-                entry.flags = std::stoul(originalId.substr(0, 8), nullptr, 16);
-                entry.checksum = std::stoul(originalId.substr(18, 8), nullptr, 16);
-                entry.SetType(objectType);
-                auto minLength = std::min<size_t>(8, originalName.length());
-                std::memcpy(entry.name, originalName.c_str(), minLength);
-                descriptor = ObjectEntryDescriptor(entry);
-            }
-            else
-            {
-                descriptor = ObjectEntryDescriptor(objectType, id);
-            }
+            auto descriptor = ParseDescriptor(objectType, id, Json::GetString(jRoot["originalId"]));
 
             result = CreateObject(objectType);
             result->SetIdentifier(id);
             result->SetDescriptor(descriptor);
             result->MarkAsJsonObject();
-            auto readContext = ReadObjectContext(objectRepository, id, !gOpenRCT2NoGraphics, fileRetriever);
+            auto readContext = ReadObjectContext(objectRepository, id, loadImages && !gOpenRCT2NoGraphics, fileRetriever);
             result->ReadJson(&readContext, jRoot);
             if (readContext.WasError())
             {
@@ -545,4 +648,276 @@ namespace ObjectFactory
         }
         return result;
     }
+
+    static std::vector<ObjectSourceGame> ReadSourceGames(Json::Reader& reader)
+    {
+        std::vector<ObjectSourceGame> result;
+        auto type = reader.Peek();
+        if (type == Json::ValueType::String)
+        {
+            result.push_back(ParseSourceGame(*reader.ReadString()));
+        }
+        else if (type == Json::ValueType::Array)
+        {
+            reader.BeginArray();
+            while (reader.NextElement())
+            {
+                result.push_back(ParseSourceGame(reader.ReadString().value_or("")));
+            }
+        }
+        else
+        {
+            reader.Skip();
+        }
+
+        // Same as ExtractSourceGames, anything without a valid list is custom
+        if (result.empty())
+        {
+            result.push_back(ObjectSourceGame::Custom);
+        }
+        return result;
+    }
+
+    /**
+     * Reads the properties the repository item needs for the object types that add their own
+     * information to it, returns false if they cannot be read without loading the object.
+     */
+    static bool ReadRepositoryItemProperties(Json::Reader& reader, ObjectRepositoryItem& item)
+    {
+        if (!reader.BeginObject())
+        {
+            return false;
+        }
+
+        bool hasRideTypes = false;
+        for (auto& rideType : item.RideInfo.RideType)
+        {
+            rideType = RIDE_TYPE_NULL;
+        }
+
+        std::string key;
+        while (reader.NextMember(key))
+        {
+            if (item.Type == ObjectType::Ride && key == "type")
+            {
+                std::vector<std::string> rideTypes;
+                if (reader.Peek() == Json::ValueType::String)
+                {
+                    rideTypes.push_back(*reader.ReadString());
+                }
+                else if (reader.BeginArray())
+                {
+                    while (reader.NextElement())
+                    {
+                        rideTypes.push_back(reader.ReadString().value_or(""));
+                    }
+                }
+                for (size_t i = 0; i < std::min<size_t>(rideTypes.size(), MAX_RIDE_TYPES_PER_RIDE_ENTRY); i++)
+                {
+                    auto rideType = RideObject::ParseRideType(rideTypes[i]);
+                    if (rideType == RIDE_TYPE_NULL)
+                    {
+                        // Let the object report the error
+                        return false;
+                    }
+                    item.RideInfo.RideType[i] = rideType;
+                    hasRideTypes = true;
+                }
+            }
+            else if (item.Type == ObjectType::SceneryGroup && key == "entries")
+            {
+                if (reader.BeginArray())
+                {
+                    while (reader.NextElement())
+                    {
+                        item.SceneryGroupInfo.Entries.emplace_back(reader.ReadString().value_or(""));
+                    }
+                }
+            }
+            else if (item.Type == ObjectType::FootpathSurface && key == "editorOnly")
+            {
+                if (reader.ReadBoolean().value_or(false))
+                    item.FootpathSurfaceInfo.Flags |= FOOTPATH_ENTRY_FLAG_SHOW_ONLY_IN_SCENARIO_EDITOR;
+            }
+            else if (item.Type == ObjectType::FootpathSurface && key == "isQueue")
+            {
+                if (reader.ReadBoolean().value_or(false))
+                    item.FootpathSurfaceInfo.Flags |= FOOTPATH_ENTRY_FLAG_IS_QUEUE;
+            }
+            else if (item.Type == ObjectType::FootpathSurface && key == "noSlopeRailings")
+            {
+                if (reader.ReadBoolean().value_or(false))
+                    item.FootpathSurfaceInfo.Flags |= FOOTPATH_ENTRY_FLAG_NO_SLOPE_RAILINGS;
+            }
+            else
+            {
+                reader.Skip();
+            }
+        }
+
+        if (item.Type == ObjectType::Ride)
+        {
+            if (!hasRideTypes)
+            {
+                return false;
+            }
+
+            // Same as RideObject::SetRepositoryItem
+            auto category = GetRideTypeDescriptor(item.RideInfo.RideType[0]).Category;
+            for (auto& rideCategory : item.RideInfo.RideCategory)
+            {
+                rideCategory = category;
+            }
+            item.RideInfo.RideFlags = 0;
+        }
+        return true;
+    }
+
+    bool ReadRepositoryItemFromJson(std::string_view json, ObjectRepositoryItem& item)
+    {
+        try
+        {
+            Json::Reader reader(json);
+            if (!reader.BeginObject())
+            {
+                return false;
+            }
+
+            std::string objectType;
+            std::string id;
+            std::string originalId;
+            std::optional<size_t> propertiesPosition;
+            std::string name;
+            uint8_t nameLanguage = LANGUAGE_UNDEFINED;
+            auto targetLanguage = LocalisationService_GetCurrentLanguage();
+            auto getNamePriority = [targetLanguage](uint8_t language) {
+                return language == targetLanguage ? 0 : (language == LANGUAGE_ENGLISH_UK ? 1 : 2);
+            };
+
+            std::string key;
+            std::string locale;
+            while (reader.NextMember(key))
+            {
+                if (key == "objectType")
+                {
+                    objectType = reader.ReadString().value_or("");
+                }
+                else if (key == "id")
+                {
+                    id = reader.ReadString().value_or("");
+                }
+                else if (key == "originalId")
+                {
+                    originalId = reader.ReadString().value_or("");
+                }
+                else if (key == "authors")
+                {
+                    item.Authors.clear();
+                    if (reader.Peek() == Json::ValueType::String)
+                    {
+                        item.Authors.push_back(*reader.ReadString());
+                    }
+                    else if (reader.BeginArray())
+                    {
+                        while (reader.NextElement())
+                        {
+                            if (auto author = reader.ReadString())
+                            {
+                                item.Authors.push_back(std::move(*author));
+                            }
+                        }
+                    }
+                }
+                else if (key == "sourceGame")
+                {
+                    item.Sources = ReadSourceGames(reader);
+                }
+                else if (key == "strings")
+                {
+                    if (!reader.BeginObject())
+                    {
+                        continue;
+                    }
+                    while (reader.NextMember(key))
+                    {
+                        if (key != "name")
+                        {
+                            reader.Skip();
+                            continue;
+                        }
+                        if (!reader.BeginObject())
+                        {
+                            continue;
+                        }
+
+                        // Pick the string StringTable would sort first: the current language, then
+                        // English (UK), then the lowest language id.
+                        while (reader.NextMember(locale))
+                        {
+                            auto text = reader.ReadString().value_or("");
+                            auto language = static_cast<uint8_t>(language_get_id_from_locale(locale.c_str()));
+                            if (language == LANGUAGE_UNDEFINED)
+                            {
+                                continue;
+                            }
+                            if (nameLanguage == LANGUAGE_UNDEFINED || language == nameLanguage
+                                || std::make_pair(getNamePriority(language), language)
+                                    < std::make_pair(getNamePriority(nameLanguage), nameLanguage))
+                            {
+                                name = std::move(text);
+                                nameLanguage = language;
+                            }
+                        }
+                    }
+                }
+                else if (key == "properties")
+                {
+                    propertiesPosition = reader.GetPosition();
+                    reader.Skip();
+                }
+                else
+                {
+                    reader.Skip();
+                }
+            }
+
+            auto type = ParseObjectType(objectType);
+            if (type == ObjectType::None)
+            {
+                return false;
+            }
+
+            auto descriptor = ParseDescriptor(type, id, originalId);
+            item.Type = descriptor.GetType();
+            item.Generation = ObjectGeneration::JSON;
+            item.Identifier = id;
+            item.ObjectEntry = descriptor.Entry;
+            if (item.Sources.empty())
+            {
+                item.Sources.push_back(ObjectSourceGame::Custom);
+            }
+
+            // Same as Object::GetName, language packs can override the names of original objects
+            const auto& localisationService = OpenRCT2::GetContext()->GetLocalisationService();
+            auto overrideStringId = localisationService.GetObjectOverrideStringId(
+                descriptor.GetName(), static_cast<uint8_t>(ObjectStringID::NAME));
+            item.Name = overrideStringId != STR_NONE ? String::ToStd(language_get_string(overrideStringId)) : name;
+
+            if (type == ObjectType::Ride || type == ObjectType::SceneryGroup || type == ObjectType::FootpathSurface)
+            {
+                if (!propertiesPosition.has_value())
+                {
+                    return false;
+                }
+                Json::Reader propertiesReader(json.substr(*propertiesPosition));
+                return ReadRepositoryItemProperties(propertiesReader, item);
+            }
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Unable to index object from its JSON: %s", e.what());
+        }
+        return false;
+    }
 } // namespace ObjectFactory
@@ -16,17 +16,30 @@
 
 struct IObjectRepository;
 class Object;
+class ObjectCache;
+struct ObjectCacheEntry;
+struct ObjectRepositoryItem;
 struct rct_object_entry;
 enum class ObjectType : uint8_t;
 
 namespace ObjectFactory
 {
-    [[nodiscard]] std::unique_ptr<Object> CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path);
+    [[nodiscard]] std::unique_ptr<Object> CreateObjectFromLegacyFile(
+        IObjectRepository& objectRepository, const utf8* path, bool loadImages = true);
     [[nodiscard]] std::unique_ptr<Object> CreateObjectFromLegacyData(
         IObjectRepository& objectRepository, const rct_object_entry* entry, const void* data, size_t dataSize);
-    [[nodiscard]] std::unique_ptr<Object> CreateObjectFromZipFile(IObjectRepository& objectRepository, std::string_view path);
+    [[nodiscard]] std::unique_ptr<Object> CreateObjectFromZipFile(
+        IObjectRepository& objectRepository, std::string_view path, bool loadImages = true);
     [[nodiscard]] std::unique_ptr<Object> CreateObject(ObjectType type);
 
     [[nodiscard]] std::unique_ptr<Object> CreateObjectFromJsonFile(
-        IObjectRepository& objectRepository, const std::string& path);
+        IObjectRepository& objectRepository, const std::string& path, bool loadImages = true);
+    [[nodiscard]] std::unique_ptr<Object> CreateObjectFromCache(
+        IObjectRepository& objectRepository, const ObjectCache& cache, const ObjectCacheEntry& entry, bool loadImages = true);
+
+    /**
+     * Reads only what the object repository needs to index a JSON object from its object.json, without
+     * loading the object. Returns false if the object has to be loaded to be indexed.
+     */
+    [[nodiscard]] bool ReadRepositoryItemFromJson(std::string_view json, ObjectRepositoryItem& item);
 } // namespace ObjectFactory
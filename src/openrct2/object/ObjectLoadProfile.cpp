@@ -0,0 +1,85 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ObjectLoadProfile.h"
+
+#include "../core/String.hpp"
+
+#include <algorithm>
+
+void ObjectLoadProfile::Sort(ObjectLoadProfileSort sort)
+{
+    auto key = [sort](const ObjectLoadProfileEntry& entry) -> double {
+        switch (sort)
+        {
+            case ObjectLoadProfileSort::Read:
+                return entry.ReadTime;
+            case ObjectLoadProfileSort::Load:
+                return entry.LoadTime;
+            case ObjectLoadProfileSort::Images:
+                return entry.NumImages;
+            case ObjectLoadProfileSort::Size:
+                return static_cast<double>(entry.FileSize);
+            default:
+                return entry.GetTotalTime();
+        }
+    };
+    std::stable_sort(Entries.begin(), Entries.end(), [&key](const ObjectLoadProfileEntry& a, const ObjectLoadProfileEntry& b) {
+        return key(a) > key(b);
+    });
+}
+
+std::vector<std::string> ObjectLoadProfile::FormatReport(size_t maxEntries) const
+{
+    double readTime = 0;
+    double loadTime = 0;
+    size_t numImages = 0;
+    size_t imageBytes = 0;
+    for (const auto& entry : Entries)
+    {
+        readTime += entry.ReadTime;
+        loadTime += entry.LoadTime;
+        numImages += entry.NumImages;
+        imageBytes += static_cast<size_t>(entry.ImageBytes);
+    }
+
+    std::vector<std::string> lines;
+    lines.push_back(String::StdFormat(
+        "%zu / %zu objects loaded in %.1f ms (read %.1f ms over all threads, load %.1f ms), %zu images, %zu KiB",
+        Entries.size(), NumRequired, TotalTime, readTime, loadTime, numImages, imageBytes / 1024));
+    lines.push_back(String::StdFormat(
+        "%9s %9s %9s %7s %9s %9s  %s", "total ms", "read ms", "load ms", "images", "image KiB", "file KiB", "object"));
+    for (size_t i = 0; i < std::min(maxEntries, Entries.size()); i++)
+    {
+        const auto& entry = Entries[i];
+        lines.push_back(String::StdFormat(
+            "%9.2f %9.2f %9.2f %7u %9zu %9zu  %s", entry.GetTotalTime(), entry.ReadTime, entry.LoadTime, entry.NumImages,
+            static_cast<size_t>(entry.ImageBytes / 1024), static_cast<size_t>(entry.FileSize / 1024),
+            entry.Identifier.c_str()));
+    }
+    return lines;
+}
+
+bool ObjectLoadProfileSortFromString(std::string_view s, ObjectLoadProfileSort& sort)
+{
+    static constexpr std::pair<std::string_view, ObjectLoadProfileSort> Names[] = {
+        { "time", ObjectLoadProfileSort::Time },     { "read", ObjectLoadProfileSort::Read },
+        { "load", ObjectLoadProfileSort::Load },     { "images", ObjectLoadProfileSort::Images },
+        { "size", ObjectLoadProfileSort::Size },
+    };
+    for (const auto& [name, value] : Names)
+    {
+        if (String::Equals(s, name, true))
+        {
+            sort = value;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,68 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * How long a single object took to load and how much it brought with it.
+ */
+struct ObjectLoadProfileEntry
+{
+    std::string Identifier;
+    std::string Path;
+    // Reading the object from its file, including its strings and image table (ms)
+    double ReadTime{};
+    // Loading the read object into the game, including allocating its images (ms)
+    double LoadTime{};
+    uint32_t NumImages{};
+    // Size of the object's images when decoded to 8bpp, images from PNG files are only decoded once drawn
+    uint64_t ImageBytes{};
+    uint64_t FileSize{};
+
+    double GetTotalTime() const
+    {
+        return ReadTime + LoadTime;
+    }
+};
+
+enum class ObjectLoadProfileSort : uint8_t
+{
+    Time,
+    Read,
+    Load,
+    Images,
+    Size,
+};
+
+/**
+ * Per object timings of the last ObjectManager::LoadObjects call, for finding the objects that make a park slow to open.
+ * Objects that were already loaded are not included.
+ */
+struct ObjectLoadProfile
+{
+    std::vector<ObjectLoadProfileEntry> Entries;
+    size_t NumRequired{};
+    // Wall clock time of the whole load, reading runs on several threads so this is less than the sum of the entries (ms)
+    double TotalTime{};
+
+    void Sort(ObjectLoadProfileSort sort);
+
+    /**
+     * Formats the profile as a table of the first maxEntries objects, in their current order.
+     */
+    std::vector<std::string> FormatReport(size_t maxEntries) const;
+};
+
+bool ObjectLoadProfileSortFromString(std::string_view s, ObjectLoadProfileSort& sort);
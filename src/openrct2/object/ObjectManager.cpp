@@ -12,13 +12,17 @@
 #include "../Context.h"
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
+#include "../core/File.h"
 #include "../core/Memory.hpp"
+#include "../core/Zip.h"
 #include "../localisation/StringIds.h"
+#include "../platform/Platform2.h"
 #include "../util/Util.h"
 #include "FootpathItemObject.h"
 #include "LargeSceneryObject.h"
 #include "Object.h"
 #include "ObjectList.h"
+#include "ObjectLoadProfile.h"
 #include "ObjectRepository.h"
 #include "RideObject.h"
 #include "SceneryGroupObject.h"
@@ -27,9 +31,12 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 class ObjectManager final : public IObjectManager
@@ -43,6 +50,8 @@ private:
     // Used to return a safe empty vector back from GetAllRideEntries, can be removed when std::span is available
     std::vector<ObjectEntryIndex> _nullRideTypeEntries;
 
+    ObjectLoadProfile _lastLoadProfile;
+
 public:
     explicit ObjectManager(IObjectRepository& objectRepository)
         : _objectRepository(objectRepository)
@@ -147,11 +156,14 @@ public:
 
     void LoadObjects(const ObjectList& objectList) override
     {
+        // Objects often share archives, e.g. for their assets, keep them open until all objects are loaded
+        Zip::SharedArchiveScope sharedArchives;
+
         // Find all the required objects
         auto requiredObjects = GetRequiredObjects(objectList);
 
-        // Load the required objects
-        LoadObjects(requiredObjects);
+        // Load the required objects, only park loads are profiled
+        LoadObjects(requiredObjects, _lastLoadProfile);
 
         // Load defaults.
         LoadDefaultObjects();
@@ -220,7 +232,7 @@ public:
         for (size_t i = 0; i < numObjects; i++)
         {
             // TODO: remove ObjectGeneration::DAT check when the NSF is here
-            const ObjectRepositoryItem* item = &_objectRepository.GetObjects()[i];
+            const ObjectRepositoryItem* item = _objectRepository.GetObjects()[i];
             if (item->LoadedObject != nullptr && IsObjectCustom(item) && item->LoadedObject->GetLegacyData() != nullptr
                 && item->LoadedObject->GetGeneration() == ObjectGeneration::DAT)
             {
@@ -356,6 +368,11 @@ public:
         return _rideTypeToObjectMap[rideType];
     }
 
+    const ObjectLoadProfile& GetLastLoadProfile() const override
+    {
+        return _lastLoadProfile;
+    }
+
 private:
     Object* LoadObject(int32_t slot, std::string_view identifier)
     {
@@ -604,17 +621,44 @@ private:
         }
     }
 
-    void LoadObjects(std::vector<const ObjectRepositoryItem*>& requiredObjects)
+    static double GetElapsedMilliseconds(std::chrono::high_resolution_clock::time_point startTime)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+    }
+
+    static ObjectLoadProfileEntry CreateProfileEntry(const ObjectRepositoryItem& ori, const Object& object, double readTime)
+    {
+        ObjectLoadProfileEntry entry;
+        entry.Identifier = ori.Identifier.empty() ? std::string(ori.ObjectEntry.GetName()) : ori.Identifier;
+        entry.Path = ori.Path;
+        entry.ReadTime = readTime;
+        entry.FileSize = File::GetSize(ori.Path);
+
+        const auto& imageTable = object.GetImageTable();
+        entry.NumImages = imageTable.GetCount();
+        for (uint32_t i = 0; i < entry.NumImages; i++)
+        {
+            const auto& g1 = imageTable.GetImages()[i];
+            entry.ImageBytes += static_cast<uint64_t>(g1.width) * g1.height;
+        }
+        return entry;
+    }
+
+    void LoadObjects(std::vector<const ObjectRepositoryItem*>& requiredObjects, ObjectLoadProfile& profile)
     {
+        auto startTicks = Platform::GetTicks();
+        auto startTime = std::chrono::high_resolution_clock::now();
         std::vector<Object*> objects;
         std::vector<Object*> newLoadedObjects;
         std::vector<ObjectEntryDescriptor> badObjects;
+        std::vector<std::optional<ObjectLoadProfileEntry>> profileEntries;
         objects.resize(OBJECT_ENTRY_COUNT);
         newLoadedObjects.reserve(OBJECT_ENTRY_COUNT);
+        profileEntries.resize(requiredObjects.size());
 
         // Read objects
         std::mutex commonMutex;
-        ParallelFor(requiredObjects, [this, &commonMutex, requiredObjects, &objects, &badObjects, &newLoadedObjects](size_t i) {
+        ParallelFor(requiredObjects, [&](size_t i) {
             auto* requiredObject = requiredObjects[i];
             Object* object = nullptr;
             if (requiredObject != nullptr)
@@ -624,7 +668,14 @@ private:
                 {
                     // Object requires to be loaded, if the object successfully loads it will register it
                     // as a loaded object otherwise placed into the badObjects list.
+                    auto readStartTime = std::chrono::high_resolution_clock::now();
                     auto newObject = _objectRepository.LoadObject(requiredObject);
+                    if (newObject != nullptr)
+                    {
+                        profileEntries[i] = CreateProfileEntry(
+                            *requiredObject, *newObject, GetElapsedMilliseconds(readStartTime));
+                    }
+
                     std::lock_guard<std::mutex> guard(commonMutex);
                     if (newObject == nullptr)
                     {
@@ -648,10 +699,26 @@ private:
         });
 
         // Load objects
+        std::unordered_map<const Object*, double> loadTimes;
         for (auto* obj : newLoadedObjects)
         {
+            auto loadStartTime = std::chrono::high_resolution_clock::now();
             obj->Load();
+            loadTimes[obj] = GetElapsedMilliseconds(loadStartTime);
+        }
+
+        profile = {};
+        profile.NumRequired = requiredObjects.size();
+        profile.TotalTime = GetElapsedMilliseconds(startTime);
+        for (size_t i = 0; i < profileEntries.size(); i++)
+        {
+            if (profileEntries[i].has_value())
+            {
+                profileEntries[i]->LoadTime = loadTimes[objects[i]];
+                profile.Entries.push_back(std::move(*profileEntries[i]));
+            }
         }
+        profile.Sort(ObjectLoadProfileSort::Time);
 
         if (!badObjects.empty())
         {
@@ -675,7 +742,9 @@ private:
 
         _loadedObjects = std::move(objects);
 
-        log_verbose("%u / %u new objects loaded", newLoadedObjects.size(), requiredObjects.size());
+        log_verbose(
+            "%zu / %zu new objects loaded in %u ms, %zu images in use", newLoadedObjects.size(), requiredObjects.size(),
+            Platform::GetTicks() - startTicks, ImageListGetUsedCount());
     }
 
     Object* GetOrLoadObject(const ObjectRepositoryItem* ori)
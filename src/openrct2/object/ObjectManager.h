@@ -17,6 +17,7 @@
 struct IObjectRepository;
 class Object;
 class ObjectList;
+struct ObjectLoadProfile;
 struct ObjectRepositoryItem;
 
 struct IObjectManager
@@ -44,6 +45,11 @@ struct IObjectManager
 
     virtual std::vector<const ObjectRepositoryItem*> GetPackableObjects() abstract;
     virtual const std::vector<ObjectEntryIndex>& GetAllRideEntries(uint8_t rideType) abstract;
+
+    /**
+     * Gets the time taken by each object newly loaded by the last park load, i.e. LoadObjects with an object list.
+     */
+    virtual const ObjectLoadProfile& GetLastLoadProfile() const abstract;
 };
 
 [[nodiscard]] std::unique_ptr<IObjectManager> CreateObjectManager(IObjectRepository& objectRepository);
@@ -15,8 +15,10 @@
 #include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/DataSerialiser.h"
+#include "../core/File.h"
 #include "../core/FileIndex.hpp"
 #include "../core/FileStream.h"
+#include "../core/FileWatcher.h"
 #include "../core/Guard.hpp"
 #include "../core/IStream.hpp"
 #include "../core/Memory.hpp"
@@ -24,6 +26,7 @@
 #include "../core/Numerics.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../core/Zip.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/LocalisationService.h"
 #include "../object/Object.h"
@@ -34,6 +37,7 @@
 #include "../util/SawyerCoding.h"
 #include "../util/Util.h"
 #include "Object.h"
+#include "ObjectCache.h"
 #include "ObjectFactory.h"
 #include "ObjectList.h"
 #include "ObjectManager.h"
@@ -41,6 +45,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -81,9 +86,11 @@ private:
     static constexpr auto PATTERN = "*.dat;*.pob;*.json;*.parkobj";
 
     IObjectRepository& _objectRepository;
+    const std::unique_ptr<ObjectCache>& _cache;
 
 public:
-    explicit ObjectFileIndex(IObjectRepository& objectRepository, const IPlatformEnvironment& env)
+    explicit ObjectFileIndex(
+        IObjectRepository& objectRepository, const IPlatformEnvironment& env, const std::unique_ptr<ObjectCache>& cache)
         : FileIndex(
             "object index", MAGIC_NUMBER, VERSION, env.GetFilePath(PATHID::CACHE_OBJECTS), std::string(PATTERN),
             std::vector<std::string>{
@@ -91,25 +98,41 @@ public:
                 env.GetDirectoryPath(DIRBASE::USER, DIRID::OBJECT),
             })
         , _objectRepository(objectRepository)
+        , _cache(cache)
     {
     }
 
 public:
     std::tuple<bool, ObjectRepositoryItem> Create([[maybe_unused]] int32_t language, const std::string& path) const override
     {
+        // Only the metadata ends up in the index, so the images are not read.
         std::unique_ptr<Object> object;
         auto extension = Path::GetExtension(path);
-        if (String::Equals(extension, ".json", true))
+        auto cacheEntry = _cache != nullptr ? _cache->GetEntry(path) : nullptr;
+        if (cacheEntry == nullptr)
+        {
+            // JSON objects are indexed from their object.json alone, they are only fully read when loaded
+            auto item = TryCreateFromJson(path, extension);
+            if (item.has_value())
+            {
+                return std::make_tuple(true, std::move(*item));
+            }
+        }
+        if (cacheEntry != nullptr)
         {
-            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path);
+            object = ObjectFactory::CreateObjectFromCache(_objectRepository, *_cache, *cacheEntry, false);
+        }
+        else if (String::Equals(extension, ".json", true))
+        {
+            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path, false);
         }
         else if (String::Equals(extension, ".parkobj", true))
         {
-            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path);
+            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path, false);
         }
         else
         {
-            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str());
+            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str(), false);
         }
         if (object != nullptr)
         {
@@ -163,6 +186,40 @@ protected:
     }
 
 private:
+    static std::optional<ObjectRepositoryItem> TryCreateFromJson(const std::string& path, const std::string& extension)
+    {
+        try
+        {
+            std::string json;
+            if (String::Equals(extension, ".json", true))
+            {
+                json = File::ReadAllText(path);
+            }
+            else if (String::Equals(extension, ".parkobj", true))
+            {
+                auto archive = Zip::Open(path, ZIP_ACCESS::READ);
+                auto jsonBytes = archive->GetFileData("object.json");
+                json.assign(jsonBytes.begin(), jsonBytes.end());
+            }
+            else
+            {
+                return std::nullopt;
+            }
+
+            ObjectRepositoryItem item = {};
+            if (ObjectFactory::ReadRepositoryItemFromJson(json, item))
+            {
+                item.Path = path;
+                return item;
+            }
+        }
+        catch (const std::exception&)
+        {
+            // The full read reports the error
+        }
+        return std::nullopt;
+    }
+
     bool IsTrackReadOnly(const std::string& path) const
     {
         return String::StartsWith(path, SearchPaths[0]) || String::StartsWith(path, SearchPaths[1]);
@@ -172,15 +229,20 @@ private:
 class ObjectRepository final : public IObjectRepository
 {
     std::shared_ptr<IPlatformEnvironment> const _env;
+    std::unique_ptr<ObjectCache> _cache;
     ObjectFileIndex const _fileIndex;
-    std::vector<ObjectRepositoryItem> _items;
+    // Items are allocated individually so that they keep their address when other items are added, removed or sorted,
+    // _items is the list of items sorted by name.
+    std::vector<std::unique_ptr<ObjectRepositoryItem>> _itemStorage;
+    std::vector<ObjectRepositoryItem*> _items;
     ObjectIdentifierMap _newItemMap;
     ObjectEntryMap _itemMap;
+    std::unique_ptr<FileChangeCollector> _fileChanges;
 
 public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
         : _env(env)
-        , _fileIndex(*this, *env)
+        , _fileIndex(*this, *env, _cache)
     {
     }
 
@@ -192,6 +254,7 @@ public:
     void LoadOrConstruct(int32_t language) override
     {
         ClearItems();
+        OpenCache();
         auto items = _fileIndex.LoadOrBuild(language);
         AddItems(items);
         SortItems();
@@ -199,17 +262,95 @@ public:
 
     void Construct(int32_t language) override
     {
+        OpenCache();
         auto items = _fileIndex.Rebuild(language);
         AddItems(items);
         SortItems();
     }
 
+    void WatchFiles() override
+    {
+        _fileChanges = std::make_unique<FileChangeCollector>(_fileIndex.SearchPaths);
+    }
+
+    void ProcessFileChanges() override
+    {
+        if (_fileChanges == nullptr || !_fileChanges->HasChanges())
+        {
+            return;
+        }
+
+        auto language = LocalisationService_GetCurrentLanguage();
+        auto changes = _fileIndex.Update(language, _fileChanges->TakeChanges());
+        if (changes.empty())
+        {
+            return;
+        }
+
+        // Drop the old items first, objects that are currently loaded are left alone
+        size_t numSkipped = 0;
+        auto removeStart = std::remove_if(_itemStorage.begin(), _itemStorage.end(), [&](const auto& item) {
+            auto changed = std::any_of(
+                changes.begin(), changes.end(), [&item](const auto& change) { return Path::Equals(change.Path, item->Path); });
+            if (changed && item->LoadedObject != nullptr)
+            {
+                log_warning("Object '%s' changed while it is in use, restart to pick up the change.", item->Path.c_str());
+                numSkipped++;
+                return false;
+            }
+            return changed;
+        });
+        _itemStorage.erase(removeStart, _itemStorage.end());
+        _items.clear();
+        for (const auto& item : _itemStorage)
+        {
+            _items.push_back(item.get());
+        }
+        UpdateItemIds();
+
+        for (const auto& change : changes)
+        {
+            if (change.HasItem && GetItemIndexByPath(change.Path) == SIZE_MAX)
+            {
+                AddItem(change.Item);
+            }
+        }
+        SortItems();
+        Console::WriteLine("Updated %zu objects.", changes.size() - numSkipped);
+    }
+
+    size_t BuildCache(const std::string& path) override
+    {
+        std::vector<std::string> objectPaths;
+        objectPaths.reserve(_items.size());
+        for (const auto* item : _items)
+        {
+            objectPaths.push_back(item->Path);
+        }
+
+        // A mapped file can not be moved over or deleted on Windows, so the old cache is unmapped until the new
+        // one is in place. Objects still holding assets from the old cache keep it mapped.
+        _cache = nullptr;
+        size_t numObjects{};
+        try
+        {
+            numObjects = ObjectCache::Build(path, objectPaths);
+        }
+        catch (const std::exception&)
+        {
+            OpenCache();
+            throw;
+        }
+        OpenCache();
+        return numObjects;
+    }
+
     size_t GetNumObjects() const override
     {
         return _items.size();
     }
 
-    const ObjectRepositoryItem* GetObjects() const override
+    const ObjectRepositoryItem* const* GetObjects() const override
     {
         return _items.data();
     }
@@ -222,7 +363,7 @@ public:
         auto kvp = _itemMap.find(entry);
         if (kvp != _itemMap.end())
         {
-            return &_items[kvp->second];
+            return _items[kvp->second];
         }
         return nullptr;
     }
@@ -232,7 +373,7 @@ public:
         auto kvp = _newItemMap.find(std::string(identifier));
         if (kvp != _newItemMap.end())
         {
-            return &_items[kvp->second];
+            return _items[kvp->second];
         }
         return nullptr;
     }
@@ -242,7 +383,7 @@ public:
         auto kvp = _itemMap.find(*objectEntry);
         if (kvp != _itemMap.end())
         {
-            return &_items[kvp->second];
+            return _items[kvp->second];
         }
         return nullptr;
     }
@@ -259,6 +400,12 @@ public:
     {
         Guard::ArgumentNotNull(ori, GUARD_LINE);
 
+        auto cacheEntry = _cache != nullptr ? _cache->GetEntry(ori->Path) : nullptr;
+        if (cacheEntry != nullptr)
+        {
+            return ObjectFactory::CreateObjectFromCache(*this, *_cache, *cacheEntry);
+        }
+
         auto extension = Path::GetExtension(ori->Path);
         if (String::Equals(extension, ".json", true))
         {
@@ -274,7 +421,7 @@ public:
 
     void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::unique_ptr<Object>&& object) override
     {
-        ObjectRepositoryItem* item = &_items[ori->Id];
+        ObjectRepositoryItem* item = _items[ori->Id];
 
         Guard::Assert(item->LoadedObject == nullptr, GUARD_LINE);
         item->LoadedObject = std::move(object);
@@ -282,7 +429,7 @@ public:
 
     void UnregisterLoadedObject(const ObjectRepositoryItem* ori, Object* object) override
     {
-        ObjectRepositoryItem* item = &_items[ori->Id];
+        ObjectRepositoryItem* item = _items[ori->Id];
         if (item->LoadedObject.get() == object)
         {
             item->LoadedObject = nullptr;
@@ -369,23 +516,36 @@ public:
     }
 
 private:
+    /**
+     * The object cache is optional, it only exists once it has been built with the build-object-cache command.
+     */
+    void OpenCache()
+    {
+        _cache = ObjectCache::TryOpen(_env->GetFilePath(PATHID::CACHE_OBJECT_DATA));
+    }
+
     void ClearItems()
     {
         _items.clear();
+        _itemStorage.clear();
         _newItemMap.clear();
         _itemMap.clear();
     }
 
     void SortItems()
     {
-        std::sort(_items.begin(), _items.end(), [](const ObjectRepositoryItem& a, const ObjectRepositoryItem& b) -> bool {
-            return String::Compare(a.Name, b.Name) < 0;
+        std::sort(_items.begin(), _items.end(), [](const ObjectRepositoryItem* a, const ObjectRepositoryItem* b) -> bool {
+            return String::Compare(a->Name, b->Name) < 0;
         });
+        UpdateItemIds();
+    }
 
+    void UpdateItemIds()
+    {
         // Fix the IDs
         for (size_t i = 0; i < _items.size(); i++)
         {
-            _items[i].Id = i;
+            _items[i]->Id = i;
         }
 
         // Rebuild item map
@@ -393,11 +553,11 @@ private:
         _newItemMap.clear();
         for (size_t i = 0; i < _items.size(); i++)
         {
-            rct_object_entry entry = _items[i].ObjectEntry;
+            rct_object_entry entry = _items[i]->ObjectEntry;
             _itemMap[entry] = i;
-            if (!_items[i].Identifier.empty())
+            if (!_items[i]->Identifier.empty())
             {
-                _newItemMap[_items[i].Identifier] = i;
+                _newItemMap[_items[i]->Identifier] = i;
             }
         }
     }
@@ -418,6 +578,18 @@ private:
         }
     }
 
+    size_t GetItemIndexByPath(const std::string& path) const
+    {
+        for (size_t i = 0; i < _items.size(); i++)
+        {
+            if (Path::Equals(_items[i]->Path, path))
+            {
+                return i;
+            }
+        }
+        return SIZE_MAX;
+    }
+
     bool AddItem(const ObjectRepositoryItem& item)
     {
         const ObjectRepositoryItem* conflict{};
@@ -432,9 +604,9 @@ private:
         if (conflict == nullptr)
         {
             size_t index = _items.size();
-            auto copy = item;
-            copy.Id = index;
-            _items.push_back(std::move(copy));
+            auto& copy = _itemStorage.emplace_back(std::make_unique<ObjectRepositoryItem>(item));
+            copy->Id = index;
+            _items.push_back(copy.get());
             if (!item.Identifier.empty())
             {
                 _newItemMap[item.Identifier] = index;
@@ -724,7 +896,7 @@ size_t object_repository_get_items_count()
     return objectRepository.GetNumObjects();
 }
 
-const ObjectRepositoryItem* object_repository_get_items()
+const ObjectRepositoryItem* const* object_repository_get_items()
 {
     auto& objectRepository = GetContext()->GetObjectRepository();
     return objectRepository.GetObjects();
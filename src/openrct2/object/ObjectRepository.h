@@ -76,8 +76,28 @@ struct IObjectRepository
 
     virtual void LoadOrConstruct(int32_t language) abstract;
     virtual void Construct(int32_t language) abstract;
+
+    /**
+     * Starts watching the search paths for files being added, modified or removed.
+     */
+    virtual void WatchFiles() abstract;
+
+    /**
+     * Updates the repository and its index for the files that changed since the last call.
+     */
+    virtual void ProcessFileChanges() abstract;
+
+    /**
+     * Writes the object cache for every object in the repository to path, replacing the cache the repository
+     * uses if that is where it is written. Returns the number of objects that were written.
+     */
+    virtual size_t BuildCache(const std::string& path) abstract;
     [[nodiscard]] virtual size_t GetNumObjects() const abstract;
-    [[nodiscard]] virtual const ObjectRepositoryItem* GetObjects() const abstract;
+    /**
+     * Returns the items sorted by name. The order changes when files change, but an item keeps its address for as long
+     * as it is in the repository.
+     */
+    [[nodiscard]] virtual const ObjectRepositoryItem* const* GetObjects() const abstract;
     [[nodiscard]] virtual const ObjectRepositoryItem* FindObjectLegacy(std::string_view legacyIdentifier) const abstract;
     [[nodiscard]] virtual const ObjectRepositoryItem* FindObject(std::string_view identifier) const abstract;
     [[nodiscard]] virtual const ObjectRepositoryItem* FindObject(const rct_object_entry* objectEntry) const abstract;
@@ -101,7 +121,7 @@ struct IObjectRepository
 [[nodiscard]] bool IsObjectCustom(const ObjectRepositoryItem* object);
 
 [[nodiscard]] size_t object_repository_get_items_count();
-[[nodiscard]] const ObjectRepositoryItem* object_repository_get_items();
+[[nodiscard]] const ObjectRepositoryItem* const* object_repository_get_items();
 [[nodiscard]] const ObjectRepositoryItem* object_repository_find_object_by_entry(const rct_object_entry* entry);
 [[nodiscard]] const ObjectRepositoryItem* object_repository_find_object_by_name(const char* name);
 [[nodiscard]] std::unique_ptr<Object> object_repository_load_object(const rct_object_entry* objectEntry);
@@ -18,6 +18,7 @@
 #include "../drawing/IDrawingEngine.h"
 #include "../interface/Chat.h"
 #include "../interface/InteractiveConsole.h"
+#include "../interface/Window.h"
 #include "../localisation/FormatCodes.h"
 #include "../localisation/Formatting.h"
 #include "../localisation/Language.h"
@@ -38,6 +39,7 @@ Painter::Painter(const std::shared_ptr<IUiContext>& uiContext)
 void Painter::Paint(IDrawingEngine& de)
 {
     auto dpi = de.GetDrawingPixelInfo();
+    window_flush_invalidations();
     if (gIntroState != IntroState::None)
     {
         intro_draw(dpi);
@@ -113,6 +115,16 @@ void Painter::PaintFPS(rct_drawpixelinfo* dpi)
 
     // Make area dirty so the text doesn't get drawn over the last
     gfx_set_dirty_blocks({ { screenCoords - ScreenCoordsXY{ 16, 4 } }, { dpi->lastStringPos.x + 16, 16 } });
+
+    // Window invalidations of the frame, requested and the number of windows that were invalidated as a result
+    auto stats = window_get_invalidation_stats();
+    FormatStringToBuffer(
+        buffer, sizeof(buffer), "{OUTLINE}{WHITE}{INT32} / {INT32}", static_cast<int32_t>(stats.Requested),
+        static_cast<int32_t>(stats.Invalidated));
+    stringWidth = gfx_get_string_width(buffer, FontSpriteBase::SMALL);
+    screenCoords = { (_uiContext->GetWidth() - stringWidth) / 2, 14 };
+    gfx_draw_string(dpi, screenCoords, buffer, { FontSpriteBase::SMALL });
+    gfx_set_dirty_blocks({ { screenCoords - ScreenCoordsXY{ 16, 2 } }, { dpi->lastStringPos.x + 16, 26 } });
 }
 
 void Painter::MeasureFPS()
@@ -19,6 +19,7 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../interface/Viewport.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../management/Finance.h"
@@ -37,6 +38,7 @@
 #include "../world/Balloon.h"
 #include "../world/Climate.h"
 #include "../world/ConstructionClearance.h"
+#include "../world/EntityList.h"
 #include "../world/EntityTweener.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
@@ -1161,10 +1163,7 @@ void peep_stop_crowd_noise()
  */
 void peep_update_crowd_noise()
 {
-    if (OpenRCT2::Audio::gGameSoundsOff)
-        return;
-
-    if (!gConfigSound.sound_enabled)
+    if (!OpenRCT2::Audio::IsAvailable())
         return;
 
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
@@ -1174,24 +1173,26 @@ void peep_update_crowd_noise()
     if (viewport == nullptr)
         return;
 
-    // Count the number of peeps visible
+    // Count the number of peeps visible, only looking at those drawn around the viewport
     auto visiblePeeps = 0;
 
-    for (auto peep : EntityList<Guest>())
-    {
+    ScreenRect viewRect(
+        viewport->viewPos.x, viewport->viewPos.y, viewport->viewPos.x + viewport->view_width,
+        viewport->viewPos.y + viewport->view_height);
+    ForEachEntityInMapRange<Guest>(viewport_get_entity_map_range(viewRect), [&viewRect, &visiblePeeps](Guest* peep) {
         if (peep->x == LOCATION_NULL)
-            continue;
-        if (viewport->viewPos.x > peep->SpriteRect.GetRight())
-            continue;
-        if (viewport->viewPos.x + viewport->view_width < peep->SpriteRect.GetLeft())
-            continue;
-        if (viewport->viewPos.y > peep->SpriteRect.GetBottom())
-            continue;
-        if (viewport->viewPos.y + viewport->view_height < peep->SpriteRect.GetTop())
-            continue;
+            return;
+        if (viewRect.GetLeft() > peep->SpriteRect.GetRight())
+            return;
+        if (viewRect.GetRight() < peep->SpriteRect.GetLeft())
+            return;
+        if (viewRect.GetTop() > peep->SpriteRect.GetBottom())
+            return;
+        if (viewRect.GetBottom() < peep->SpriteRect.GetTop())
+            return;
 
         visiblePeeps += peep->State == PeepState::Queuing ? 1 : 2;
-    }
+    });
 
     // This function doesn't account for the fact that the screen might be so big that 100 peeps could potentially be very
     // spread out and therefore not produce any crowd noise. Perhaps a more sophisticated solution would check how many peeps
@@ -21,6 +21,7 @@
 #    include <ctime>
 #    include <dirent.h>
 #    include <pwd.h>
+#    include <sys/resource.h>
 #    include <sys/stat.h>
 
 namespace Platform
@@ -186,6 +187,23 @@ namespace Platform
         return size;
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+        struct rusage usage
+        {
+        };
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+#    if defined(__APPLE__) && defined(__MACH__)
+        // macOS reports bytes, everything else kilobytes
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#    else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#    endif
+    }
+
     bool ShouldIgnoreCase()
     {
         return false;
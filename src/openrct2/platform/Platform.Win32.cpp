@@ -17,6 +17,7 @@
 
 #    include <datetimeapi.h>
 #    include <memory>
+#    include <psapi.h>
 #    include <shlobj.h>
 #    undef GetEnvironmentVariable
 
@@ -569,6 +570,16 @@ namespace Platform
         return size;
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == FALSE)
+        {
+            return 0;
+        }
+        return counters.PeakWorkingSetSize;
+    }
+
     bool ShouldIgnoreCase()
     {
         return true;
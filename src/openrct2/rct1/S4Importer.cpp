@@ -194,6 +194,46 @@ namespace RCT1
             return ParkLoadResult(GetRequiredObjects());
         }
 
+        bool LoadMetadata(IStream* stream, bool isScenario, ParkMetadata* dst) override
+        {
+            // S4 files are a single RLE stream. The date is at the very start and everything GetDetails needs is
+            // at the end, so the map and entities in between are walked over without being written anywhere.
+            size_t dataSize = stream->GetLength() - stream->GetPosition();
+            auto data = stream->ReadArray<uint8_t>(dataSize);
+            int32_t fileType = sawyercoding_detect_file_type(data.get(), dataSize);
+            auto decodeRange = isScenario && (fileType & FILE_VERSION_MASK) != FILE_VERSION_RCT1
+                ? sawyercoding_decode_sc4_range
+                : sawyercoding_decode_sv4_range;
+
+            auto s4Data = reinterpret_cast<uint8_t*>(&_s4);
+            auto dateSize = static_cast<size_t>(reinterpret_cast<uint8_t*>(&_s4.ticks) - s4Data);
+            auto tailOffset = static_cast<size_t>(reinterpret_cast<uint8_t*>(&_s4.research_items) - s4Data) & ~3;
+            auto tailSize = sizeof(S4) - tailOffset;
+            if (decodeRange(data.get(), s4Data, dataSize, 0, dateSize) != dateSize
+                || decodeRange(data.get(), s4Data + tailOffset, dataSize, tailOffset, tailSize) != tailSize)
+            {
+                throw std::runtime_error("Unable to decode park.");
+            }
+            _isScenario = isScenario;
+            _gameVersion = sawyercoding_detect_rct1_version(_s4.game_version) & FILE_VERSION_MASK;
+
+            scenario_index_entry details;
+            GetDetails(&details);
+
+            *dst = {};
+            dst->IsScenario = isScenario;
+            dst->Name = details.name;
+            dst->Details = details.details;
+            dst->Category = details.category;
+            dst->ObjectiveType = details.objective_type;
+            dst->ObjectiveArg1 = details.objective_arg_1;
+            dst->ObjectiveArg2 = static_cast<money32>(details.objective_arg_2);
+            dst->ObjectiveArg3 = details.objective_arg_3;
+            dst->MonthsElapsed = _s4.month;
+            dst->Day = _s4.day;
+            return true;
+        }
+
         void Import() override
         {
             Initialise();
@@ -10,8 +10,13 @@
 #include "SawyerChunkReader.h"
 
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
 #include "../core/Numerics.hpp"
 
+#include <array>
+#include <exception>
+#include <thread>
+
 // malloc is very slow for large allocations in MSVC debug builds as it allocates
 // memory on a special debug heap and then initialises all the memory to 0xCC.
 #if defined(_WIN32) && defined(DEBUG)
@@ -28,6 +33,21 @@ constexpr const char* EXCEPTION_MSG_DESTINATION_TOO_SMALL = "Chunk data larger t
 constexpr const char* EXCEPTION_MSG_INVALID_CHUNK_ENCODING = "Invalid chunk encoding.";
 constexpr const char* EXCEPTION_MSG_ZERO_SIZED_CHUNK = "Encountered zero-sized chunk.";
 
+// The number of bytes each RLE code produces, runs repeat the next byte 257 - code times and
+// literals copy the next code + 1 bytes.
+static constexpr auto RLE_COUNT_TABLE = []() {
+    std::array<uint8_t, 256> table{};
+    for (size_t i = 0; i < table.size(); i++)
+    {
+        table[i] = static_cast<uint8_t>((i & 0x80) ? 257 - i : i + 1);
+    }
+    return table;
+}();
+
+// The most an RLE code reads (code plus a 128 byte literal) and writes (a 129 byte run)
+constexpr size_t RLE_MAX_CODE_INPUT = 129;
+constexpr size_t RLE_MAX_CODE_OUTPUT = 129;
+
 SawyerChunkReader::SawyerChunkReader(OpenRCT2::IStream* stream)
     : _stream(stream)
 {
@@ -49,47 +69,52 @@ void SawyerChunkReader::SkipChunk()
     }
 }
 
+std::unique_ptr<uint8_t[]> SawyerChunkReader::ReadCompressedChunk(sawyercoding_chunk_header& header)
+{
+    header = _stream->ReadValue<sawyercoding_chunk_header>();
+    if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+
+    switch (header.encoding)
+    {
+        case CHUNK_ENCODING_NONE:
+        case CHUNK_ENCODING_RLE:
+        case CHUNK_ENCODING_RLECOMPRESSED:
+        case CHUNK_ENCODING_ROTATE:
+        {
+            auto compressedData = std::make_unique<uint8_t[]>(header.length);
+            if (_stream->TryRead(compressedData.get(), header.length) != header.length)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+            }
+            return compressedData;
+        }
+        default:
+            throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+    }
+}
+
 std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunk()
 {
     uint64_t originalPosition = _stream->GetPosition();
     try
     {
-        auto header = _stream->ReadValue<sawyercoding_chunk_header>();
-        if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
-            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
-
-        switch (header.encoding)
+        sawyercoding_chunk_header header;
+        auto compressedData = ReadCompressedChunk(header);
+        auto buffer = static_cast<uint8_t*>(AllocateLargeTempBuffer());
+        try
         {
-            case CHUNK_ENCODING_NONE:
-            case CHUNK_ENCODING_RLE:
-            case CHUNK_ENCODING_RLECOMPRESSED:
-            case CHUNK_ENCODING_ROTATE:
+            size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData.get(), header);
+            if (uncompressedLength == 0)
             {
-                auto compressedData = std::make_unique<uint8_t[]>(header.length);
-                if (_stream->TryRead(compressedData.get(), header.length) != header.length)
-                {
-                    throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
-                }
-
-                auto buffer = static_cast<uint8_t*>(AllocateLargeTempBuffer());
-                try
-                {
-                    size_t uncompressedLength = DecodeChunk(buffer, MAX_UNCOMPRESSED_CHUNK_SIZE, compressedData.get(), header);
-                    if (uncompressedLength == 0)
-                    {
-                        throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
-                    }
-                    return std::make_shared<SawyerChunk>(
-                        static_cast<SAWYER_ENCODING>(header.encoding), buffer, uncompressedLength);
-                }
-                catch (const std::exception&)
-                {
-                    FreeLargeTempBuffer(buffer);
-                    throw;
-                }
+                throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
             }
-            default:
-                throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+            return std::make_shared<SawyerChunk>(static_cast<SAWYER_ENCODING>(header.encoding), buffer, uncompressedLength);
+        }
+        catch (const std::exception&)
+        {
+            FreeLargeTempBuffer(buffer);
+            throw;
         }
     }
     catch (const std::exception&)
@@ -138,23 +163,73 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
 
 void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
-    auto chunk = ReadChunk();
-    auto chunkData = static_cast<const uint8_t*>(chunk->GetData());
-    auto chunkLength = chunk->GetLength();
-    if (chunkLength > length)
+    uint64_t originalPosition = _stream->GetPosition();
+    try
     {
-        std::memcpy(dst, chunkData, length);
+        sawyercoding_chunk_header header;
+        auto compressedData = ReadCompressedChunk(header);
+        DecodeChunkInto(dst, length, compressedData.get(), header);
     }
-    else
+    catch (const std::exception&)
     {
-        std::memcpy(dst, chunkData, chunkLength);
-        auto remainingLength = length - chunkLength;
-        if (remainingLength > 0)
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
+}
+
+void SawyerChunkReader::ReadChunks(const std::vector<ChunkDestination>& destinations)
+{
+    uint64_t originalPosition = _stream->GetPosition();
+    try
+    {
+        std::vector<sawyercoding_chunk_header> headers(destinations.size());
+        std::vector<std::unique_ptr<uint8_t[]>> compressedData(destinations.size());
+        for (size_t i = 0; i < destinations.size(); i++)
+        {
+            compressedData[i] = ReadCompressedChunk(headers[i]);
+        }
+
+        if (destinations.size() <= 1 || std::thread::hardware_concurrency() <= 1)
+        {
+            for (size_t i = 0; i < destinations.size(); i++)
+            {
+                DecodeChunkInto(destinations[i].Data, destinations[i].Length, compressedData[i].get(), headers[i]);
+            }
+            return;
+        }
+
+        std::vector<std::exception_ptr> errors(destinations.size());
+        JobPool jobPool(destinations.size());
+        for (size_t i = 0; i < destinations.size(); i++)
         {
-            auto offset = static_cast<uint8_t*>(dst) + chunkLength;
-            std::fill_n(offset, remainingLength, 0x00);
+            jobPool.AddTask([&, i]() {
+                try
+                {
+                    DecodeChunkInto(destinations[i].Data, destinations[i].Length, compressedData[i].get(), headers[i]);
+                }
+                catch (const std::exception&)
+                {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        jobPool.Join();
+
+        for (const auto& error : errors)
+        {
+            if (error != nullptr)
+            {
+                std::rethrow_exception(error);
+            }
         }
     }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
 }
 
 void SawyerChunkReader::FreeChunk(void* data)
@@ -162,6 +237,64 @@ void SawyerChunkReader::FreeChunk(void* data)
     FreeLargeTempBuffer(data);
 }
 
+void SawyerChunkReader::DecodeChunkInto(void* dst, size_t length, const void* src, const sawyercoding_chunk_header& header)
+{
+    // Chunks are nearly always read into a structure of the same size, so the decoded length is worked out
+    // first and, if the chunk fits, it is decoded straight into the destination. Larger chunks go through a
+    // temporary buffer so they can be cut down to size.
+    size_t uncompressedLength = 0;
+    switch (header.encoding)
+    {
+        case CHUNK_ENCODING_NONE:
+        case CHUNK_ENCODING_ROTATE:
+            uncompressedLength = header.length;
+            if (uncompressedLength <= length)
+            {
+                DecodeChunk(dst, length, src, header);
+            }
+            break;
+        case CHUNK_ENCODING_RLE:
+            uncompressedLength = MeasureChunkRLE(src, header.length);
+            if (uncompressedLength <= length)
+            {
+                DecodeChunkRLE(dst, length, src, header.length);
+            }
+            break;
+        case CHUNK_ENCODING_RLECOMPRESSED:
+        {
+            auto immLength = MeasureChunkRLE(src, header.length);
+            auto immBuffer = std::make_unique<uint8_t[]>(immLength);
+            DecodeChunkRLE(immBuffer.get(), immLength, src, header.length);
+            uncompressedLength = MeasureChunkRepeat(immBuffer.get(), immLength);
+            if (uncompressedLength <= length)
+            {
+                DecodeChunkRepeat(dst, length, immBuffer.get(), immLength);
+            }
+            break;
+        }
+        default:
+            throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+    }
+
+    if (uncompressedLength == 0)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+    }
+
+    if (uncompressedLength > length)
+    {
+        auto buffer = std::unique_ptr<uint8_t, decltype(&FreeLargeTempBuffer)>(
+            static_cast<uint8_t*>(AllocateLargeTempBuffer()), &FreeLargeTempBuffer);
+        DecodeChunk(buffer.get(), MAX_UNCOMPRESSED_CHUNK_SIZE, src, header);
+        std::memcpy(dst, buffer.get(), length);
+    }
+    else if (uncompressedLength < length)
+    {
+        auto offset = static_cast<uint8_t*>(dst) + uncompressedLength;
+        std::fill_n(offset, length - uncompressedLength, 0x00);
+    }
+}
+
 size_t SawyerChunkReader::DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header)
 {
     size_t resultLength;
@@ -192,9 +325,9 @@ size_t SawyerChunkReader::DecodeChunk(void* dst, size_t dstCapacity, const void*
 
 size_t SawyerChunkReader::DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength)
 {
-    auto immBuffer = std::unique_ptr<uint8_t, decltype(&FreeLargeTempBuffer)>(
-        static_cast<uint8_t*>(AllocateLargeTempBuffer()), &FreeLargeTempBuffer);
-    auto immLength = DecodeChunkRLE(immBuffer.get(), MAX_UNCOMPRESSED_CHUNK_SIZE, src, srcLength);
+    auto immLength = MeasureChunkRLE(src, srcLength);
+    auto immBuffer = std::make_unique<uint8_t[]>(immLength);
+    DecodeChunkRLE(immBuffer.get(), immLength, src, srcLength);
     auto size = DecodeChunkRepeat(dst, dstCapacity, immBuffer.get(), immLength);
     return size;
 }
@@ -204,7 +337,27 @@ size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const vo
     auto src8 = static_cast<const uint8_t*>(src);
     auto dst8 = static_cast<uint8_t*>(dst);
     auto dstEnd = dst8 + dstCapacity;
-    for (size_t i = 0; i < srcLength; i++)
+    size_t i = 0;
+
+    // Neither buffer needs checking while there is room for the largest code in both
+    while (i + RLE_MAX_CODE_INPUT <= srcLength && static_cast<size_t>(dstEnd - dst8) >= RLE_MAX_CODE_OUTPUT)
+    {
+        uint8_t rleCodeByte = src8[i];
+        size_t count = RLE_COUNT_TABLE[rleCodeByte];
+        if (rleCodeByte & 128)
+        {
+            std::memset(dst8, src8[i + 1], count);
+            i += 2;
+        }
+        else
+        {
+            std::memcpy(dst8, src8 + i + 1, count);
+            i += count + 1;
+        }
+        dst8 += count;
+    }
+
+    for (; i < srcLength; i++)
     {
         uint8_t rleCodeByte = src8[i];
         if (rleCodeByte & 128)
@@ -256,6 +409,14 @@ size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const
     {
         if (src8[i] == 0xFF)
         {
+            if (i + 1 >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            if (dst8 >= dstEnd)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+            }
             *dst8++ = src8[++i];
         }
         else
@@ -263,7 +424,7 @@ size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const
             size_t count = (src8[i] & 7) + 1;
             const uint8_t* copySrc = dst8 + static_cast<int32_t>(src8[i] >> 3) - 32;
 
-            if (dst8 + count >= dstEnd || copySrc + count >= dstEnd)
+            if (dst8 + count > dstEnd || copySrc + count > dstEnd)
             {
                 throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
             }
@@ -302,6 +463,50 @@ size_t SawyerChunkReader::DecodeChunkRotate(void* dst, size_t dstCapacity, const
     return srcLength;
 }
 
+size_t SawyerChunkReader::MeasureChunkRLE(const void* src, size_t srcLength)
+{
+    auto src8 = static_cast<const uint8_t*>(src);
+    size_t result = 0;
+    for (size_t i = 0; i < srcLength;)
+    {
+        uint8_t rleCodeByte = src8[i];
+        size_t codeLength = (rleCodeByte & 128) ? 2 : RLE_COUNT_TABLE[rleCodeByte] + 1;
+        if (i + codeLength > srcLength)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+        }
+        result += RLE_COUNT_TABLE[rleCodeByte];
+        i += codeLength;
+    }
+    if (result > MAX_UNCOMPRESSED_CHUNK_SIZE)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+    }
+    return result;
+}
+
+size_t SawyerChunkReader::MeasureChunkRepeat(const void* src, size_t srcLength)
+{
+    auto src8 = static_cast<const uint8_t*>(src);
+    size_t result = 0;
+    for (size_t i = 0; i < srcLength; i++)
+    {
+        if (src8[i] == 0xFF)
+        {
+            if (++i >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            result++;
+        }
+        else
+        {
+            result += (src8[i] & 7) + 1;
+        }
+    }
+    return result;
+}
+
 void* SawyerChunkReader::AllocateLargeTempBuffer()
 {
 #ifdef __USE_HEAP_ALLOC__
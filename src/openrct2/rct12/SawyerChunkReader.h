@@ -15,6 +15,7 @@
 #include "SawyerChunk.h"
 
 #include <memory>
+#include <vector>
 
 class SawyerChunkException : public IOException
 {
@@ -73,6 +74,19 @@ public:
      */
     void ReadChunk(void* dst, size_t length);
 
+    struct ChunkDestination
+    {
+        void* Data;
+        size_t Length;
+    };
+
+    /**
+     * Reads the next chunks from the stream into the given destinations, as
+     * ReadChunk(void*, size_t) would. The compressed data is read in order,
+     * the chunks are then decoded in parallel as they do not depend on each other.
+     */
+    void ReadChunks(const std::vector<ChunkDestination>& destinations);
+
     /**
      * Reads the next chunk from the stream into a buffer returned as the
      * specified type. If the chunk is smaller than the size of the type
@@ -91,11 +105,16 @@ public:
     static void FreeChunk(void* data);
 
 private:
+    std::unique_ptr<uint8_t[]> ReadCompressedChunk(sawyercoding_chunk_header& header);
+
+    static void DecodeChunkInto(void* dst, size_t length, const void* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRotate(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
+    static size_t MeasureChunkRLE(const void* src, size_t srcLength);
+    static size_t MeasureChunkRepeat(const void* src, size_t srcLength);
 
     static void* AllocateLargeTempBuffer();
     static void FreeLargeTempBuffer(void* buffer);
@@ -74,6 +74,12 @@
 
 #define DECRYPT_MONEY(money) (static_cast<money32>(Numerics::rol32((money) ^ 0xF4EC9621, 13)))
 
+// Some scenarios have their scenario details in UTF-8, due to earlier bugs in OpenRCT2.
+static std::string LoadMaybeUTF8(std::string_view str)
+{
+    return !IsLikelyUTF8(str) ? rct2_to_utf8(str, RCT2LanguageId::EnglishUK) : std::string(str);
+}
+
 /**
  * Class to import RollerCoaster Tycoon 2 scenarios (*.SC6) and saved games (*.SV6).
  */
@@ -171,26 +177,31 @@ public:
             _isSV7 = _stricmp(extension, ".sv7") == 0;
         }
 
-        chunkReader.ReadChunk(&_s6.Objects, sizeof(_s6.Objects));
-
+        // The remaining chunks are independent of each other, so they are decoded together
         if (isScenario)
         {
-            chunkReader.ReadChunk(&_s6.elapsed_months, 16);
-            chunkReader.ReadChunk(&_s6.tile_elements, sizeof(_s6.tile_elements));
-            chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 2560076);
-            chunkReader.ReadChunk(&_s6.guests_in_park, 4);
-            chunkReader.ReadChunk(&_s6.last_guests_in_park, 8);
-            chunkReader.ReadChunk(&_s6.park_rating, 2);
-            chunkReader.ReadChunk(&_s6.active_research_types, 1082);
-            chunkReader.ReadChunk(&_s6.current_expenditure, 16);
-            chunkReader.ReadChunk(&_s6.park_value, 4);
-            chunkReader.ReadChunk(&_s6.completed_company_value, 483816);
+            chunkReader.ReadChunks({
+                { &_s6.Objects, sizeof(_s6.Objects) },
+                { &_s6.elapsed_months, 16 },
+                { &_s6.tile_elements, sizeof(_s6.tile_elements) },
+                { &_s6.next_free_tile_element_pointer_index, 2560076 },
+                { &_s6.guests_in_park, 4 },
+                { &_s6.last_guests_in_park, 8 },
+                { &_s6.park_rating, 2 },
+                { &_s6.active_research_types, 1082 },
+                { &_s6.current_expenditure, 16 },
+                { &_s6.park_value, 4 },
+                { &_s6.completed_company_value, 483816 },
+            });
         }
         else
         {
-            chunkReader.ReadChunk(&_s6.elapsed_months, 16);
-            chunkReader.ReadChunk(&_s6.tile_elements, sizeof(_s6.tile_elements));
-            chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 3048816);
+            chunkReader.ReadChunks({
+                { &_s6.Objects, sizeof(_s6.Objects) },
+                { &_s6.elapsed_months, 16 },
+                { &_s6.tile_elements, sizeof(_s6.tile_elements) },
+                { &_s6.next_free_tile_element_pointer_index, 3048816 },
+            });
         }
 
         _s6Path = path;
@@ -198,6 +209,53 @@ public:
         return ParkLoadResult(GetRequiredObjects());
     }
 
+    bool LoadMetadata(OpenRCT2::IStream* stream, bool isScenario, ParkMetadata* dst) override
+    {
+        auto chunkReader = SawyerChunkReader(stream);
+        chunkReader.ReadChunk(&_s6.header, sizeof(_s6.header));
+        if (_s6.header.type != (isScenario ? S6_TYPE_SCENARIO : S6_TYPE_SAVEDGAME))
+        {
+            return false;
+        }
+
+        *dst = {};
+        dst->IsScenario = isScenario;
+        if (isScenario)
+        {
+            chunkReader.ReadChunk(&_s6.info, sizeof(_s6.info));
+            dst->Name = LoadMaybeUTF8(_s6.info.name);
+            dst->Details = LoadMaybeUTF8(_s6.info.details);
+            dst->Category = _s6.info.category;
+            dst->ObjectiveType = _s6.info.objective_type;
+            dst->ObjectiveArg1 = _s6.info.objective_arg_1;
+            dst->ObjectiveArg2 = _s6.info.objective_arg_2;
+            dst->ObjectiveArg3 = _s6.info.objective_arg_3;
+            return true;
+        }
+
+        // Saved games keep the scenario details with the rest of the park, everything in front of that chunk
+        // except for the date is skipped without being decoded.
+        for (uint16_t i = 0; i < _s6.header.num_packed_objects; i++)
+        {
+            stream->Seek(sizeof(rct_object_entry), OpenRCT2::STREAM_SEEK_CURRENT);
+            chunkReader.SkipChunk();
+        }
+        chunkReader.SkipChunk();
+        chunkReader.ReadChunk(&_s6.elapsed_months, 16);
+        chunkReader.SkipChunk();
+        chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 3048816);
+
+        dst->Name = LoadMaybeUTF8(_s6.scenario_name);
+        dst->Details = LoadMaybeUTF8(_s6.scenario_description);
+        dst->ObjectiveType = _s6.objective_type;
+        dst->ObjectiveArg1 = _s6.objective_year;
+        dst->ObjectiveArg2 = _s6.objective_currency;
+        dst->ObjectiveArg3 = _s6.objective_guests;
+        dst->MonthsElapsed = _s6.elapsed_months;
+        dst->Day = _s6.current_day;
+        return true;
+    }
+
     bool GetDetails(scenario_index_entry* dst) override
     {
         *dst = {};
@@ -211,21 +269,16 @@ public:
         gEditorStep = _s6.info.editor_step;
         gScenarioCategory = static_cast<SCENARIO_CATEGORY>(_s6.info.category);
 
-        // Some scenarios have their scenario details in UTF-8, due to earlier bugs in OpenRCT2.
-        auto loadMaybeUTF8 = [](std::string_view str) -> std::string {
-            return !IsLikelyUTF8(str) ? rct2_to_utf8(str, RCT2LanguageId::EnglishUK) : std::string(str);
-        };
-
         if (_s6.header.type == S6_TYPE_SCENARIO)
         {
-            gScenarioName = loadMaybeUTF8(_s6.info.name);
-            gScenarioDetails = loadMaybeUTF8(_s6.info.details);
+            gScenarioName = LoadMaybeUTF8(_s6.info.name);
+            gScenarioDetails = LoadMaybeUTF8(_s6.info.details);
         }
         else
         {
             // Saved games do not have an info chunk
-            gScenarioName = loadMaybeUTF8(_s6.scenario_name);
-            gScenarioDetails = loadMaybeUTF8(_s6.scenario_description);
+            gScenarioName = LoadMaybeUTF8(_s6.scenario_name);
+            gScenarioDetails = LoadMaybeUTF8(_s6.scenario_description);
         }
 
         gDateMonthsElapsed = static_cast<int32_t>(_s6.elapsed_months);
@@ -159,6 +159,31 @@ Ride* GetOrAllocateRide(ride_id_t index)
     return result;
 }
 
+const std::vector<Ride>& GetRides()
+{
+    return _rides;
+}
+
+/**
+ * Replaces all rides with the given copies. Measurements are only used for the ride graphs, so each ride keeps the one
+ * it currently has.
+ */
+void SetRides(const std::vector<Ride>& rides)
+{
+    std::vector<std::shared_ptr<RideMeasurement>> measurements;
+    measurements.reserve(_rides.size());
+    for (auto& ride : _rides)
+    {
+        measurements.push_back(std::move(ride.measurement));
+    }
+
+    _rides = rides;
+    for (size_t i = 0; i < _rides.size(); i++)
+    {
+        _rides[i].measurement = i < measurements.size() ? std::move(measurements[i]) : nullptr;
+    }
+}
+
 Ride* get_ride(ride_id_t index)
 {
     const auto idx = static_cast<size_t>(index);
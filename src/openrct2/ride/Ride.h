@@ -20,7 +20,9 @@
 #include "VehicleEntry.h"
 
 #include <limits>
+#include <memory>
 #include <string_view>
+#include <vector>
 
 struct IObjectManager;
 class Formatter;
@@ -383,7 +385,8 @@ public:
     uint16_t holes;
     uint8_t sheltered_eighths;
 
-    std::unique_ptr<RideMeasurement> measurement;
+    // Shared so rides can be copied by the game state rollback, the measurement itself is not part of the copy.
+    std::shared_ptr<RideMeasurement> measurement;
 
 private:
     void Update();
@@ -1078,6 +1081,8 @@ struct RideManager
 RideManager GetRideManager();
 ride_id_t GetNextFreeRideId();
 Ride* GetOrAllocateRide(ride_id_t index);
+const std::vector<Ride>& GetRides();
+void SetRides(const std::vector<Ride>& rides);
 rct_ride_entry* get_ride_entry(ObjectEntryIndex index);
 std::string_view get_ride_entry_name(ObjectEntryIndex index);
 
@@ -17,6 +17,7 @@
 #include "../core/File.h"
 #include "../core/FileIndex.hpp"
 #include "../core/FileStream.h"
+#include "../core/FileWatcher.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../localisation/LocalisationService.h"
@@ -117,6 +118,7 @@ private:
     std::shared_ptr<IPlatformEnvironment> const _env;
     TrackDesignFileIndex const _fileIndex;
     std::vector<TrackRepositoryItem> _items;
+    std::unique_ptr<FileChangeCollector> _fileChanges;
 
 public:
     explicit TrackDesignRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -215,6 +217,42 @@ public:
         SortItems();
     }
 
+    void WatchFiles() override
+    {
+        _fileChanges = std::make_unique<FileChangeCollector>(_fileIndex.SearchPaths);
+    }
+
+    void ProcessFileChanges() override
+    {
+        if (_fileChanges == nullptr || !_fileChanges->HasChanges())
+        {
+            return;
+        }
+
+        auto language = LocalisationService_GetCurrentLanguage();
+        auto changes = _fileIndex.Update(language, _fileChanges->TakeChanges());
+        if (changes.empty())
+        {
+            return;
+        }
+
+        for (const auto& change : changes)
+        {
+            size_t index = GetTrackIndex(change.Path);
+            if (index != SIZE_MAX)
+            {
+                _items.erase(_items.begin() + index);
+            }
+            if (change.HasItem)
+            {
+                _items.push_back(change.Item);
+            }
+        }
+
+        SortItems();
+        Console::WriteLine("Updated %zu track designs.", changes.size());
+    }
+
     bool Delete(const std::string& path) override
     {
         bool result = false;
@@ -37,6 +37,16 @@ struct ITrackDesignRepository
         uint8_t rideType, const std::string& entry) const abstract;
 
     virtual void Scan(int32_t language) abstract;
+
+    /**
+     * Starts watching the search paths for files being added, modified or removed.
+     */
+    virtual void WatchFiles() abstract;
+
+    /**
+     * Updates the repository and its index for the files that changed since the last call.
+     */
+    virtual void ProcessFileChanges() abstract;
     virtual bool Delete(const std::string& path) abstract;
     virtual std::string Rename(const std::string& path, const std::string& newName) abstract;
     virtual std::string Install(const std::string& path, const std::string& name) abstract;
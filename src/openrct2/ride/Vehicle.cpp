@@ -28,6 +28,7 @@
 #include "../scripting/ScriptEngine.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
+#include "../world/EntityList.h"
 #include "../world/Map.h"
 #include "../world/MapAnimation.h"
 #include "../world/Park.h"
@@ -52,6 +53,7 @@
 
 using namespace OpenRCT2::TrackMetaData;
 static bool vehicle_boat_is_location_accessible(const CoordsXYZ& location);
+static uint8_t vehicle_sounds_update_get_pan_volume(OpenRCT2::Audio::VehicleSoundParams* sound_params);
 
 constexpr int16_t VEHICLE_MAX_SPIN_SPEED = 1536;
 constexpr int16_t VEHICLE_MIN_SPIN_SPEED = -VEHICLE_MAX_SPIN_SPEED;
@@ -776,6 +778,29 @@ template<typename T> int32_t Train<T>::Mass()
     return totalMass;
 }
 
+/**
+ * Gets the area of the screen in which vehicles can be heard. The main window also hears vehicles up to a quarter of
+ * its size beyond each edge.
+ */
+static ScreenRect vehicle_sounds_get_listening_rect()
+{
+    auto left = g_music_tracking_viewport->viewPos.x;
+    auto top = g_music_tracking_viewport->viewPos.y;
+    auto right = left + g_music_tracking_viewport->view_width;
+    auto bottom = top + g_music_tracking_viewport->view_height;
+
+    if (window_get_classification(gWindowAudioExclusive) == WC_MAIN_WINDOW)
+    {
+        const auto quarter_w = g_music_tracking_viewport->view_width / 4;
+        const auto quarter_h = g_music_tracking_viewport->view_height / 4;
+        left -= quarter_w;
+        top -= quarter_h;
+        right += quarter_w;
+        bottom += quarter_h;
+    }
+    return ScreenRect(left, top, right, bottom);
+}
+
 bool Vehicle::SoundCanPlay() const
 {
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
@@ -793,31 +818,11 @@ bool Vehicle::SoundCanPlay() const
     if (g_music_tracking_viewport == nullptr)
         return false;
 
-    const auto quarter_w = g_music_tracking_viewport->view_width / 4;
-    const auto quarter_h = g_music_tracking_viewport->view_height / 4;
-
-    auto left = g_music_tracking_viewport->viewPos.x;
-    auto bottom = g_music_tracking_viewport->viewPos.y;
-
-    if (window_get_classification(gWindowAudioExclusive) == WC_MAIN_WINDOW)
-    {
-        left -= quarter_w;
-        bottom -= quarter_h;
-    }
-
-    if (left >= SpriteRect.GetRight() || bottom >= SpriteRect.GetBottom())
+    auto listeningRect = vehicle_sounds_get_listening_rect();
+    if (listeningRect.GetLeft() >= SpriteRect.GetRight() || listeningRect.GetTop() >= SpriteRect.GetBottom())
         return false;
 
-    auto right = g_music_tracking_viewport->view_width + left;
-    auto top = g_music_tracking_viewport->view_height + bottom;
-
-    if (window_get_classification(gWindowAudioExclusive) == WC_MAIN_WINDOW)
-    {
-        right += quarter_w + quarter_w;
-        top += quarter_h + quarter_h;
-    }
-
-    if (right < SpriteRect.GetRight() || top < SpriteRect.GetTop())
+    if (listeningRect.GetRight() < SpriteRect.GetRight() || listeningRect.GetBottom() < SpriteRect.GetTop())
         return false;
 
     return true;
@@ -919,24 +924,20 @@ void Vehicle::UpdateSoundParams(std::vector<OpenRCT2::Audio::VehicleSoundParams>
         vehicleSoundParamsList.begin(), vehicleSoundParamsList.end(),
         [soundPriority](const auto& param) { return soundPriority > param.priority; });
 
-    if (soundParamIter == std::end(vehicleSoundParamsList))
-    {
-        if (vehicleSoundParamsList.size() < OpenRCT2::Audio::MaxVehicleSounds)
-        {
-            vehicleSoundParamsList.push_back(CreateSoundParam(soundPriority));
-        }
-    }
-    else
+    if (soundParamIter == std::end(vehicleSoundParamsList)
+        && vehicleSoundParamsList.size() >= OpenRCT2::Audio::MaxVehicleSounds)
+        return;
+
+    // Vehicles that would only play silently, near the edges of the listening area, do not take up a voice
+    auto soundParam = CreateSoundParam(soundPriority);
+    if (vehicle_sounds_update_get_pan_volume(&soundParam) == 0)
+        return;
+
+    // Shift all sound params down one, dropping the one of lowest priority when all voices are taken
+    vehicleSoundParamsList.insert(soundParamIter, soundParam);
+    if (vehicleSoundParamsList.size() > OpenRCT2::Audio::MaxVehicleSounds)
     {
-        if (vehicleSoundParamsList.size() < OpenRCT2::Audio::MaxVehicleSounds)
-        {
-            // Shift all sound params down one if using a free space
-            vehicleSoundParamsList.insert(soundParamIter, CreateSoundParam(soundPriority));
-        }
-        else
-        {
-            *soundParamIter = CreateSoundParam(soundPriority);
-        }
+        vehicleSoundParamsList.pop_back();
     }
 }
 
@@ -1146,9 +1147,16 @@ void vehicle_sounds_update()
 
     vehicle_sounds_update_window_setup();
 
-    for (auto vehicle : TrainManager::View())
+    // Only the trains drawn around the listening viewport can be heard
+    if (g_music_tracking_viewport != nullptr)
     {
-        vehicle->UpdateSoundParams(vehicleSoundParamsList);
+        auto range = viewport_get_entity_map_range(vehicle_sounds_get_listening_rect());
+        ForEachEntityInMapRange<Vehicle>(range, [&vehicleSoundParamsList](Vehicle* vehicle) {
+            if (vehicle->IsHead())
+            {
+                vehicle->UpdateSoundParams(vehicleSoundParamsList);
+            }
+        });
     }
 
     // Stop all playing sounds that no longer have priority to play after vehicle_update_sound_params
@@ -18,6 +18,7 @@
 #include "../core/File.h"
 #include "../core/FileIndex.hpp"
 #include "../core/FileStream.h"
+#include "../core/FileWatcher.h"
 #include "../core/MemoryStream.h"
 #include "../core/Numerics.hpp"
 #include "../core/Path.hpp"
@@ -204,8 +205,9 @@ private:
                 try
                 {
                     auto s4Importer = ParkImporter::CreateS4();
-                    s4Importer->LoadScenario(path.c_str(), true);
-                    if (s4Importer->GetDetails(entry))
+                    auto fs = FileStream(path, FILE_MODE_OPEN);
+                    ParkMetadata metadata;
+                    if (s4Importer->LoadMetadata(&fs, true, &metadata) && s4Importer->GetDetails(entry))
                     {
                         String::Set(entry->path, sizeof(entry->path), path.c_str());
                         entry->timestamp = timestamp;
@@ -314,6 +316,7 @@ private:
     ScenarioFileIndex const _fileIndex;
     std::vector<scenario_index_entry> _scenarios;
     std::vector<scenario_highscore_entry*> _highscores;
+    std::unique_ptr<FileChangeCollector> _fileChanges;
 
 public:
     explicit ScenarioRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -346,6 +349,43 @@ public:
         AttachHighscores();
     }
 
+    void WatchFiles() override
+    {
+        _fileChanges = std::make_unique<FileChangeCollector>(_fileIndex.SearchPaths);
+    }
+
+    void ProcessFileChanges() override
+    {
+        if (_fileChanges == nullptr || !_fileChanges->HasChanges())
+        {
+            return;
+        }
+
+        auto language = LocalisationService_GetCurrentLanguage();
+        auto changes = _fileIndex.Update(language, _fileChanges->TakeChanges());
+        if (changes.empty())
+        {
+            return;
+        }
+
+        auto removeStart = std::remove_if(_scenarios.begin(), _scenarios.end(), [&changes](const scenario_index_entry& entry) {
+            return std::any_of(
+                changes.begin(), changes.end(), [&entry](const auto& change) { return Path::Equals(change.Path, entry.path); });
+        });
+        _scenarios.erase(removeStart, _scenarios.end());
+        for (const auto& change : changes)
+        {
+            if (change.HasItem)
+            {
+                AddScenario(change.Item);
+            }
+        }
+
+        Sort();
+        AttachHighscores();
+        Console::WriteLine("Updated %zu scenarios.", changes.size());
+    }
+
     size_t GetCount() const override
     {
         return _scenarios.size();
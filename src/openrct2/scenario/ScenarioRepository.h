@@ -73,6 +73,16 @@ struct IScenarioRepository
      */
     virtual void Scan(int32_t language) abstract;
 
+    /**
+     * Starts watching the search paths for files being added, modified or removed.
+     */
+    virtual void WatchFiles() abstract;
+
+    /**
+     * Updates the repository and its index for the files that changed since the last call.
+     */
+    virtual void ProcessFileChanges() abstract;
+
     virtual size_t GetCount() const abstract;
     virtual const scenario_index_entry* GetByIndex(size_t index) const abstract;
     virtual const scenario_index_entry* GetByFilename(const utf8* filename) const abstract;
@@ -250,6 +250,23 @@ namespace OpenRCT2::Scripting
         return std::nullopt;
     }
 
+    /**
+     * Creates an Int32Array of the given length, filled by fill. Used to return many numbers at once without
+     * creating a script value for each of them.
+     */
+    template<typename TFill> DukValue CreateInt32Array(duk_context* ctx, size_t length, TFill fill)
+    {
+        auto size = length * sizeof(int32_t);
+        auto data = static_cast<int32_t*>(duk_push_fixed_buffer(ctx, size));
+        if (length != 0)
+        {
+            fill(data);
+        }
+        duk_push_buffer_object(ctx, -1, 0, size, DUK_BUFOBJ_INT32ARRAY);
+        duk_remove(ctx, -2);
+        return DukValue::take_from_stack(ctx);
+    }
+
     std::string ProcessString(const DukValue& value);
 
     template<typename T> DukValue ToDuk(duk_context* ctx, const T& value) = delete;
@@ -12,8 +12,11 @@
 #    include "HookEngine.h"
 
 #    include "../core/EnumMap.hpp"
+#    include "Plugin.h"
 #    include "ScriptEngine.h"
 
+#    include <algorithm>
+#    include <chrono>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
@@ -39,6 +42,12 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    auto result = HooksLookupTable.find(type);
+    return (result != HooksLookupTable.end()) ? result->first : std::string_view();
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -49,11 +58,17 @@ HookEngine::HookEngine(ScriptEngine& scriptEngine)
     }
 }
 
-uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function)
+bool Hook::IsCalledForAction(std::string_view actionName) const
+{
+    return ActionFilter.empty() || std::find(ActionFilter.begin(), ActionFilter.end(), actionName) != ActionFilter.end();
+}
+
+uint32_t HookEngine::Subscribe(
+    HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, std::vector<std::string> actionFilter)
 {
     auto& hookList = GetHookList(type);
     auto cookie = _nextCookie++;
-    hookList.Hooks.emplace_back(cookie, owner, function);
+    hookList.Hooks.emplace_back(cookie, owner, function, std::move(actionFilter));
     return cookie;
 }
 
@@ -96,12 +111,20 @@ bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
     return !hookList.Hooks.empty();
 }
 
+bool HookEngine::HasSubscriptions(HOOK_TYPE type, std::string_view actionName) const
+{
+    auto& hookList = GetHookList(type);
+    return std::any_of(hookList.Hooks.begin(), hookList.Hooks.end(), [actionName](const Hook& hook) {
+        return hook.IsCalledForAction(actionName);
+    });
+}
+
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        CallHook(type, hook, {}, isGameStateMutable);
     }
 }
 
@@ -110,7 +133,19 @@ void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutab
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        CallHook(type, hook, { arg }, isGameStateMutable);
+    }
+}
+
+void HookEngine::Call(HOOK_TYPE type, std::string_view actionName, const DukValue& arg, bool isGameStateMutable)
+{
+    auto& hookList = GetHookList(type);
+    for (auto& hook : hookList.Hooks)
+    {
+        if (hook.IsCalledForAction(actionName))
+        {
+            CallHook(type, hook, { arg }, isGameStateMutable);
+        }
     }
 }
 
@@ -145,7 +180,21 @@ void HookEngine::Call(
 
         std::vector<DukValue> dukArgs;
         dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        CallHook(type, hook, dukArgs, isGameStateMutable);
+    }
+}
+
+void HookEngine::CallHook(HOOK_TYPE type, const Hook& hook, const std::vector<DukValue>& args, bool isGameStateMutable)
+{
+    // The hook may be unsubscribed by its own call, so keep hold of what is needed afterwards
+    auto owner = hook.Owner;
+    auto startTime = std::chrono::high_resolution_clock::now();
+    _scriptEngine.ExecutePluginCall(owner, hook.Function, args, isGameStateMutable);
+    if (owner != nullptr)
+    {
+        auto& counters = owner->GetHookCounters(type);
+        counters.NumCalls++;
+        counters.Time += std::chrono::high_resolution_clock::now() - startTime;
     }
 }
 
@@ -17,6 +17,7 @@
 #    include <any>
 #    include <memory>
 #    include <string>
+#    include <string_view>
 #    include <tuple>
 #    include <vector>
 
@@ -45,20 +46,26 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookName(HOOK_TYPE type);
 
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         DukValue Function;
+        // Names of the actions an action hook is called for, empty to be called for every action
+        std::vector<std::string> ActionFilter;
 
         Hook() = default;
-        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function)
+        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function, std::vector<std::string> actionFilter)
             : Cookie(cookie)
             , Owner(owner)
             , Function(function)
+            , ActionFilter(std::move(actionFilter))
         {
         }
+
+        bool IsCalledForAction(std::string_view actionName) const;
     };
 
     struct HookList
@@ -81,17 +88,22 @@ namespace OpenRCT2::Scripting
     public:
         HookEngine(ScriptEngine& scriptEngine);
         HookEngine(const HookEngine&) = delete;
-        uint32_t Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function);
+        uint32_t Subscribe(
+            HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function,
+            std::vector<std::string> actionFilter = {});
         void Unsubscribe(HOOK_TYPE type, uint32_t cookie);
         void UnsubscribeAll(std::shared_ptr<const Plugin> owner);
         void UnsubscribeAll();
         bool HasSubscriptions(HOOK_TYPE type) const;
+        bool HasSubscriptions(HOOK_TYPE type, std::string_view actionName) const;
         void Call(HOOK_TYPE type, bool isGameStateMutable);
         void Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable);
+        void Call(HOOK_TYPE type, std::string_view actionName, const DukValue& arg, bool isGameStateMutable);
         void Call(
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
     private:
+        void CallHook(HOOK_TYPE type, const Hook& hook, const std::vector<DukValue>& args, bool isGameStateMutable);
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
     };
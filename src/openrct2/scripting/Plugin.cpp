@@ -15,11 +15,14 @@
 #    include "../OpenRCT2.h"
 #    include "../core/File.h"
 #    include "Duktape.hpp"
+#    include "PluginBytecodeCache.h"
 #    include "ScriptEngine.h"
 
 #    include <algorithm>
+#    include <chrono>
 #    include <fstream>
 #    include <memory>
+#    include <vector>
 
 using namespace OpenRCT2::Scripting;
 
@@ -34,43 +37,84 @@ void Plugin::SetCode(std::string_view code)
     _code = code;
 }
 
-void Plugin::Load()
+void Plugin::Load(PluginBytecodeCache* bytecodeCache)
 {
+    _loadTimings = {};
+    auto startTime = std::chrono::high_resolution_clock::now();
     if (!_path.empty())
     {
         LoadCodeFromFile();
     }
+    auto compileStartTime = std::chrono::high_resolution_clock::now();
+    _loadTimings.Read = compileStartTime - startTime;
 
-    std::string projectedVariables = "console,context,date,map,network,park";
+    std::vector<const char*> projectedVariables = { "console", "context", "date", "map", "network", "park" };
     if (!gOpenRCT2Headless)
     {
-        projectedVariables += ",ui";
+        projectedVariables.push_back("ui");
     }
 
-    // Wrap the script in a function and pass the global objects as variables
+    // Wrap the script in a function and pass the global objects as arguments
     // so that if the script modifies them, they are not modified for other scripts.
+    std::string parameters;
+    for (auto variable : projectedVariables)
+    {
+        if (!parameters.empty())
+        {
+            parameters.push_back(',');
+        }
+        parameters += variable;
+    }
 
     // clang-format off
-    auto code = _code;
-    code =
-        "     (function(" + projectedVariables + ") {"
-        "         var __metadata__ = null;"
-        "         var registerPlugin = function(m) { __metadata__ = m };"
-        "         (function(__metadata__) {"
-                      + code +
-        "         })();"
-        "         return __metadata__;"
-        "     })(" + projectedVariables + ");";
+    auto code =
+        "function(" + parameters + ") {"
+        "    var __metadata__ = null;"
+        "    var registerPlugin = function(m) { __metadata__ = m };"
+        "    (function(__metadata__) {"
+                 + _code +
+        "    })();"
+        "    return __metadata__;"
+        "}";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
+    // Compiling is the slow part of loading large plugins, so the compiled function is kept in the cache
+    PluginBytecodeCache::Key key{};
+    if (bytecodeCache != nullptr && HasPath())
+    {
+        key = PluginBytecodeCache::GetKey(code);
+        _loadTimings.FromBytecodeCache = bytecodeCache->TryPushFunction(_context, _path, key);
+    }
+    if (!_loadTimings.FromBytecodeCache)
+    {
+        auto flags = DUK_COMPILE_FUNCTION | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
+        auto result = duk_compile_raw(_context, code.c_str(), code.size(), flags);
+        if (result != DUK_ERR_NONE)
+        {
+            auto val = std::string(duk_safe_to_string(_context, -1));
+            duk_pop(_context);
+            throw std::runtime_error("Failed to load plug-in script: " + val);
+        }
+        if (bytecodeCache != nullptr && HasPath())
+        {
+            bytecodeCache->Store(_context, _path, key);
+        }
+    }
+    auto runStartTime = std::chrono::high_resolution_clock::now();
+    _loadTimings.Compile = runStartTime - compileStartTime;
+
+    for (auto variable : projectedVariables)
+    {
+        duk_get_global_string(_context, variable);
+    }
+    auto result = duk_pcall(_context, static_cast<duk_idx_t>(projectedVariables.size()));
     if (result != DUK_ERR_NONE)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
         duk_pop(_context);
         throw std::runtime_error("Failed to load plug-in script: " + val);
     }
+    _loadTimings.Run = std::chrono::high_resolution_clock::now() - runStartTime;
 
     _metadata = GetMetadata(DukValue::take_from_stack(_context));
 }
@@ -83,6 +127,7 @@ void Plugin::Start()
         throw std::runtime_error("No main function specified.");
     }
 
+    auto startTime = std::chrono::high_resolution_clock::now();
     mainFunc.push();
     auto result = duk_pcall(_context, 0);
     if (result != DUK_ERR_NONE)
@@ -92,6 +137,7 @@ void Plugin::Start()
         throw std::runtime_error("[" + _metadata.Name + "] " + val);
     }
     duk_pop(_context);
+    _loadTimings.Start = std::chrono::high_resolution_clock::now() - startTime;
 
     _hasStarted = true;
 }
@@ -178,4 +224,11 @@ int32_t Plugin::GetTargetAPIVersion() const
     return 33;
 }
 
+void Plugin::ResetCounters()
+{
+    _hookCounters = {};
+    _intervalCounters = {};
+    _frameUsage.NumOverBudgetFrames = 0;
+}
+
 #endif
@@ -12,7 +12,10 @@
 #ifdef ENABLE_SCRIPTING
 
 #    include "Duktape.hpp"
+#    include "HookEngine.h"
 
+#    include <array>
+#    include <chrono>
 #    include <memory>
 #    include <string>
 #    include <string_view>
@@ -35,6 +38,43 @@ namespace OpenRCT2::Scripting
         Remote,
     };
 
+    class PluginBytecodeCache;
+
+    /**
+     * How many times the hooks a plugin subscribed to of one type were called, and how long they took in total.
+     */
+    struct PluginHookCounters
+    {
+        uint64_t NumCalls{};
+        std::chrono::duration<double> Time{};
+    };
+
+    /**
+     * Time a plugin spent in its callbacks during the current frame, which is checked against the configured budget.
+     * A frame covers every callback since the last update of the script engine: hooks of all the game ticks run in
+     * it, intervals and UI callbacks.
+     */
+    struct PluginFrameUsage
+    {
+        std::chrono::duration<double> Time{};
+        uint32_t NumOverBudgetFrames{};
+        // Number of frames the intervals of the plugin are held back for after going over the budget
+        uint32_t NumThrottledFrames{};
+        uint32_t LastWarningTimestamp{};
+    };
+
+    /**
+     * How long each step of loading and starting a plugin took.
+     */
+    struct PluginLoadTimings
+    {
+        std::chrono::duration<double> Read{};
+        std::chrono::duration<double> Compile{};
+        std::chrono::duration<double> Run{};
+        std::chrono::duration<double> Start{};
+        bool FromBytecodeCache{};
+    };
+
     struct PluginMetadata
     {
         std::string Name;
@@ -54,6 +94,10 @@ namespace OpenRCT2::Scripting
         PluginMetadata _metadata{};
         std::string _code;
         bool _hasStarted{};
+        std::array<PluginHookCounters, NUM_HOOK_TYPES> _hookCounters{};
+        PluginHookCounters _intervalCounters{};
+        PluginFrameUsage _frameUsage{};
+        PluginLoadTimings _loadTimings{};
 
     public:
         std::string GetPath() const
@@ -83,13 +127,50 @@ namespace OpenRCT2::Scripting
 
         int32_t GetTargetAPIVersion() const;
 
+        PluginHookCounters& GetHookCounters(HOOK_TYPE type)
+        {
+            return _hookCounters[static_cast<size_t>(type)];
+        }
+
+        const PluginHookCounters& GetHookCounters(HOOK_TYPE type) const
+        {
+            return _hookCounters[static_cast<size_t>(type)];
+        }
+
+        PluginHookCounters& GetIntervalCounters()
+        {
+            return _intervalCounters;
+        }
+
+        const PluginHookCounters& GetIntervalCounters() const
+        {
+            return _intervalCounters;
+        }
+
+        PluginFrameUsage& GetFrameUsage()
+        {
+            return _frameUsage;
+        }
+
+        const PluginFrameUsage& GetFrameUsage() const
+        {
+            return _frameUsage;
+        }
+
+        void ResetCounters();
+
+        const PluginLoadTimings& GetLoadTimings() const
+        {
+            return _loadTimings;
+        }
+
         Plugin() = default;
         Plugin(duk_context* context, const std::string& path);
         Plugin(const Plugin&) = delete;
         Plugin(Plugin&&) = delete;
 
         void SetCode(std::string_view code);
-        void Load();
+        void Load(PluginBytecodeCache* bytecodeCache = nullptr);
         void Start();
         void Stop();
 
@@ -0,0 +1,208 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "PluginBytecodeCache.h"
+
+#    include "../Version.h"
+#    include "../core/Console.hpp"
+#    include "../core/File.h"
+#    include "../core/FileStream.h"
+#    include "../core/MemoryStream.h"
+
+#    include <cstring>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Scripting;
+
+static constexpr uint32_t MAGIC_NUMBER = 0x43424C50; // PLBC
+static constexpr uint16_t VERSION = 2;
+
+static duk_ret_t LoadFunction(duk_context* ctx, void*)
+{
+    duk_load_function(ctx);
+    return 1;
+}
+
+static duk_ret_t DumpFunction(duk_context* ctx, void*)
+{
+    duk_dump_function(ctx);
+    return 1;
+}
+
+PluginBytecodeCache::PluginBytecodeCache(std::string path)
+    : _path(std::move(path))
+{
+}
+
+PluginBytecodeCache::Key PluginBytecodeCache::GetKey(std::string_view source)
+{
+    // Bytecode is specific to the Duktape version and build, the version info of the game includes the platform
+    // and architecture it was built for
+    auto hash = Crypt::CreateFNV1a();
+    hash->Update(gVersionInfoFull, std::strlen(gVersionInfoFull) + 1);
+    auto dukVersion = static_cast<int64_t>(DUK_VERSION);
+    hash->Update(&dukVersion, sizeof(dukVersion));
+    hash->Update(source.data(), source.size());
+    return hash->Finish();
+}
+
+bool PluginBytecodeCache::TryPushFunction(duk_context* ctx, const std::string& pluginPath, const Key& key)
+{
+    Load();
+
+    auto it = _entries.find(pluginPath);
+    if (it == _entries.end() || it->second.SourceKey != key)
+    {
+        return false;
+    }
+
+    auto& entry = it->second;
+    auto buffer = duk_push_fixed_buffer(ctx, entry.Bytecode.size());
+    std::memcpy(buffer, entry.Bytecode.data(), entry.Bytecode.size());
+    if (duk_safe_call(ctx, LoadFunction, nullptr, 1, 1) != DUK_EXEC_SUCCESS)
+    {
+        duk_pop(ctx);
+        _entries.erase(it);
+        _modified = true;
+        return false;
+    }
+    entry.Used = true;
+    return true;
+}
+
+void PluginBytecodeCache::Store(duk_context* ctx, const std::string& pluginPath, const Key& key)
+{
+    Load();
+
+    duk_dup_top(ctx);
+    if (duk_safe_call(ctx, DumpFunction, nullptr, 1, 1) == DUK_EXEC_SUCCESS)
+    {
+        duk_size_t size{};
+        auto data = static_cast<const uint8_t*>(duk_get_buffer_data(ctx, -1, &size));
+        if (data != nullptr)
+        {
+            auto& entry = _entries[pluginPath];
+            entry.SourceKey = key;
+            entry.Bytecode.assign(data, data + size);
+            entry.Used = true;
+            _modified = true;
+        }
+    }
+    duk_pop(ctx);
+}
+
+void PluginBytecodeCache::Save()
+{
+    if (!_modified)
+    {
+        return;
+    }
+
+    try
+    {
+        uint32_t numEntries = 0;
+        for (const auto& [path, entry] : _entries)
+        {
+            numEntries += entry.Used ? 1 : 0;
+        }
+
+        // The game may be running more than once, so the file is written next to the old one and then moved over it
+        // rather than another instance reading it half written.
+        auto tempPath = _path + ".tmp";
+        {
+            auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+            fs.WriteValue<uint32_t>(MAGIC_NUMBER);
+            fs.WriteValue<uint16_t>(VERSION);
+            fs.WriteValue<uint16_t>(0);
+            fs.WriteValue<uint32_t>(numEntries);
+            for (const auto& [path, entry] : _entries)
+            {
+                if (entry.Used)
+                {
+                    // The checksum guards against loading a damaged file, Duktape does not validate bytecode
+                    fs.WriteString(path);
+                    fs.WriteValue(entry.SourceKey);
+                    fs.WriteValue(Crypt::FNV1a(entry.Bytecode.data(), entry.Bytecode.size()));
+                    fs.WriteValue<uint32_t>(static_cast<uint32_t>(entry.Bytecode.size()));
+                    fs.Write(entry.Bytecode.data(), entry.Bytecode.size());
+                }
+            }
+        }
+
+        if (!File::Move(tempPath, _path))
+        {
+            File::Delete(_path);
+            if (!File::Move(tempPath, _path))
+            {
+                File::Delete(tempPath);
+                throw IOException("Unable to replace " + _path);
+            }
+        }
+        _modified = false;
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to write plugin bytecode cache: %s", e.what());
+    }
+}
+
+void PluginBytecodeCache::Load()
+{
+    if (_loaded)
+    {
+        return;
+    }
+    _loaded = true;
+
+    if (!File::Exists(_path))
+    {
+        return;
+    }
+
+    try
+    {
+        auto data = File::ReadAllBytes(_path);
+        auto ms = MemoryStream(data.data(), data.size());
+        auto magic = ms.ReadValue<uint32_t>();
+        auto version = ms.ReadValue<uint16_t>();
+        ms.ReadValue<uint16_t>();
+        if (magic != MAGIC_NUMBER || version != VERSION)
+        {
+            return;
+        }
+
+        auto numEntries = ms.ReadValue<uint32_t>();
+        for (uint32_t i = 0; i < numEntries; i++)
+        {
+            auto path = ms.ReadStdString();
+            Entry entry;
+            entry.SourceKey = ms.ReadValue<Key>();
+            auto checksum = ms.ReadValue<Key>();
+            auto size = ms.ReadValue<uint32_t>();
+            if (size > ms.GetLength() - ms.GetPosition())
+            {
+                throw std::runtime_error("Bytecode is truncated.");
+            }
+            entry.Bytecode.resize(size);
+            ms.Read(entry.Bytecode.data(), size);
+            if (Crypt::FNV1a(entry.Bytecode.data(), entry.Bytecode.size()) == checksum)
+            {
+                _entries[path] = std::move(entry);
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to read plugin bytecode cache: %s", e.what());
+    }
+}
+
+#endif
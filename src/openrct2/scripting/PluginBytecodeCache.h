@@ -0,0 +1,75 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../core/Crypt.h"
+#    include "Duktape.hpp"
+
+#    include <string>
+#    include <string_view>
+#    include <unordered_map>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    /**
+     * Keeps the compiled bytecode of each plugin in a single file in the cache directory, so that plugins do not
+     * have to be compiled from source every time the game starts. The bytecode of a plugin is only used when the
+     * key, a hash of its source and the version of the game and Duktape, still matches. Entries of plugins that
+     * were not loaded since the cache was read are dropped when it is saved.
+     */
+    class PluginBytecodeCache
+    {
+    public:
+        // FNV-1a is always built, unlike SHA-1 which needs the network code, and is enough for a cache
+        using Key = Crypt::FNV1aAlgorithm::Result;
+
+    private:
+        struct Entry
+        {
+            Key SourceKey{};
+            std::vector<uint8_t> Bytecode;
+            bool Used{};
+        };
+
+        std::string _path;
+        std::unordered_map<std::string, Entry> _entries;
+        bool _loaded{};
+        bool _modified{};
+
+    public:
+        explicit PluginBytecodeCache(std::string path);
+
+        static Key GetKey(std::string_view source);
+
+        /**
+         * Pushes the cached function of the plugin onto the stack. Returns false, with nothing pushed, if the cache
+         * has no bytecode for the plugin or it was compiled from a different source.
+         */
+        bool TryPushFunction(duk_context* ctx, const std::string& pluginPath, const Key& key);
+
+        /**
+         * Stores the bytecode of the function on top of the stack as the compiled source of the plugin.
+         */
+        void Store(duk_context* ctx, const std::string& pluginPath, const Key& key);
+
+        /**
+         * Writes the cache file if any plugin was compiled since it was read.
+         */
+        void Save();
+
+    private:
+        void Load();
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -21,6 +21,7 @@
 #    include "../core/File.h"
 #    include "../core/FileScanner.h"
 #    include "../core/Path.hpp"
+#    include "../core/String.hpp"
 #    include "../interface/InteractiveConsole.h"
 #    include "../platform/Platform2.h"
 #    include "Duktape.hpp"
@@ -380,6 +381,7 @@ ScriptEngine::ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& en
     : _console(console)
     , _env(env)
     , _hookEngine(*this)
+    , _bytecodeCache(env.GetFilePath(PATHID::CACHE_PLUGINS))
 {
 }
 
@@ -462,6 +464,7 @@ void ScriptEngine::LoadPlugins()
                 LoadPlugin(path);
             }
         }
+        _bytecodeCache.Save();
 
         if (gConfigPlugin.enable_hot_reloading && network_get_mode() == NETWORK_MODE_NONE)
         {
@@ -483,7 +486,7 @@ void ScriptEngine::LoadPlugin(std::shared_ptr<Plugin>& plugin)
     try
     {
         ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, false);
-        plugin->Load();
+        plugin->Load(&_bytecodeCache);
 
         auto metadata = plugin->GetMetadata();
         if (metadata.MinApiVersion <= OPENRCT2_PLUGIN_API_VERSION)
@@ -557,6 +560,12 @@ void ScriptEngine::AutoReloadPlugins()
         std::lock_guard<std::mutex> guard(_changedPluginFilesMutex);
         for (auto& path : _changedPluginFiles)
         {
+            // The watcher also reports removed files, keep running the plugin until a new version is written.
+            if (!File::Exists(path))
+            {
+                continue;
+            }
+
             auto findResult = std::find_if(_plugins.begin(), _plugins.end(), [&path](const std::shared_ptr<Plugin>& plugin) {
                 return Path::Equals(path, plugin->GetPath());
             });
@@ -568,7 +577,7 @@ void ScriptEngine::AutoReloadPlugins()
                     StopPlugin(plugin);
 
                     ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, false);
-                    plugin->Load();
+                    plugin->Load(&_bytecodeCache);
                     LogPluginInfo(plugin, "Reloaded");
                     plugin->Start();
                 }
@@ -579,6 +588,7 @@ void ScriptEngine::AutoReloadPlugins()
             }
         }
         _changedPluginFiles.clear();
+        _bytecodeCache.Save();
     }
 }
 
@@ -670,11 +680,49 @@ void ScriptEngine::Update()
         }
     }
 
+    UpdatePluginBudgets();
     UpdateIntervals();
     UpdateSockets();
     ProcessREPL();
 }
 
+void ScriptEngine::UpdatePluginBudgets()
+{
+    // Called once per frame, the time each plugin spent since the last call is checked against the budget. At higher
+    // game speeds a frame runs several game ticks, so this is not a budget per tick.
+    std::chrono::duration<double, std::milli> budget(gConfigPlugin.frame_budget);
+    auto timestamp = Platform::GetTicks();
+    for (auto& plugin : _plugins)
+    {
+        auto& usage = plugin->GetFrameUsage();
+        if (budget.count() > 0 && usage.Time > budget)
+        {
+            usage.NumOverBudgetFrames++;
+            if (usage.NumOverBudgetFrames == 1 || timestamp - usage.LastWarningTimestamp >= PLUGIN_BUDGET_WARNING_INTERVAL)
+            {
+                LogPluginInfo(
+                    plugin,
+                    String::StdFormat(
+                        "Took %.2f ms of the %.2f ms budget for a frame, see plugin_profile in the console.",
+                        std::chrono::duration<double, std::milli>(usage.Time).count(), budget.count()));
+                usage.LastWarningTimestamp = timestamp;
+            }
+            if (gConfigPlugin.throttle_over_budget)
+            {
+                // Hold back the intervals for as many frames as the budget was used up, hooks are always called as
+                // they can change the game state
+                auto numFrames = static_cast<uint32_t>(usage.Time / budget);
+                usage.NumThrottledFrames = std::min(numFrames, PLUGIN_MAX_THROTTLED_FRAMES);
+            }
+        }
+        else if (usage.NumThrottledFrames != 0)
+        {
+            usage.NumThrottledFrames--;
+        }
+        usage.Time = {};
+    }
+}
+
 void ScriptEngine::ProcessREPL()
 {
     while (_evalQueue.size() > 0)
@@ -729,7 +777,9 @@ DukValue ScriptEngine::ExecutePluginCall(
         {
             arg.push();
         }
+        _profiler.Enter(plugin, func);
         auto result = duk_pcall_method(_context, static_cast<duk_idx_t>(args.size()));
+        _profiler.Leave();
         if (result == DUK_EXEC_SUCCESS)
         {
             return DukValue::take_from_stack(_context);
@@ -1099,70 +1149,155 @@ static std::unique_ptr<GameAction> CreateGameActionFromActionId(const std::strin
     return nullptr;
 }
 
+/**
+ * Building the arguments and result of an action is a large part of the cost of an action hook, and
+ * most hooks only look at the action name. Those two properties are therefore getters that build the
+ * value the first time it is read and then replace themselves with it.
+ */
+struct OpenRCT2::Scripting::LazyActionEventArgs
+{
+    ScriptEngine* Engine;
+    const GameAction* Action;
+    const std::unique_ptr<GameActions::Result>* Result;
+};
+
+// Hidden property of the event object pointing to its LazyActionEventArgs, only valid while the hooks run
+static constexpr const char* LazyActionEventArgsProperty = "\xFF"
+                                                           "lazyActionEventArgs";
+static constexpr const char* LazyActionEventArgNames[] = { "args", "result" };
+
+void ScriptEngine::DefineLazyActionEventArgs(const DukValue& eventArgs, const LazyActionEventArgs* lazyArgs)
+{
+    eventArgs.push();
+    duk_push_pointer(_context, const_cast<LazyActionEventArgs*>(lazyArgs));
+    duk_put_prop_string(_context, -2, LazyActionEventArgsProperty);
+    for (duk_int_t magic = 0; magic < static_cast<duk_int_t>(std::size(LazyActionEventArgNames)); magic++)
+    {
+        duk_push_string(_context, LazyActionEventArgNames[magic]);
+        duk_push_c_function(_context, GetLazyActionEventArg, 0);
+        duk_set_magic(_context, -1, magic);
+        duk_push_c_function(_context, SetLazyActionEventArg, 1);
+        duk_set_magic(_context, -1, magic);
+        duk_def_prop(
+            _context, -4,
+            DUK_DEFPROP_HAVE_GETTER | DUK_DEFPROP_HAVE_SETTER | DUK_DEFPROP_SET_ENUMERABLE | DUK_DEFPROP_SET_CONFIGURABLE);
+    }
+    duk_pop(_context);
+}
+
+duk_ret_t ScriptEngine::GetLazyActionEventArg(duk_context* ctx)
+{
+    auto magic = duk_get_current_magic(ctx);
+    duk_push_this(ctx);
+    duk_get_prop_string(ctx, -1, LazyActionEventArgsProperty);
+    auto lazyArgs = static_cast<const LazyActionEventArgs*>(duk_get_pointer(ctx, -1));
+    duk_pop(ctx);
+    if (lazyArgs == nullptr)
+    {
+        // The hooks have finished, the action and its result no longer exist
+        return 0;
+    }
+
+    auto value = magic == 0 ? lazyArgs->Engine->GameActionArgsToDuk(*lazyArgs->Action)
+                            : lazyArgs->Engine->GameActionResultToDuk(*lazyArgs->Action, *lazyArgs->Result);
+
+    // Replace the getter with the value so that it is only built once and can be modified by the hook
+    duk_push_string(ctx, LazyActionEventArgNames[magic]);
+    value.push();
+    duk_def_prop(
+        ctx, -3,
+        DUK_DEFPROP_HAVE_VALUE | DUK_DEFPROP_SET_WRITABLE | DUK_DEFPROP_SET_ENUMERABLE | DUK_DEFPROP_SET_CONFIGURABLE);
+    value.push();
+    return 1;
+}
+
+duk_ret_t ScriptEngine::SetLazyActionEventArg(duk_context* ctx)
+{
+    auto magic = duk_get_current_magic(ctx);
+    duk_push_this(ctx);
+    duk_push_string(ctx, LazyActionEventArgNames[magic]);
+    duk_dup(ctx, 0);
+    duk_def_prop(
+        ctx, -3,
+        DUK_DEFPROP_HAVE_VALUE | DUK_DEFPROP_SET_WRITABLE | DUK_DEFPROP_SET_ENUMERABLE | DUK_DEFPROP_SET_CONFIGURABLE);
+    return 0;
+}
+
+DukValue ScriptEngine::GameActionArgsToDuk(const GameAction& action)
+{
+    if (action.GetType() == GameCommand::Custom)
+    {
+        auto& customAction = static_cast<const CustomAction&>(action);
+        auto dukArgs = DuktapeTryParseJson(_context, customAction.GetJson());
+        if (dukArgs)
+        {
+            return *dukArgs;
+        }
+
+        DukObject args(_context);
+        return args.Take();
+    }
+
+    DukObject args(_context);
+    DukFromGameActionParameterVisitor visitor(args);
+    const_cast<GameAction&>(action).AcceptParameters(visitor);
+    const_cast<GameAction&>(action).AcceptFlags(visitor);
+    return args.Take();
+}
+
 void ScriptEngine::RunGameActionHooks(const GameAction& action, std::unique_ptr<GameActions::Result>& result, bool isExecute)
 {
     DukStackFrame frame(_context);
 
     auto hookType = isExecute ? HOOK_TYPE::ACTION_EXECUTE : HOOK_TYPE::ACTION_QUERY;
-    if (_hookEngine.HasSubscriptions(hookType))
+    if (!_hookEngine.HasSubscriptions(hookType))
     {
-        DukObject obj(_context);
-
-        auto actionId = action.GetType();
-        if (action.GetType() == GameCommand::Custom)
-        {
-            auto customAction = static_cast<const CustomAction&>(action);
-            obj.Set("action", customAction.GetId());
+        return;
+    }
 
-            auto dukArgs = DuktapeTryParseJson(_context, customAction.GetJson());
-            if (dukArgs)
-            {
-                obj.Set("args", *dukArgs);
-            }
-            else
-            {
-                DukObject args(_context);
-                obj.Set("args", args.Take());
-            }
-        }
-        else
-        {
-            auto actionName = GetActionName(actionId);
-            if (!actionName.empty())
-            {
-                obj.Set("action", actionName);
-            }
+    auto actionId = action.GetType();
+    auto actionName = actionId == GameCommand::Custom ? static_cast<const CustomAction&>(action).GetId()
+                                                      : GetActionName(actionId);
+    if (!_hookEngine.HasSubscriptions(hookType, actionName))
+    {
+        return;
+    }
 
-            DukObject args(_context);
-            DukFromGameActionParameterVisitor visitor(args);
-            const_cast<GameAction&>(action).AcceptParameters(visitor);
-            const_cast<GameAction&>(action).AcceptFlags(visitor);
-            obj.Set("args", args.Take());
-        }
+    DukObject obj(_context);
+    if (!actionName.empty())
+    {
+        obj.Set("action", actionName);
+    }
+    obj.Set("player", action.GetPlayer());
+    obj.Set("type", EnumValue(actionId));
 
-        obj.Set("player", action.GetPlayer());
-        obj.Set("type", EnumValue(actionId));
+    auto flags = action.GetActionFlags();
+    obj.Set("isClientOnly", (flags & GameActions::Flags::ClientOnly) != 0);
 
-        auto flags = action.GetActionFlags();
-        obj.Set("isClientOnly", (flags & GameActions::Flags::ClientOnly) != 0);
+    auto dukEventArgs = obj.Take();
+    LazyActionEventArgs lazyArgs{ this, &action, &result };
+    DefineLazyActionEventArgs(dukEventArgs, &lazyArgs);
 
-        obj.Set("result", GameActionResultToDuk(action, result));
-        auto dukEventArgs = obj.Take();
+    _hookEngine.Call(hookType, actionName, dukEventArgs, false);
 
-        _hookEngine.Call(hookType, dukEventArgs, false);
+    // Plugins may have kept the event object, make sure it no longer refers to the action
+    dukEventArgs.push();
+    duk_push_pointer(_context, nullptr);
+    duk_put_prop_string(_context, -2, LazyActionEventArgsProperty);
+    duk_pop(_context);
 
-        if (!isExecute)
+    if (!isExecute)
+    {
+        // Only set if a hook read or replaced the result
+        auto dukResult = dukEventArgs["result"];
+        if (dukResult.type() == DukValue::Type::OBJECT)
         {
-            auto dukResult = dukEventArgs["result"];
-            if (dukResult.type() == DukValue::Type::OBJECT)
+            auto error = AsOrDefault<int32_t>(dukResult["error"]);
+            if (error != 0)
             {
-                auto error = AsOrDefault<int32_t>(dukResult["error"]);
-                if (error != 0)
-                {
-                    result->Error = static_cast<GameActions::Status>(error);
-                    result->ErrorTitle = AsOrDefault<std::string>(dukResult["errorTitle"]);
-                    result->ErrorMessage = AsOrDefault<std::string>(dukResult["errorMessage"]);
-                }
+                result->Error = static_cast<GameActions::Status>(error);
+                result->ErrorTitle = AsOrDefault<std::string>(dukResult["errorTitle"]);
+                result->ErrorMessage = AsOrDefault<std::string>(dukResult["errorMessage"]);
             }
         }
     }
@@ -1312,7 +1447,20 @@ void ScriptEngine::UpdateIntervals()
         {
             if (timestamp >= interval.LastTimestamp + interval.Delay)
             {
-                ExecutePluginCall(interval.Owner, interval.Callback, {}, false);
+                auto owner = interval.Owner;
+                if (owner != nullptr && owner->GetFrameUsage().NumThrottledFrames != 0)
+                {
+                    continue;
+                }
+
+                auto startTime = std::chrono::high_resolution_clock::now();
+                ExecutePluginCall(owner, interval.Callback, {}, false);
+                if (owner != nullptr)
+                {
+                    auto& counters = owner->GetIntervalCounters();
+                    counters.NumCalls++;
+                    counters.Time += std::chrono::high_resolution_clock::now() - startTime;
+                }
 
                 interval.LastTimestamp = timestamp;
                 if (!interval.Repeat)
@@ -17,6 +17,8 @@
 #    include "../world/Location.hpp"
 #    include "HookEngine.h"
 #    include "Plugin.h"
+#    include "PluginBytecodeCache.h"
+#    include "ScriptProfiler.h"
 
 #    include <future>
 #    include <list>
@@ -46,11 +48,18 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 38;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 40;
+
+    // Minimum time between two warnings about a plugin going over its budget, in milliseconds.
+    static constexpr uint32_t PLUGIN_BUDGET_WARNING_INTERVAL = 10000;
+    // Maximum number of frames the intervals of a plugin are held back for after going over its budget.
+    static constexpr uint32_t PLUGIN_MAX_THROTTLED_FRAMES = 40;
 
     // Versions marking breaking changes.
     static constexpr int32_t API_VERSION_33_PEEP_DEPRECATION = 33;
 
+    struct LazyActionEventArgs;
+
 #    ifndef DISABLE_NETWORK
     class ScSocketBase;
 #    endif
@@ -152,6 +161,8 @@ namespace OpenRCT2::Scripting
         uint32_t _lastHotReloadCheckTick{};
         HookEngine _hookEngine;
         ScriptExecutionInfo _execInfo;
+        ScriptProfiler _profiler;
+        PluginBytecodeCache _bytecodeCache;
         DukValue _sharedStorage;
 
         uint32_t _lastIntervalTimestamp{};
@@ -191,6 +202,10 @@ namespace OpenRCT2::Scripting
         {
             return _execInfo;
         }
+        ScriptProfiler& GetProfiler()
+        {
+            return _profiler;
+        }
         DukValue GetSharedStorage()
         {
             return _sharedStorage;
@@ -250,14 +265,20 @@ namespace OpenRCT2::Scripting
         void ProcessREPL();
         void RemoveCustomGameActions(const std::shared_ptr<Plugin>& plugin);
         [[nodiscard]] std::unique_ptr<GameActions::Result> DukToGameActionResult(const DukValue& d);
+        [[nodiscard]] DukValue GameActionArgsToDuk(const GameAction& action);
         [[nodiscard]] DukValue GameActionResultToDuk(
             const GameAction& action, const std::unique_ptr<GameActions::Result>& result);
+        void DefineLazyActionEventArgs(const DukValue& eventArgs, const LazyActionEventArgs* lazyArgs);
+        static duk_ret_t GetLazyActionEventArg(duk_context* ctx);
+        static duk_ret_t SetLazyActionEventArg(duk_context* ctx);
         static std::string_view ExpenditureTypeToString(ExpenditureType expenditureType);
         static ExpenditureType StringToExpenditureType(std::string_view expenditureType);
 
         void InitSharedStorage();
         void LoadSharedStorage();
 
+        void UpdatePluginBudgets();
+
         IntervalHandle AllocateHandle();
         void UpdateIntervals();
         void RemoveIntervals(const std::shared_ptr<Plugin>& plugin);
@@ -0,0 +1,235 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "ScriptProfiler.h"
+
+#    include "../core/String.hpp"
+#    include "HookEngine.h"
+#    include "Plugin.h"
+
+#    include <algorithm>
+
+using namespace OpenRCT2::Scripting;
+
+ScriptProfiler::~ScriptProfiler()
+{
+    StopSampling();
+}
+
+void ScriptProfiler::Enter(const std::shared_ptr<Plugin>& owner, const DukValue& func)
+{
+    Frame frame;
+    frame.Owner = owner;
+    frame.Start = std::chrono::high_resolution_clock::now();
+    if (_sampling)
+    {
+        // Only named while sampling as reading the function name is not free
+        frame.Name = GetFrameName(owner, func);
+        std::lock_guard<std::mutex> lock(_mutex);
+        _frames.push_back(std::move(frame));
+    }
+    else
+    {
+        _frames.push_back(std::move(frame));
+    }
+}
+
+void ScriptProfiler::Leave()
+{
+    auto& frame = _frames.back();
+    std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - frame.Start;
+
+    // Time spent in callbacks called from this one, for example the hooks of an action executed by the plugin,
+    // belongs to the plugins of those callbacks
+    auto selfTime = elapsed - frame.ChildTime;
+    if (frame.Owner != nullptr)
+    {
+        frame.Owner->GetFrameUsage().Time += selfTime;
+    }
+    _totalTime += selfTime;
+
+    if (_sampling)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _frames.pop_back();
+    }
+    else
+    {
+        _frames.pop_back();
+    }
+    if (!_frames.empty())
+    {
+        _frames.back().ChildTime += elapsed;
+    }
+}
+
+void ScriptProfiler::StartSampling(std::chrono::microseconds interval)
+{
+    StopSampling();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& frame : _frames)
+    {
+        if (frame.Name.empty())
+        {
+            frame.Name = GetFrameName(frame.Owner, {});
+        }
+    }
+    _samples.clear();
+    _numSamples = 0;
+    _sampling = true;
+    _samplingThread = std::thread([this, interval]() {
+        while (_sampling)
+        {
+            std::this_thread::sleep_for(interval);
+            TakeSample();
+        }
+    });
+}
+
+void ScriptProfiler::StopSampling()
+{
+    _sampling = false;
+    if (_samplingThread.joinable())
+    {
+        _samplingThread.join();
+    }
+}
+
+void ScriptProfiler::TakeSample()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _numSamples++;
+    if (_frames.empty())
+    {
+        return;
+    }
+
+    // Stacks are kept in the folded format flame graph tools read, outermost callback first
+    std::string stack;
+    for (const auto& frame : _frames)
+    {
+        if (!stack.empty())
+        {
+            stack.push_back(';');
+        }
+        stack += frame.Name;
+    }
+    _samples[stack]++;
+}
+
+std::vector<std::string> ScriptProfiler::FormatSampleReport(size_t maxEntries) const
+{
+    std::vector<std::pair<std::string, uint32_t>> samples;
+    uint32_t numSamples;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        samples.assign(_samples.begin(), _samples.end());
+        numSamples = _numSamples;
+    }
+    std::sort(samples.begin(), samples.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+
+    uint32_t numScriptSamples = 0;
+    for (const auto& sample : samples)
+    {
+        numScriptSamples += sample.second;
+    }
+
+    std::vector<std::string> lines;
+    lines.push_back(String::StdFormat(
+        "%u samples, %u in plugin callbacks (%.1f%%)", numSamples, numScriptSamples,
+        numSamples == 0 ? 0.0 : numScriptSamples * 100.0 / numSamples));
+    for (size_t i = 0; i < std::min(maxEntries, samples.size()); i++)
+    {
+        lines.push_back(String::StdFormat(
+            "%6.1f%% %s", samples[i].second * 100.0 / std::max(numSamples, 1u), samples[i].first.c_str()));
+    }
+    return lines;
+}
+
+std::vector<std::string> ScriptProfiler::FormatCounterReport(const std::vector<std::shared_ptr<Plugin>>& plugins)
+{
+    std::vector<std::string> lines;
+    lines.push_back(String::StdFormat("%-32s %10s %12s %10s", "Plugin / callback", "Calls", "Total (ms)", "Avg (us)"));
+
+    auto formatCounters = [&lines](const char* name, const PluginHookCounters& counters) {
+        if (counters.NumCalls != 0)
+        {
+            auto totalMs = counters.Time.count() * 1000.0;
+            lines.push_back(String::StdFormat(
+                "  %-30s %10zu %12.3f %10.1f", name, static_cast<size_t>(counters.NumCalls), totalMs,
+                totalMs * 1000.0 / counters.NumCalls));
+        }
+    };
+
+    for (const auto& plugin : plugins)
+    {
+        const auto& frameUsage = plugin->GetFrameUsage();
+        if (frameUsage.NumOverBudgetFrames != 0)
+        {
+            lines.push_back(String::StdFormat(
+                "%s (over budget for %u frames)", plugin->GetMetadata().Name.c_str(), frameUsage.NumOverBudgetFrames));
+        }
+        else
+        {
+            lines.push_back(plugin->GetMetadata().Name);
+        }
+
+        for (size_t i = 0; i < NUM_HOOK_TYPES; i++)
+        {
+            auto type = static_cast<HOOK_TYPE>(i);
+            formatCounters(std::string(GetHookName(type)).c_str(), plugin->GetHookCounters(type));
+        }
+        formatCounters("intervals", plugin->GetIntervalCounters());
+    }
+    return lines;
+}
+
+std::vector<std::string> ScriptProfiler::FormatStartupReport(const std::vector<std::shared_ptr<Plugin>>& plugins)
+{
+    auto getTotalTime = [](const Plugin& plugin) {
+        const auto& timings = plugin.GetLoadTimings();
+        return timings.Read + timings.Compile + timings.Run + timings.Start;
+    };
+
+    auto sortedPlugins = plugins;
+    std::sort(sortedPlugins.begin(), sortedPlugins.end(), [&getTotalTime](const auto& a, const auto& b) {
+        return getTotalTime(*a) > getTotalTime(*b);
+    });
+
+    std::vector<std::string> lines;
+    lines.push_back(String::StdFormat(
+        "%-32s %9s %9s %9s %9s %9s %s", "Plugin", "Total", "Read", "Compile", "Run", "Start", "(ms)"));
+    std::chrono::duration<double> totalTime{};
+    for (const auto& plugin : sortedPlugins)
+    {
+        const auto& timings = plugin->GetLoadTimings();
+        totalTime += getTotalTime(*plugin);
+        lines.push_back(String::StdFormat(
+            "%-32s %9.2f %9.2f %9.2f %9.2f %9.2f %s", plugin->GetMetadata().Name.c_str(),
+            getTotalTime(*plugin).count() * 1000.0, timings.Read.count() * 1000.0, timings.Compile.count() * 1000.0,
+            timings.Run.count() * 1000.0, timings.Start.count() * 1000.0,
+            timings.FromBytecodeCache ? "cached" : ""));
+    }
+    lines.push_back(String::StdFormat("%zu plugins in %.2f ms", plugins.size(), totalTime.count() * 1000.0));
+    return lines;
+}
+
+std::string ScriptProfiler::GetFrameName(const std::shared_ptr<Plugin>& owner, const DukValue& func)
+{
+    std::string name = owner != nullptr ? owner->GetMetadata().Name : "(console)";
+    auto funcName = func.type() == DukValue::Type::OBJECT && func.is_function() ? AsOrDefault<std::string>(func["name"]) : "";
+    name.push_back(':');
+    name += funcName.empty() ? "(anonymous)" : funcName;
+    return name;
+}
+
+#endif
@@ -0,0 +1,99 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "Duktape.hpp"
+
+#    include <atomic>
+#    include <chrono>
+#    include <memory>
+#    include <mutex>
+#    include <string>
+#    include <thread>
+#    include <unordered_map>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    class Plugin;
+
+    /**
+     * Keeps track of the plugin callbacks currently running so that the time spent in them can be attributed to
+     * the plugin they belong to. While sampling, a background thread periodically records that call stack to show
+     * which callbacks the time goes to.
+     */
+    class ScriptProfiler
+    {
+    private:
+        struct Frame
+        {
+            std::shared_ptr<Plugin> Owner;
+            std::string Name;
+            std::chrono::high_resolution_clock::time_point Start;
+            std::chrono::duration<double> ChildTime{};
+        };
+
+        std::vector<Frame> _frames;
+        std::chrono::duration<double> _totalTime{};
+
+        // Guards the frames while sampling, and the samples
+        mutable std::mutex _mutex;
+        std::atomic<bool> _sampling{};
+        std::thread _samplingThread;
+        std::unordered_map<std::string, uint32_t> _samples;
+        uint32_t _numSamples{};
+
+    public:
+        ScriptProfiler() = default;
+        ScriptProfiler(const ScriptProfiler&) = delete;
+        ~ScriptProfiler();
+
+        void Enter(const std::shared_ptr<Plugin>& owner, const DukValue& func);
+        void Leave();
+
+        /**
+         * Gets the time spent in plugin callbacks since the script engine started, nested calls are only counted once.
+         */
+        std::chrono::duration<double> GetTotalTime() const
+        {
+            return _totalTime;
+        }
+
+        bool IsSampling() const
+        {
+            return _sampling;
+        }
+        void StartSampling(std::chrono::microseconds interval);
+        void StopSampling();
+
+        /**
+         * Lists the sampled call stacks that were seen most often, outermost callback first.
+         */
+        std::vector<std::string> FormatSampleReport(size_t maxEntries) const;
+
+        /**
+         * Lists the calls and time of each type of callback of each plugin.
+         */
+        static std::vector<std::string> FormatCounterReport(const std::vector<std::shared_ptr<Plugin>>& plugins);
+
+        /**
+         * Lists how long each plugin took to read, compile, run and start, slowest first.
+         */
+        static std::vector<std::string> FormatStartupReport(const std::vector<std::shared_ptr<Plugin>>& plugins);
+
+    private:
+        void TakeSample();
+        static std::string GetFrameName(const std::shared_ptr<Plugin>& owner, const DukValue& func);
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
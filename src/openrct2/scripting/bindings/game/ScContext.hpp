@@ -204,7 +204,7 @@ namespace OpenRCT2::Scripting
             return 1;
         }
 
-        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback)
+        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback, const DukValue& options)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
             auto ctx = scriptEngine.GetContext();
@@ -226,7 +226,28 @@ namespace OpenRCT2::Scripting
                 duk_error(ctx, DUK_ERR_ERROR, "Not in a plugin context");
             }
 
-            auto cookie = _hookEngine.Subscribe(hookType, owner, callback);
+            std::vector<std::string> actionFilter;
+            if (options.type() == DukValue::Type::OBJECT)
+            {
+                auto dukActions = options["actions"];
+                if (dukActions.is_array())
+                {
+                    if (hookType != HOOK_TYPE::ACTION_QUERY && hookType != HOOK_TYPE::ACTION_EXECUTE)
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Actions can only be filtered for action hooks");
+                    }
+                    for (const auto& dukAction : dukActions.as_array())
+                    {
+                        if (dukAction.type() != DukValue::Type::STRING)
+                        {
+                            duk_error(ctx, DUK_ERR_ERROR, "Expected action names");
+                        }
+                        actionFilter.push_back(dukAction.as_string());
+                    }
+                }
+            }
+
+            auto cookie = _hookEngine.Subscribe(hookType, owner, callback, std::move(actionFilter));
             return std::make_shared<ScDisposable>([this, hookType, cookie]() { _hookEngine.Unsubscribe(hookType, cookie); });
         }
 
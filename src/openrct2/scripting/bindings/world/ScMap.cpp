@@ -12,6 +12,7 @@
 #    include "ScMap.hpp"
 
 #    include "../../../common.h"
+#    include "../../../peep/Peep.h"
 #    include "../../../ride/Ride.h"
 #    include "../../../ride/TrainManager.h"
 #    include "../../../world/Balloon.h"
@@ -31,6 +32,8 @@
 #    include "../ride/ScRide.hpp"
 #    include "../world/ScTile.hpp"
 
+#    include <limits>
+
 namespace OpenRCT2::Scripting
 {
     ScMap::ScMap(duk_context* ctx)
@@ -96,14 +99,13 @@ namespace OpenRCT2::Scripting
         return DukValue::take_from_stack(_context);
     }
 
-    std::vector<DukValue> ScMap::getAllEntities(const std::string& type) const
+    template<typename TFunc> static bool ForEachEntityOfType(const std::string& type, TFunc func)
     {
-        std::vector<DukValue> result;
         if (type == "balloon")
         {
             for (auto sprite : EntityList<Balloon>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->sprite_index)));
+                func(sprite);
             }
         }
         else if (type == "car")
@@ -113,7 +115,11 @@ namespace OpenRCT2::Scripting
                 for (auto carId = trainHead->sprite_index; carId != SPRITE_INDEX_NULL;)
                 {
                     auto car = GetEntity<Vehicle>(carId);
-                    result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScVehicle>(carId)));
+                    if (car == nullptr)
+                    {
+                        break;
+                    }
+                    func(car);
                     carId = car->next_vehicle_on_train;
                 }
             }
@@ -122,49 +128,205 @@ namespace OpenRCT2::Scripting
         {
             for (auto sprite : EntityList<Litter>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScLitter>(sprite->sprite_index)));
+                func(sprite);
             }
         }
         else if (type == "duck")
         {
             for (auto sprite : EntityList<Duck>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->sprite_index)));
+                func(sprite);
             }
         }
         else if (type == "peep")
         {
             for (auto sprite : EntityList<Guest>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScGuest>(sprite->sprite_index)));
+                func(sprite);
             }
             for (auto sprite : EntityList<Staff>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScStaff>(sprite->sprite_index)));
+                func(sprite);
             }
         }
         else if (type == "guest")
         {
             for (auto sprite : EntityList<Guest>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScGuest>(sprite->sprite_index)));
+                func(sprite);
             }
         }
         else if (type == "staff")
         {
             for (auto sprite : EntityList<Staff>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScStaff>(sprite->sprite_index)));
+                func(sprite);
             }
         }
         else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    std::vector<DukValue> ScMap::getAllEntities(const std::string& type) const
+    {
+        std::vector<DukValue> result;
+        if (!ForEachEntityOfType(type, [this, &result](const EntityBase* entity) {
+                result.push_back(GetEntityAsDukValue(entity));
+            }))
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+        }
+        return result;
+    }
+
+    DukValue ScMap::getAllEntityIds(const std::string& type) const
+    {
+        _queryEntities.clear();
+        if (!ForEachEntityOfType(type, [this](const EntityBase* entity) { _queryEntities.push_back(entity); }))
         {
             duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
         }
+        return CreateInt32Array(_context, _queryEntities.size(), [this](int32_t* data) {
+            for (size_t i = 0; i < _queryEntities.size(); i++)
+            {
+                data[i] = _queryEntities[i]->sprite_index;
+            }
+        });
+    }
+
+    template<typename T, auto TMember> static int32_t GetEntityQueryField(const EntityBase& entity)
+    {
+        auto typedEntity = entity.As<T>();
+        return typedEntity != nullptr ? static_cast<int32_t>(typedEntity->*TMember) : 0;
+    }
+
+    struct EntityQueryField
+    {
+        const char* Name;
+        int32_t (*Get)(const EntityBase& entity);
+    };
+
+    // Fields that do not apply to an entity read as 0
+    // clang-format off
+    static constexpr const EntityQueryField EntityQueryFields[] = {
+        { "id", [](const EntityBase& entity) -> int32_t { return entity.sprite_index; } },
+        { "x", [](const EntityBase& entity) -> int32_t { return entity.x; } },
+        { "y", [](const EntityBase& entity) -> int32_t { return entity.y; } },
+        { "z", [](const EntityBase& entity) -> int32_t { return entity.z; } },
+        { "energy", GetEntityQueryField<Peep, &Peep::Energy> },
+        { "happiness", GetEntityQueryField<Guest, &Guest::Happiness> },
+        { "nausea", GetEntityQueryField<Guest, &Guest::Nausea> },
+        { "hunger", GetEntityQueryField<Guest, &Guest::Hunger> },
+        { "thirst", GetEntityQueryField<Guest, &Guest::Thirst> },
+        { "toilet", GetEntityQueryField<Guest, &Guest::Toilet> },
+        { "cash", GetEntityQueryField<Guest, &Guest::CashInPocket> },
+        { "isInPark", [](const EntityBase& entity) -> int32_t {
+            auto guest = entity.As<Guest>();
+            return guest != nullptr && !guest->OutsideOfPark ? 1 : 0;
+        } },
+    };
+    // clang-format on
+
+    struct EntityQueryRange
+    {
+        const EntityQueryField* Field;
+        int32_t Min;
+        int32_t Max;
+    };
+
+    static const EntityQueryField* FindEntityQueryField(duk_context* ctx, std::string_view name)
+    {
+        for (const auto& field : EntityQueryFields)
+        {
+            if (name == field.Name)
+            {
+                return &field;
+            }
+        }
+        duk_error(ctx, DUK_ERR_ERROR, "Unknown entity field '%s'.", std::string(name).c_str());
+        return nullptr;
+    }
 
+    /**
+     * Reads a filter such as { happiness: { max: 50 }, isInPark: 1 }, every field must be within its range.
+     */
+    static std::vector<EntityQueryRange> GetEntityQueryRanges(duk_context* ctx, const DukValue& filter)
+    {
+        std::vector<EntityQueryRange> result;
+        if (filter.type() != DukValue::Type::OBJECT)
+        {
+            return result;
+        }
+
+        filter.push();
+        duk_enum(ctx, -1, 0);
+        while (duk_next(ctx, -1, 1))
+        {
+            auto value = DukValue::take_from_stack(ctx, -1);
+            auto key = DukValue::take_from_stack(ctx, -1);
+            auto field = FindEntityQueryField(ctx, key.as_string());
+            if (value.type() == DukValue::Type::NUMBER)
+            {
+                result.push_back({ field, value.as_int(), value.as_int() });
+            }
+            else
+            {
+                result.push_back({ field, AsOrDefault(value["min"], std::numeric_limits<int32_t>::min()),
+                                   AsOrDefault(value["max"], std::numeric_limits<int32_t>::max()) });
+            }
+        }
+        duk_pop_2(ctx);
         return result;
     }
 
+    DukValue ScMap::queryEntities(const std::string& type, const std::vector<std::string>& fields, const DukValue& filter) const
+    {
+        std::vector<const EntityQueryField*> columns;
+        for (const auto& name : fields)
+        {
+            columns.push_back(FindEntityQueryField(_context, name));
+        }
+        auto ranges = GetEntityQueryRanges(_context, filter);
+
+        _queryEntities.clear();
+        auto isValidType = ForEachEntityOfType(type, [this, &ranges](const EntityBase* entity) {
+            for (const auto& range : ranges)
+            {
+                auto value = range.Field->Get(*entity);
+                if (value < range.Min || value > range.Max)
+                {
+                    return;
+                }
+            }
+            _queryEntities.push_back(entity);
+        });
+        if (!isValidType)
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+        }
+
+        DukObject result(_context);
+        result.Set("count", static_cast<int32_t>(_queryEntities.size()));
+        for (const auto* column : columns)
+        {
+            result.Set(column->Name, CreateInt32Array(_context, _queryEntities.size(), [this, column](int32_t* data) {
+                for (size_t i = 0; i < _queryEntities.size(); i++)
+                {
+                    data[i] = column->Get(*_queryEntities[i]);
+                }
+            }));
+        }
+        return result.Take();
+    }
+
+    DukValue ScMap::queryTileElements(const DukValue& type, const std::vector<std::string>& fields) const
+    {
+        return ScTile::QueryElements(_context, { 0, 0 }, { gMapSize - 1, gMapSize - 1 }, type, fields);
+    }
+
     template<typename TEntityType, typename TScriptType>
     DukValue createEntityType(duk_context* ctx, const DukValue& initializer)
     {
@@ -250,6 +412,9 @@ namespace OpenRCT2::Scripting
         dukglue_register_method(ctx, &ScMap::getTile, "getTile");
         dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
         dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+        dukglue_register_method(ctx, &ScMap::getAllEntityIds, "getAllEntityIds");
+        dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
+        dukglue_register_method(ctx, &ScMap::queryTileElements, "queryTileElements");
         dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
     }
 
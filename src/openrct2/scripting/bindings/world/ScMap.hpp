@@ -23,6 +23,9 @@ namespace OpenRCT2::Scripting
     private:
         duk_context* _context;
 
+        // Reused between queries so that scanning entities every few ticks does not allocate
+        mutable std::vector<const EntityBase*> _queryEntities;
+
     public:
         ScMap(duk_context* ctx);
 
@@ -42,6 +45,12 @@ namespace OpenRCT2::Scripting
 
         std::vector<DukValue> getAllEntities(const std::string& type) const;
 
+        DukValue getAllEntityIds(const std::string& type) const;
+
+        DukValue queryEntities(const std::string& type, const std::vector<std::string>& fields, const DukValue& filter) const;
+
+        DukValue queryTileElements(const DukValue& type, const std::vector<std::string>& fields) const;
+
         DukValue createEntity(const std::string& type, const DukValue& initializer);
 
         static void Register(duk_context* ctx);
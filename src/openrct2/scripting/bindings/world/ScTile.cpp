@@ -23,8 +23,10 @@
 #    include "../../ScriptEngine.h"
 #    include "ScTileElement.hpp"
 
+#    include <algorithm>
 #    include <cstdio>
 #    include <cstring>
+#    include <optional>
 #    include <utility>
 
 namespace OpenRCT2::Scripting
@@ -200,6 +202,118 @@ namespace OpenRCT2::Scripting
         }
     }
 
+    DukValue ScTile::queryElements(const DukValue& type, const std::vector<std::string>& fields) const
+    {
+        auto pos = TileCoordsXY(_coords);
+        return QueryElements(GetDukContext(), pos, pos, type, fields);
+    }
+
+    struct TileElementQueryItem
+    {
+        TileCoordsXY Pos;
+        int32_t Index;
+        const TileElement* Element;
+    };
+
+    struct TileElementQueryField
+    {
+        const char* Name;
+        int32_t (*Get)(const TileElementQueryItem& item);
+    };
+
+    // clang-format off
+    static constexpr const TileElementQueryField TileElementQueryFields[] = {
+        { "x", [](const TileElementQueryItem& item) -> int32_t { return item.Pos.x; } },
+        { "y", [](const TileElementQueryItem& item) -> int32_t { return item.Pos.y; } },
+        { "index", [](const TileElementQueryItem& item) -> int32_t { return item.Index; } },
+        { "baseHeight", [](const TileElementQueryItem& item) -> int32_t { return item.Element->base_height; } },
+        { "clearanceHeight", [](const TileElementQueryItem& item) -> int32_t { return item.Element->clearance_height; } },
+        { "direction", [](const TileElementQueryItem& item) -> int32_t { return item.Element->GetDirection(); } },
+        { "occupiedQuadrants", [](const TileElementQueryItem& item) -> int32_t {
+            return item.Element->GetOccupiedQuadrants();
+        } },
+        { "isGhost", [](const TileElementQueryItem& item) -> int32_t { return item.Element->IsGhost() ? 1 : 0; } },
+    };
+
+    static constexpr const std::pair<const char*, uint8_t> TileElementQueryTypes[] = {
+        { "surface", TILE_ELEMENT_TYPE_SURFACE },
+        { "footpath", TILE_ELEMENT_TYPE_PATH },
+        { "track", TILE_ELEMENT_TYPE_TRACK },
+        { "small_scenery", TILE_ELEMENT_TYPE_SMALL_SCENERY },
+        { "entrance", TILE_ELEMENT_TYPE_ENTRANCE },
+        { "wall", TILE_ELEMENT_TYPE_WALL },
+        { "large_scenery", TILE_ELEMENT_TYPE_LARGE_SCENERY },
+        { "banner", TILE_ELEMENT_TYPE_BANNER },
+    };
+    // clang-format on
+
+    DukValue ScTile::QueryElements(
+        duk_context* ctx, const TileCoordsXY& min, const TileCoordsXY& max, const DukValue& type,
+        const std::vector<std::string>& fields)
+    {
+        std::vector<const TileElementQueryField*> columns;
+        for (const auto& name : fields)
+        {
+            auto it = std::find_if(
+                std::begin(TileElementQueryFields), std::end(TileElementQueryFields),
+                [&name](const TileElementQueryField& field) { return name == field.Name; });
+            if (it == std::end(TileElementQueryFields))
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Unknown tile element field '%s'.", name.c_str());
+            }
+            columns.push_back(&*it);
+        }
+
+        std::optional<uint8_t> elementType;
+        if (type.type() == DukValue::Type::STRING)
+        {
+            auto typeName = type.as_string();
+            auto it = std::find_if(
+                std::begin(TileElementQueryTypes), std::end(TileElementQueryTypes),
+                [&typeName](const std::pair<const char*, uint8_t>& item) { return typeName == item.first; });
+            if (it == std::end(TileElementQueryTypes))
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Invalid tile element type.");
+            }
+            elementType = it->second;
+        }
+
+        std::vector<TileElementQueryItem> items;
+        for (int32_t y = std::max(0, min.y); y <= std::min(max.y, MAXIMUM_MAP_SIZE_TECHNICAL - 1); y++)
+        {
+            for (int32_t x = std::max(0, min.x); x <= std::min(max.x, MAXIMUM_MAP_SIZE_TECHNICAL - 1); x++)
+            {
+                auto element = map_get_first_element_at(TileCoordsXY(x, y).ToCoordsXY());
+                if (element == nullptr)
+                {
+                    continue;
+                }
+                int32_t index = 0;
+                do
+                {
+                    if (!elementType.has_value() || element->GetType() == *elementType)
+                    {
+                        items.push_back({ { x, y }, index, element });
+                    }
+                    index++;
+                } while (!(element++)->IsLastForTile());
+            }
+        }
+
+        DukObject result(ctx);
+        result.Set("count", static_cast<int32_t>(items.size()));
+        for (const auto* column : columns)
+        {
+            result.Set(column->Name, CreateInt32Array(ctx, items.size(), [&items, column](int32_t* data) {
+                for (size_t i = 0; i < items.size(); i++)
+                {
+                    data[i] = column->Get(items[i]);
+                }
+            }));
+        }
+        return result.Take();
+    }
+
     TileElement* ScTile::GetFirstElement() const
     {
         return map_get_first_element_at(_coords);
@@ -236,6 +350,7 @@ namespace OpenRCT2::Scripting
         dukglue_register_method(ctx, &ScTile::getElement, "getElement");
         dukglue_register_method(ctx, &ScTile::insertElement, "insertElement");
         dukglue_register_method(ctx, &ScTile::removeElement, "removeElement");
+        dukglue_register_method(ctx, &ScTile::queryElements, "queryElements");
     }
 
 } // namespace OpenRCT2::Scripting
@@ -17,6 +17,7 @@
 
 #    include <cstdio>
 #    include <cstring>
+#    include <string>
 #    include <utility>
 #    include <vector>
 
@@ -47,6 +48,8 @@ namespace OpenRCT2::Scripting
 
         void removeElement(uint32_t index);
 
+        DukValue queryElements(const DukValue& type, const std::vector<std::string>& fields) const;
+
         TileElement* GetFirstElement() const;
 
         static size_t GetNumElements(const TileElement* first);
@@ -54,6 +57,14 @@ namespace OpenRCT2::Scripting
         duk_context* GetDukContext() const;
 
     public:
+        /**
+         * Reads the given fields of every element of the given type within the range of tiles into one Int32Array per
+         * field, without creating an object for each element. A type of null includes every element.
+         */
+        static DukValue QueryElements(
+            duk_context* ctx, const TileCoordsXY& min, const TileCoordsXY& max, const DukValue& type,
+            const std::vector<std::string>& fields);
+
         static void Register(duk_context* ctx);
     };
 } // namespace OpenRCT2::Scripting
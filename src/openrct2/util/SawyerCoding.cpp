@@ -19,6 +19,9 @@
 
 static size_t decode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length, size_t dstSize);
+static size_t decode_chunk_rle_range(
+    const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length, size_t offset, size_t rangeLength);
+static void decode_sc4_range(uint8_t* dst, size_t offset, size_t length);
 
 static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
@@ -109,17 +112,26 @@ size_t sawyercoding_decode_sc4(const uint8_t* src, uint8_t* dst, size_t length,
     size_t decodedLength = decode_chunk_rle_with_size(src, dst, length - 4, bufferLength);
 
     // Decode
-    for (size_t i = 0x60018; i <= std::min(decodedLength - 1, static_cast<size_t>(0x1F8353)); i++)
-        dst[i] = dst[i] ^ 0x9C;
-
-    for (size_t i = 0x60018; i <= std::min(decodedLength - 1, static_cast<size_t>(0x1F8350)); i += 4)
-    {
-        dst[i + 1] = Numerics::ror8(dst[i + 1], 3);
+    decode_sc4_range(dst, 0, decodedLength);
+    return decodedLength;
+}
 
-        uint32_t* code = reinterpret_cast<uint32_t*>(&dst[i]);
-        *code = Numerics::rol32(*code, 9);
-    }
+/**
+ * Decodes only the bytes from offset to offset + rangeLength of an SV4 file into dst, nothing before or after
+ * the range is written. Returns the number of bytes written.
+ */
+size_t sawyercoding_decode_sv4_range(const uint8_t* src, uint8_t* dst, size_t length, size_t offset, size_t rangeLength)
+{
+    return decode_chunk_rle_range(src, dst, length - 4, offset, rangeLength);
+}
 
+/**
+ * As above for SC4 files, offset and rangeLength must be multiples of 4.
+ */
+size_t sawyercoding_decode_sc4_range(const uint8_t* src, uint8_t* dst, size_t length, size_t offset, size_t rangeLength)
+{
+    size_t decodedLength = decode_chunk_rle_range(src, dst, length - 4, offset, rangeLength);
+    decode_sc4_range(dst, offset, decodedLength);
     return decodedLength;
 }
 
@@ -255,6 +267,74 @@ static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst
     return dst - dst_buffer;
 }
 
+/**
+ * Like decode_chunk_rle but only writes the decoded bytes from offset to offset + rangeLength, the rest of the
+ * stream is only walked. Stops as soon as the end of the range is reached.
+ */
+static size_t decode_chunk_rle_range(
+    const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length, size_t offset, size_t rangeLength)
+{
+    size_t rangeEnd = offset + rangeLength;
+    size_t position = 0;
+    for (size_t i = 0; i < length && position < rangeEnd; i++)
+    {
+        uint8_t rleCodeByte = src_buffer[i];
+        size_t count;
+        const uint8_t* literal = nullptr;
+        if (rleCodeByte & 128)
+        {
+            i++;
+            if (i >= length)
+                break;
+            count = 257 - rleCodeByte;
+        }
+        else
+        {
+            count = rleCodeByte + 1;
+            if (i + count >= length)
+                break;
+            literal = src_buffer + i + 1;
+        }
+
+        size_t copyStart = std::max(position, offset);
+        size_t copyEnd = std::min(position + count, rangeEnd);
+        if (copyStart < copyEnd)
+        {
+            uint8_t* dst = dst_buffer + (copyStart - offset);
+            if (literal != nullptr)
+                std::memcpy(dst, literal + (copyStart - position), copyEnd - copyStart);
+            else
+                std::fill_n(dst, copyEnd - copyStart, src_buffer[i]);
+        }
+
+        position += count;
+        if (literal != nullptr)
+            i += count;
+    }
+    return position > offset ? std::min(position, rangeEnd) - offset : 0;
+}
+
+/**
+ * Undoes the scrambling of SC4 files, dst holds the decoded bytes from offset to offset + length.
+ */
+static void decode_sc4_range(uint8_t* dst, size_t offset, size_t length)
+{
+    if (length == 0)
+        return;
+
+    size_t last = offset + length - 1;
+    for (size_t i = std::max<size_t>(0x60018, offset); i <= std::min(last, static_cast<size_t>(0x1F8353)); i++)
+        dst[i - offset] = dst[i - offset] ^ 0x9C;
+
+    for (size_t i = std::max<size_t>(0x60018, offset); i <= std::min(last, static_cast<size_t>(0x1F8350)); i += 4)
+    {
+        dst[i - offset + 1] = Numerics::ror8(dst[i - offset + 1], 3);
+
+        uint32_t* code = reinterpret_cast<uint32_t*>(&dst[i - offset]);
+        *code = Numerics::rol32(*code, 9);
+    }
+}
+
 #pragma endregion
 
 #pragma region Encoding
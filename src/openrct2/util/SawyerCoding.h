@@ -47,6 +47,8 @@ uint32_t sawyercoding_calculate_checksum(const uint8_t* buffer, size_t length);
 size_t sawyercoding_write_chunk_buffer(uint8_t* dst_file, const uint8_t* src_buffer, sawyercoding_chunk_header chunkHeader);
 size_t sawyercoding_decode_sv4(const uint8_t* src, uint8_t* dst, size_t length, size_t bufferLength);
 size_t sawyercoding_decode_sc4(const uint8_t* src, uint8_t* dst, size_t length, size_t bufferLength);
+size_t sawyercoding_decode_sv4_range(const uint8_t* src, uint8_t* dst, size_t length, size_t offset, size_t rangeLength);
+size_t sawyercoding_decode_sc4_range(const uint8_t* src, uint8_t* dst, size_t length, size_t offset, size_t rangeLength);
 size_t sawyercoding_encode_sv4(const uint8_t* src, uint8_t* dst, size_t length);
 size_t sawyercoding_decode_td6(const uint8_t* src, uint8_t* dst, size_t length);
 size_t sawyercoding_encode_td6(const uint8_t* src, uint8_t* dst, size_t length);
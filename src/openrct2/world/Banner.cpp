@@ -140,6 +140,16 @@ void banner_init()
     _banners.clear();
 }
 
+const std::vector<Banner>& GetBanners()
+{
+    return _banners;
+}
+
+void SetBanners(const std::vector<Banner>& banners)
+{
+    _banners = banners;
+}
+
 TileElement* banner_get_tile_element(BannerIndex bannerIndex)
 {
     auto banner = GetBanner(bannerIndex);
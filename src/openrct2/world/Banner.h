@@ -14,6 +14,7 @@
 #include "Location.hpp"
 
 #include <string>
+#include <vector>
 
 class Formatter;
 struct TileElement;
@@ -70,4 +71,6 @@ Banner* CreateBanner();
 void DeleteBanner(BannerIndex id);
 void TrimBanners();
 size_t GetNumBanners();
+const std::vector<Banner>& GetBanners();
+void SetBanners(const std::vector<Banner>& banners);
 bool HasReachedBannerLimit();
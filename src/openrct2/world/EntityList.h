@@ -14,7 +14,9 @@
 #include "Entity.h"
 #include "EntityBase.h"
 #include "Location.hpp"
+#include "Map.h"
 
+#include <algorithm>
 #include <list>
 #include <vector>
 
@@ -174,3 +176,41 @@ public:
         return EntityListIterator_t(std::cend(vec), std::cend(vec));
     }
 };
+
+/**
+ * Visits the entities of the given type that may be within the range of the map. When the range covers fewer tiles
+ * than there are entities of the type, only the entities on those tiles are visited, otherwise all of them are. The
+ * function has to check whatever it needs of each entity itself.
+ */
+template<typename T, typename TFunc> void ForEachEntityInMapRange(const MapRange& range, TFunc&& func)
+{
+    auto left = std::max(range.GetLeft(), 0) / COORDS_XY_STEP;
+    auto top = std::max(range.GetTop(), 0) / COORDS_XY_STEP;
+    auto right = std::min(range.GetRight(), MAXIMUM_MAP_SIZE_BIG - 1) / COORDS_XY_STEP;
+    auto bottom = std::min(range.GetBottom(), MAXIMUM_MAP_SIZE_BIG - 1) / COORDS_XY_STEP;
+    if (left > right || top > bottom)
+    {
+        return;
+    }
+
+    auto numTiles = static_cast<size_t>(right - left + 1) * (bottom - top + 1);
+    if (numTiles >= GetEntityListCount(T::cEntityType))
+    {
+        for (auto* entity : EntityList<T>())
+        {
+            func(entity);
+        }
+        return;
+    }
+
+    for (auto x = left; x <= right; x++)
+    {
+        for (auto y = top; y <= bottom; y++)
+        {
+            for (auto* entity : EntityTileList<T>(TileCoordsXY{ x, y }.ToCoordsXY()))
+            {
+                func(entity);
+            }
+        }
+    }
+}
@@ -57,8 +57,10 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <bitset>
 #include <iterator>
 #include <memory>
+#include <utility>
 
 using namespace OpenRCT2;
 
@@ -120,6 +122,10 @@ static size_t _tileElementsInUseStash;
 static int32_t _mapSizeStash;
 static int32_t _currentRotationStash;
 
+// Tiles changed since they were last taken, the mask prevents a tile from being listed more than once
+static std::bitset<MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _changedTileMask;
+static std::vector<TileCoordsXY> _changedTiles;
+
 void StashMap()
 {
     _tileIndexStash = std::move(_tileIndex);
@@ -150,6 +156,21 @@ void SetTileElements(std::vector<TileElement>&& tileElements)
     _tileElementsInUse = _tileElements.size();
 }
 
+/**
+ * Copies the tile elements in place, the existing allocation is reused when it is large enough.
+ */
+void SetTileElements(const std::vector<TileElement>& tileElements, size_t numElementsInUse)
+{
+    _tileElements.assign(tileElements.begin(), tileElements.end());
+    _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data());
+    _tileElementsInUse = numElementsInUse;
+}
+
+size_t GetNumTileElementsInUse()
+{
+    return _tileElementsInUse;
+}
+
 static void ReorganiseTileElements(size_t capacity)
 {
     context_setcurrentcursor(CursorID::ZZZ);
@@ -1196,6 +1217,7 @@ static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNew
 TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type)
 {
     const auto& tileLoc = TileCoordsXYZ(loc);
+    map_mark_tile_changed(loc);
 
     auto numElementsOnTileOld = CountElementsOnTile(loc);
     auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
@@ -1802,6 +1824,8 @@ static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int
     if (gOpenRCT2Headless)
         return;
 
+    map_mark_tile_changed({ x, y });
+
     int32_t x1, y1, x2, y2;
 
     x += 16;
@@ -1861,6 +1885,14 @@ void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs)
 {
     int32_t x0, y0, x1, y1, left, right, top, bottom;
 
+    for (int32_t y = mins.y; y <= maxs.y; y += COORDS_XY_STEP)
+    {
+        for (int32_t x = mins.x; x <= maxs.x; x += COORDS_XY_STEP)
+        {
+            map_mark_tile_changed({ x, y });
+        }
+    }
+
     x0 = mins.x + 16;
     y0 = mins.y + 16;
 
@@ -1877,6 +1909,41 @@ void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs)
     viewports_invalidate(left, top, right, bottom);
 }
 
+/**
+ * Records that the elements of the tile have changed, for views of the map that are updated incrementally.
+ */
+void map_mark_tile_changed(const CoordsXY& tilePos)
+{
+    if (gOpenRCT2Headless)
+        return;
+
+    auto tileCoords = TileCoordsXY(tilePos);
+    if (tileCoords.x < 0 || tileCoords.y < 0 || tileCoords.x >= MAXIMUM_MAP_SIZE_TECHNICAL
+        || tileCoords.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        return;
+    }
+
+    auto index = static_cast<size_t>(tileCoords.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileCoords.x);
+    if (!_changedTileMask[index])
+    {
+        _changedTileMask[index] = true;
+        _changedTiles.push_back(tileCoords);
+    }
+}
+
+/**
+ * Gets the tiles that have changed since this was last called, each tile is listed once.
+ */
+std::vector<TileCoordsXY> map_take_changed_tiles()
+{
+    for (const auto& tileCoords : _changedTiles)
+    {
+        _changedTileMask[tileCoords.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileCoords.x] = false;
+    }
+    return std::exchange(_changedTiles, {});
+}
+
 int32_t map_get_tile_side(const CoordsXY& mapPos)
 {
     int32_t subMapX = mapPos.x & (32 - 1);
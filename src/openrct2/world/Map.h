@@ -184,6 +184,8 @@ public:
 void ReorganiseTileElements();
 const std::vector<TileElement>& GetTileElements();
 void SetTileElements(std::vector<TileElement>&& tileElements);
+void SetTileElements(const std::vector<TileElement>& tileElements, size_t numElementsInUse);
+size_t GetNumTileElementsInUse();
 void StashMap();
 void UnstashMap();
 
@@ -266,6 +268,8 @@ void map_invalidate_tile_zoom0(const CoordsXYRangedZ& tilePos);
 void map_invalidate_tile_full(const CoordsXY& tilePos);
 void map_invalidate_element(const CoordsXY& elementPos, TileElement* tileElement);
 void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs);
+void map_mark_tile_changed(const CoordsXY& tilePos);
+std::vector<TileCoordsXY> map_take_changed_tiles();
 
 int32_t map_get_tile_side(const CoordsXY& mapPos);
 int32_t map_get_tile_quadrant(const CoordsXY& mapPos);
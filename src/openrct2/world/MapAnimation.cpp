@@ -602,6 +602,11 @@ const std::vector<MapAnimation>& GetMapAnimations()
     return _mapAnimations;
 }
 
+void SetMapAnimations(const std::vector<MapAnimation>& animations)
+{
+    _mapAnimations = animations;
+}
+
 static void ClearMapAnimations()
 {
     _mapAnimations.clear();
@@ -42,4 +42,5 @@ enum
 void map_animation_create(int32_t type, const CoordsXYZ& loc);
 void map_animation_invalidate_all();
 const std::vector<MapAnimation>& GetMapAnimations();
+void SetMapAnimations(const std::vector<MapAnimation>& animations);
 void AutoCreateMapAnimations();
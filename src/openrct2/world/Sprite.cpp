@@ -257,6 +257,47 @@ void reset_sprite_list()
 
 static void SpriteSpatialInsert(EntityBase* sprite, const CoordsXY& newLoc);
 
+const rct_sprite* GetEntityStorage()
+{
+    return _spriteList;
+}
+
+void SetEntityStorage(const rct_sprite* sprites)
+{
+    for (int32_t i = 0; i < MAX_ENTITIES; ++i)
+    {
+        auto* spr = GetEntity(i);
+        if (spr != nullptr)
+        {
+            FreeEntity(*spr);
+        }
+    }
+
+    std::copy(sprites, sprites + MAX_ENTITIES, std::begin(_spriteList));
+
+    // Rebuild the lists in the same order CreateEntity maintains them
+    ResetEntityLists();
+    _freeIdList.clear();
+    for (int32_t i = MAX_ENTITIES - 1; i >= 0; --i)
+    {
+        const auto& entity = _spriteList[i].base;
+        if (entity.Type == EntityType::Null)
+        {
+            _freeIdList.push_back(i);
+        }
+    }
+    for (int32_t i = 0; i < MAX_ENTITIES; ++i)
+    {
+        const auto& entity = _spriteList[i].base;
+        if (entity.Type != EntityType::Null)
+        {
+            gEntityLists[EnumValue(entity.Type)].push_back(i);
+        }
+    }
+    reset_sprite_spatial_index();
+    EntityTweener::Get().Reset();
+}
+
 /**
  *
  *  rct2: 0x0069EBE4
@@ -42,6 +42,13 @@ struct rct_sprite_checksum
 
 void reset_sprite_list();
 void reset_sprite_spatial_index();
+
+/**
+ * Raw access to the entity storage, used by the game state rollback. Peep names are heap allocated and owned by the
+ * live entities, copies must clear them and SetEntityStorage expects every name to be null.
+ */
+const rct_sprite* GetEntityStorage();
+void SetEntityStorage(const rct_sprite* sprites);
 void sprite_misc_update_all();
 void sprite_set_coordinates(const CoordsXYZ& spritePos, EntityBase* sprite);
 void sprite_remove(EntityBase* sprite);
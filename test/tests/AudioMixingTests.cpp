@@ -0,0 +1,96 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/audio/AudioMixing.h>
+#include <vector>
+
+using namespace OpenRCT2::Audio;
+
+TEST(AudioMixingTest, s16_round_trip)
+{
+    // Enough samples to cover both the vectorised loop and the remainder
+    std::vector<int16_t> source;
+    for (int32_t i = -32768; i <= 32767; i += 997)
+    {
+        source.push_back(static_cast<int16_t>(i));
+    }
+    source.push_back(32767);
+
+    std::vector<float> samples(source.size());
+    Mixing::ConvertS16ToFloat(source.data(), samples.data(), source.size());
+    ASSERT_FLOAT_EQ(samples.front(), -1.0f);
+
+    std::vector<int16_t> output(source.size());
+    Mixing::ConvertFloatToS16(samples.data(), output.data(), samples.size());
+    ASSERT_EQ(source, output);
+}
+
+TEST(AudioMixingTest, s16_clips)
+{
+    std::vector<float> samples = { 2.0f, -2.0f, 1.0f, -1.0f, 0.5f, 0.0f, 100.0f, -100.0f, 1.5f };
+    std::vector<int16_t> output(samples.size());
+    Mixing::ConvertFloatToS16(samples.data(), output.data(), samples.size());
+    std::vector<int16_t> expected = { 32767, -32768, 32767, -32768, 16384, 0, 32767, -32768, 32767 };
+    ASSERT_EQ(output, expected);
+}
+
+TEST(AudioMixingTest, u8_round_trip)
+{
+    std::vector<uint8_t> source = { 0, 1, 64, 127, 128, 129, 200, 255 };
+    std::vector<float> samples(source.size());
+    Mixing::ConvertU8ToFloat(source.data(), samples.data(), source.size());
+    ASSERT_FLOAT_EQ(samples[4], 0.0f);
+
+    std::vector<uint8_t> output(source.size());
+    Mixing::ConvertFloatToU8(samples.data(), output.data(), samples.size());
+    ASSERT_EQ(source, output);
+}
+
+TEST(AudioMixingTest, accumulate_stereo_ramps_each_side)
+{
+    constexpr size_t numFrames = 11;
+    std::vector<float> source(numFrames * 2, 1.0f);
+    std::vector<float> mix(numFrames * 2, 0.5f);
+    Mixing::Accumulate(mix.data(), source.data(), numFrames, 2, { 0.0f, 1.1f }, { 1.1f, 0.0f });
+    for (size_t i = 0; i < numFrames; i++)
+    {
+        ASSERT_NEAR(mix[i * 2], 0.5f + i * 0.1f, 1e-5f);
+        ASSERT_NEAR(mix[i * 2 + 1], 0.5f + 1.1f - i * 0.1f, 1e-5f);
+    }
+}
+
+TEST(AudioMixingTest, accumulate_mono_uses_left_gain)
+{
+    constexpr size_t numFrames = 7;
+    std::vector<float> source(numFrames, -1.0f);
+    std::vector<float> mix(numFrames, 0.0f);
+    Mixing::Accumulate(mix.data(), source.data(), numFrames, 1, { 0.7f, 0.0f }, { 0.0f, 0.0f });
+    for (size_t i = 0; i < numFrames; i++)
+    {
+        ASSERT_NEAR(mix[i], -0.7f + i * 0.1f, 1e-5f);
+    }
+}
+
+TEST(AudioMixingTest, accumulate_constant_gain)
+{
+    constexpr size_t numFrames = 9;
+    std::vector<float> source(numFrames * 2);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        source[i] = static_cast<float>(i) / source.size();
+    }
+    std::vector<float> mix(numFrames * 2, 0.0f);
+    Mixing::Accumulate(mix.data(), source.data(), numFrames, 2, { 0.5f, 0.25f }, { 0.5f, 0.25f });
+    for (size_t i = 0; i < numFrames; i++)
+    {
+        ASSERT_FLOAT_EQ(mix[i * 2], source[i * 2] * 0.5f);
+        ASSERT_FLOAT_EQ(mix[i * 2 + 1], source[i * 2 + 1] * 0.25f);
+    }
+}
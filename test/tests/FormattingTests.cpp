@@ -9,6 +9,7 @@
 
 #include "openrct2/localisation/Formatting.h"
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <openrct2/Context.h>
 #include <openrct2/OpenRCT2.h>
@@ -339,6 +340,39 @@ TEST_F(FormattingTests, using_legacy_buffer_args)
     ASSERT_STREQ("Queuing for Boat Hire 2", buffer);
 }
 
+TEST_F(FormattingTests, using_legacy_buffer_args_after_cache_invalidation)
+{
+    auto ft = Formatter();
+    ft.Add<rct_string_id>(STR_DATE_DAY_1 + 21);
+    ft.Add<uint16_t>(3);
+    ft.Add<int16_t>(12);
+
+    char buffer[32]{};
+    FormatStringLegacy(buffer, sizeof(buffer), STR_DATE_FORMAT_DMY, ft.Data());
+    ASSERT_STREQ("22nd June, Year 12", buffer);
+
+    InvalidateFormatCache();
+    std::fill(std::begin(buffer), std::end(buffer), '\0');
+    FormatStringLegacy(buffer, sizeof(buffer), STR_DATE_FORMAT_DMY, ft.Data());
+    ASSERT_STREQ("22nd June, Year 12", buffer);
+}
+
+TEST_F(FormattingTests, using_legacy_buffer_args_currency)
+{
+    gConfigGeneral.currency_format = CurrencyType::Pounds;
+    auto ft = Formatter();
+    ft.Add<money64>(1111);
+
+    char buffer[32]{};
+    FormatStringLegacy(buffer, sizeof(buffer), STR_BOTTOM_TOOLBAR_CASH, ft.Data());
+    ASSERT_STREQ(u8"£111.10", buffer);
+}
+
+TEST_F(FormattingTests, month_year)
+{
+    ASSERT_EQ("July, Year 13", FormatString("{MONTHYEAR}", 100));
+}
+
 TEST_F(FormattingTests, format_number_basic)
 {
     FormatBuffer ss;
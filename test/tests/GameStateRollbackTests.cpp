@@ -0,0 +1,155 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/GameStateRollback.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/management/Finance.h>
+#include <openrct2/object/ObjectManager.h>
+#include <openrct2/platform/platform.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/world/Entrance.h>
+#include <openrct2/world/EntityTweener.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/MapAnimation.h>
+#include <openrct2/world/Park.h>
+#include <openrct2/world/Scenery.h>
+#include <openrct2/world/Sprite.h>
+#include <string>
+
+using namespace OpenRCT2;
+
+class GameStateRollbackTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        core_init();
+
+        _context = CreateContext();
+        ASSERT_TRUE(_context->Initialise());
+
+        std::string parkPath = TestData::GetParkPath("bpb.sv6");
+        auto importer = ParkImporter::CreateS6(_context->GetObjectRepository());
+        auto loadResult = importer->LoadSavedGame(parkPath.c_str(), false);
+        _context->GetObjectManager().LoadObjects(loadResult.RequiredObjects);
+        importer->Import();
+
+        reset_sprite_spatial_index();
+        reset_all_sprite_quadrant_placements();
+        scenery_set_default_placement_configuration();
+        load_palette();
+        EntityTweener::Get().Reset();
+        AutoCreateMapAnimations();
+        fix_invalid_vehicle_sprite_sizes();
+
+        gGameSpeed = 1;
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    static void AdvanceGameTicks(uint32_t ticks)
+    {
+        auto* gameState = _context->GetGameState();
+        for (uint32_t i = 0; i < ticks; i++)
+        {
+            gameState->UpdateLogic();
+        }
+    }
+
+    static std::unique_ptr<IContext> _context;
+};
+
+std::unique_ptr<IContext> GameStateRollbackTest::_context;
+
+TEST_F(GameStateRollbackTest, restore_returns_captured_state)
+{
+    auto rollback = CreateGameStateRollback(4);
+
+    AdvanceGameTicks(10);
+    auto tick = gCurrentTicks;
+    auto cash = gCash;
+    auto entranceFee = gParkEntranceFee;
+    auto parkEntrances = gParkEntrances;
+    auto peepSpawns = gPeepSpawns;
+    auto numMapAnimations = GetMapAnimations().size();
+    auto numRides = GetRides().size();
+    auto numTileElements = GetNumTileElementsInUse();
+    rollback->Capture();
+    ASSERT_TRUE(rollback->HasState(tick));
+
+    // Run ahead and record where the park ends up
+    AdvanceGameTicks(100);
+    auto expectedChecksum = sprite_checksum().ToString();
+    auto expectedCash = gCash;
+
+    // Change the state that game commands touch outside of the tile elements and entities
+    gParkEntranceFee = entranceFee + MONEY(5, 00);
+    gParkEntrances.push_back({ 32, 32, 16, 0 });
+    gPeepSpawns.clear();
+    map_animation_create(MAP_ANIMATION_TYPE_REMOVE, { 64, 64, 16 });
+
+    ASSERT_TRUE(rollback->Restore(tick));
+    ASSERT_EQ(gCurrentTicks, tick);
+    ASSERT_EQ(gCash, cash);
+    ASSERT_EQ(gParkEntranceFee, entranceFee);
+    ASSERT_EQ(gParkEntrances, parkEntrances);
+    ASSERT_EQ(gPeepSpawns, peepSpawns);
+    ASSERT_EQ(GetMapAnimations().size(), numMapAnimations);
+    ASSERT_EQ(GetRides().size(), numRides);
+    ASSERT_EQ(GetNumTileElementsInUse(), numTileElements);
+
+    // Running the same ticks again from the restored state has to end up in the same place
+    AdvanceGameTicks(100);
+    ASSERT_EQ(sprite_checksum().ToString(), expectedChecksum);
+    ASSERT_EQ(gCash, expectedCash);
+}
+
+TEST_F(GameStateRollbackTest, restore_discards_later_states)
+{
+    auto rollback = CreateGameStateRollback(4);
+
+    auto first = gCurrentTicks;
+    rollback->Capture();
+    AdvanceGameTicks(1);
+    auto second = gCurrentTicks;
+    rollback->Capture();
+
+    ASSERT_TRUE(rollback->Restore(first));
+    ASSERT_TRUE(rollback->HasState(first));
+    ASSERT_FALSE(rollback->HasState(second));
+    ASSERT_FALSE(rollback->Restore(second));
+}
+
+TEST_F(GameStateRollbackTest, oldest_state_is_overwritten)
+{
+    auto rollback = CreateGameStateRollback(2);
+
+    auto first = gCurrentTicks;
+    rollback->Capture();
+    AdvanceGameTicks(1);
+    rollback->Capture();
+    AdvanceGameTicks(1);
+    auto third = gCurrentTicks;
+    rollback->Capture();
+
+    ASSERT_FALSE(rollback->HasState(first));
+    ASSERT_TRUE(rollback->HasState(third));
+}
@@ -0,0 +1,141 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/ImageIdAllocator.h>
+#include <random>
+#include <utility>
+#include <vector>
+
+constexpr uint32_t TEST_BASE_ID = 1000;
+constexpr uint32_t TEST_COUNT = 100000;
+
+TEST(ImageIdAllocatorTest, allocate_all)
+{
+    ImageIdAllocator allocator(TEST_BASE_ID, TEST_COUNT);
+    ASSERT_EQ(allocator.Allocate(TEST_COUNT), TEST_BASE_ID);
+    ASSERT_EQ(allocator.GetNumFree(), 0U);
+    ASSERT_EQ(allocator.Allocate(1), ImageIdAllocator::INVALID_ID);
+
+    ASSERT_TRUE(allocator.Free(TEST_BASE_ID, TEST_COUNT));
+    ASSERT_EQ(allocator.GetNumAllocated(), 0U);
+    ASSERT_EQ(allocator.GetLargestFreeRange(), TEST_COUNT);
+}
+
+TEST(ImageIdAllocatorTest, free_merges_neighbours)
+{
+    ImageIdAllocator allocator(TEST_BASE_ID, 30);
+    auto a = allocator.Allocate(10);
+    auto b = allocator.Allocate(10);
+    auto c = allocator.Allocate(10);
+    ASSERT_EQ(a, TEST_BASE_ID);
+    ASSERT_EQ(b, TEST_BASE_ID + 10);
+    ASSERT_EQ(c, TEST_BASE_ID + 20);
+
+    ASSERT_TRUE(allocator.Free(a, 10));
+    ASSERT_TRUE(allocator.Free(c, 10));
+    ASSERT_EQ(allocator.GetNumFreeRanges(), 2U);
+
+    // Freeing the middle range joins all three into one.
+    ASSERT_TRUE(allocator.Free(b, 10));
+    ASSERT_EQ(allocator.GetNumFreeRanges(), 1U);
+    ASSERT_EQ(allocator.GetLargestFreeRange(), 30U);
+}
+
+TEST(ImageIdAllocatorTest, best_fit)
+{
+    ImageIdAllocator allocator(TEST_BASE_ID, 100);
+    auto a = allocator.Allocate(20);
+    ASSERT_EQ(allocator.Allocate(5), TEST_BASE_ID + 20);
+    auto c = allocator.Allocate(30);
+    auto d = allocator.Allocate(5);
+    ASSERT_TRUE(allocator.Free(a, 20));
+    ASSERT_TRUE(allocator.Free(c, 30));
+
+    // The 20 id gap is the smallest one that fits, the 30 id gap and the tail are left alone.
+    ASSERT_EQ(allocator.Allocate(15), a);
+    ASSERT_EQ(allocator.Allocate(25), c);
+    ASSERT_EQ(allocator.Allocate(40), d + 5);
+    ASSERT_EQ(allocator.Allocate(1), a + 15);
+}
+
+TEST(ImageIdAllocatorTest, invalid_free)
+{
+    ImageIdAllocator allocator(TEST_BASE_ID, 100);
+    auto a = allocator.Allocate(10);
+    ASSERT_FALSE(allocator.Free(a, 0));
+    ASSERT_FALSE(allocator.Free(TEST_BASE_ID - 1, 2));
+    ASSERT_FALSE(allocator.Free(TEST_BASE_ID + 95, 10));
+    ASSERT_FALSE(allocator.Free(a + 5, 10));
+    ASSERT_EQ(allocator.GetNumAllocated(), 10U);
+
+    ASSERT_TRUE(allocator.Free(a, 10));
+    ASSERT_FALSE(allocator.Free(a, 10));
+    ASSERT_EQ(allocator.GetNumAllocated(), 0U);
+}
+
+TEST(ImageIdAllocatorTest, stress)
+{
+    // Allocate and free random object sized ranges and compare against a plain map of used ids.
+    ImageIdAllocator allocator(TEST_BASE_ID, TEST_COUNT);
+    std::vector<bool> used(TEST_COUNT);
+    std::vector<std::pair<uint32_t, uint32_t>> allocations;
+    uint32_t numUsed = 0;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32_t> sizeDist(1, 2000);
+    for (int32_t i = 0; i < 20000; i++)
+    {
+        bool shouldFree = !allocations.empty() && (rng() % 100) < 45;
+        if (shouldFree)
+        {
+            auto index = rng() % allocations.size();
+            auto [baseId, count] = allocations[index];
+            allocations[index] = allocations.back();
+            allocations.pop_back();
+
+            ASSERT_TRUE(allocator.Free(baseId, count));
+            for (uint32_t j = 0; j < count; j++)
+            {
+                used[baseId - TEST_BASE_ID + j] = false;
+            }
+            numUsed -= count;
+        }
+        else
+        {
+            auto count = sizeDist(rng);
+            auto baseId = allocator.Allocate(count);
+            if (baseId == ImageIdAllocator::INVALID_ID)
+            {
+                ASSERT_LT(allocator.GetLargestFreeRange(), count);
+                continue;
+            }
+
+            ASSERT_GE(baseId, TEST_BASE_ID);
+            ASSERT_LE(baseId - TEST_BASE_ID + count, TEST_COUNT);
+            for (uint32_t j = 0; j < count; j++)
+            {
+                ASSERT_FALSE(used[baseId - TEST_BASE_ID + j]);
+                used[baseId - TEST_BASE_ID + j] = true;
+            }
+            allocations.emplace_back(baseId, count);
+            numUsed += count;
+        }
+        ASSERT_EQ(allocator.GetNumAllocated(), numUsed);
+    }
+
+    // Every free range is merged, so once everything is returned there is only one left.
+    for (auto [baseId, count] : allocations)
+    {
+        ASSERT_TRUE(allocator.Free(baseId, count));
+    }
+    ASSERT_EQ(allocator.GetNumAllocated(), 0U);
+    ASSERT_EQ(allocator.GetNumFreeRanges(), 1U);
+    ASSERT_EQ(allocator.GetLargestFreeRange(), TEST_COUNT);
+}
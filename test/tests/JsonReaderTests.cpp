@@ -0,0 +1,131 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/core/JsonReader.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static constexpr const char* TEST_OBJECT = R"json({
+    "id": "rct2.ride.test",
+    "authors": ["Chris Sawyer", 5, "Simon Foster"],
+    "properties": { "type": ["junior_rc"], "cars": [{ "numSeats": 2, "frames": { "flat": true } }] },
+    "images": [ "$CSG1", { "path": "a.png", "x": -1.5e3 } ],
+    "strings": { "name": { "en-GB": "Test \"ride\" é🎢", "nl-NL": "Test\tattractie" } },
+    "nothing": null,
+    "enabled": false
+})json";
+
+TEST(JsonReaderTest, read_members)
+{
+    Json::Reader reader(TEST_OBJECT);
+    ASSERT_TRUE(reader.BeginObject());
+
+    std::vector<std::string> keys;
+    std::string key;
+    while (reader.NextMember(key))
+    {
+        keys.push_back(key);
+        if (key == "id")
+        {
+            ASSERT_EQ(reader.ReadString(), "rct2.ride.test");
+        }
+        else if (key == "authors")
+        {
+            std::vector<std::string> authors;
+            ASSERT_TRUE(reader.BeginArray());
+            while (reader.NextElement())
+            {
+                if (auto author = reader.ReadString())
+                {
+                    authors.push_back(*author);
+                }
+            }
+            ASSERT_EQ(authors, (std::vector<std::string>{ "Chris Sawyer", "Simon Foster" }));
+        }
+        else if (key == "strings")
+        {
+            ASSERT_TRUE(reader.BeginObject());
+            ASSERT_TRUE(reader.NextMember(key));
+            ASSERT_EQ(key, "name");
+            ASSERT_TRUE(reader.BeginObject());
+            ASSERT_TRUE(reader.NextMember(key));
+            ASSERT_EQ(reader.ReadString(), "Test \"ride\" \xC3\xA9\xF0\x9F\x8E\xA2");
+            ASSERT_TRUE(reader.NextMember(key));
+            ASSERT_EQ(key, "nl-NL");
+            ASSERT_EQ(reader.ReadString(), "Test\tattractie");
+            ASSERT_FALSE(reader.NextMember(key));
+            ASSERT_FALSE(reader.NextMember(key));
+        }
+        else if (key == "enabled")
+        {
+            ASSERT_EQ(reader.ReadBoolean(), false);
+        }
+        else
+        {
+            reader.Skip();
+        }
+    }
+    ASSERT_EQ(keys, (std::vector<std::string>{ "id", "authors", "properties", "images", "strings", "nothing", "enabled" }));
+}
+
+TEST(JsonReaderTest, read_again_from_position)
+{
+    std::string_view text = TEST_OBJECT;
+    Json::Reader reader(text);
+    ASSERT_TRUE(reader.BeginObject());
+
+    std::string key;
+    size_t position = 0;
+    while (reader.NextMember(key))
+    {
+        if (key == "properties")
+        {
+            position = reader.GetPosition();
+        }
+        reader.Skip();
+    }
+
+    Json::Reader properties(text.substr(position));
+    ASSERT_TRUE(properties.BeginObject());
+    ASSERT_TRUE(properties.NextMember(key));
+    ASSERT_EQ(key, "type");
+    ASSERT_EQ(properties.Peek(), Json::ValueType::Array);
+}
+
+TEST(JsonReaderTest, wrong_types_are_skipped)
+{
+    Json::Reader reader(R"([ { "a": [1, 2] }, "text", 12, true ])");
+    ASSERT_TRUE(reader.BeginArray());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ(reader.ReadString(), std::nullopt);
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ(reader.ReadBoolean(), std::nullopt);
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_FALSE(reader.BeginObject());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ(reader.ReadBoolean(), true);
+    ASSERT_FALSE(reader.NextElement());
+}
+
+TEST(JsonReaderTest, malformed)
+{
+    for (auto text : { R"({ "a": "unterminated })", R"({ "a" 1 })", R"({ "a": A })", R"([ "\x" ])", "" })
+    {
+        Json::Reader reader(text);
+        EXPECT_THROW(
+            {
+                reader.Skip();
+                reader.Skip();
+            },
+            std::runtime_error)
+            << text;
+    }
+}
@@ -11,6 +11,8 @@
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <utility>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
@@ -114,6 +116,86 @@ TEST_F(SawyerCodingTest, decode_chunk_rotate)
     test_decode(rotatedata, sizeof(rotatedata));
 }
 
+TEST_F(SawyerCodingTest, decode_sv4_range)
+{
+    std::vector<uint8_t> encoded(sizeof(randomdata) * 2 + 4);
+    size_t encodedSize = sawyercoding_encode_sv4(randomdata, encoded.data(), sizeof(randomdata));
+
+    // Only the requested range is written, the bytes around it are left alone
+    std::vector<uint8_t> decoded(102, 0xAA);
+    size_t decodedSize = sawyercoding_decode_sv4_range(encoded.data(), decoded.data() + 1, encodedSize, 500, 100);
+    ASSERT_EQ(decodedSize, 100U);
+    ASSERT_EQ(memcmp(decoded.data() + 1, randomdata + 500, 100), 0);
+    ASSERT_EQ(decoded[0], 0xAA);
+    ASSERT_EQ(decoded[101], 0xAA);
+
+    // A range past the end of the data is cut short
+    decodedSize = sawyercoding_decode_sv4_range(encoded.data(), decoded.data(), encodedSize, sizeof(randomdata) - 10, 100);
+    ASSERT_EQ(decodedSize, 10U);
+    ASSERT_EQ(memcmp(decoded.data(), randomdata + sizeof(randomdata) - 10, 10), 0);
+}
+
+TEST_F(SawyerCodingTest, read_chunk_into)
+{
+    for (const auto& [data, size] : { std::pair<const uint8_t*, size_t>{ nonedata, sizeof(nonedata) },
+                                      { rledata, sizeof(rledata) },
+                                      { rlecompresseddata, sizeof(rlecompresseddata) },
+                                      { rotatedata, sizeof(rotatedata) } })
+    {
+        // Exact size
+        std::vector<uint8_t> decoded(sizeof(randomdata));
+        OpenRCT2::MemoryStream ms(data, size);
+        SawyerChunkReader(&ms).ReadChunk(decoded.data(), decoded.size());
+        ASSERT_EQ(memcmp(decoded.data(), randomdata, sizeof(randomdata)), 0);
+        ASSERT_EQ(ms.GetPosition(), size);
+
+        // Larger destinations are padded with zero
+        decoded.assign(sizeof(randomdata) + 16, 0xAA);
+        ms.SetPosition(0);
+        SawyerChunkReader(&ms).ReadChunk(decoded.data(), decoded.size());
+        ASSERT_EQ(memcmp(decoded.data(), randomdata, sizeof(randomdata)), 0);
+        ASSERT_EQ(decoded.back(), 0);
+
+        // Smaller destinations are truncated, but the whole chunk is still consumed
+        decoded.assign(sizeof(randomdata) / 2 + 1, 0);
+        ms.SetPosition(0);
+        SawyerChunkReader(&ms).ReadChunk(decoded.data(), decoded.size());
+        ASSERT_EQ(memcmp(decoded.data(), randomdata, decoded.size()), 0);
+        ASSERT_EQ(ms.GetPosition(), size);
+    }
+}
+
+TEST_F(SawyerCodingTest, read_chunks)
+{
+    OpenRCT2::MemoryStream ms;
+    ms.Write(rledata, sizeof(rledata));
+    ms.Write(rlecompresseddata, sizeof(rlecompresseddata));
+    ms.Write(rotatedata, sizeof(rotatedata));
+    ms.SetPosition(0);
+
+    std::vector<uint8_t> decoded[3];
+    std::vector<SawyerChunkReader::ChunkDestination> destinations;
+    for (auto& buffer : decoded)
+    {
+        buffer.resize(sizeof(randomdata));
+        destinations.push_back({ buffer.data(), buffer.size() });
+    }
+    SawyerChunkReader(&ms).ReadChunks(destinations);
+    for (const auto& buffer : decoded)
+    {
+        ASSERT_EQ(memcmp(buffer.data(), randomdata, sizeof(randomdata)), 0);
+    }
+
+    // A corrupt chunk fails the whole read and leaves the stream where it was
+    OpenRCT2::MemoryStream invalidMs;
+    invalidMs.Write(rledata, sizeof(rledata));
+    invalidMs.Write(invalid1, sizeof(invalid1));
+    invalidMs.SetPosition(0);
+    destinations.pop_back();
+    EXPECT_THROW(SawyerChunkReader(&invalidMs).ReadChunks(destinations), SawyerChunkException);
+    ASSERT_EQ(invalidMs.GetPosition(), 0U);
+}
+
 TEST_F(SawyerCodingTest, invalid1)
 {
     OpenRCT2::MemoryStream ms(invalid1, sizeof(invalid1));